@@ -0,0 +1,223 @@
+#include <rom/miniz.h>
+#include "AssetDecoder.h"
+
+AssetDecoder *AssetDecoder::instance = NULL;
+
+void AssetDecoder::init(AssetPack *pack, size_t budget)
+{
+    clear();
+    this->pack = pack;
+    this->budget = budget;
+    instance = this;
+    // new decoders go first, the built-in one still serves everything else
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoderInfo);
+    lv_img_decoder_set_open_cb(decoder, decoderOpen);
+    lv_img_decoder_set_close_cb(decoder, decoderClose);
+}
+
+bool AssetDecoder::hasImage(const char *name)
+{
+    const AssetPackEntry *entry = pack ? pack->find(name) : NULL;
+    return entry != NULL && ASSET_TYPE_IMAGE == entry->type;
+}
+
+void AssetDecoder::clear()
+{
+    for (uint8_t i = 0; i < ASSET_CACHE_ENTRIES; i++)
+    {
+        release(&entries[i]);
+    }
+}
+
+void AssetDecoder::reset()
+{
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+    inflateTime = 0;
+}
+
+void AssetDecoder::print(Print &out)
+{
+    uint8_t images = 0;
+    for (uint8_t i = 0; i < ASSET_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].data != NULL)
+            images++;
+    }
+    out.printf("assets: %d entries, %d images cached in %d/%d B, %d hits, %d inflated in %d us, %d evicted\r\n",
+               pack ? pack->getEntrySize() : 0, images, used, budget, hits, misses, inflateTime, evictions);
+}
+
+lv_res_t AssetDecoder::decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    const AssetPackEntry *entry = instance->findImage(src);
+    if (NULL == entry)
+        return LV_RES_INV;
+    memcpy(header, &entry->info, sizeof(lv_img_header_t));
+    return LV_RES_OK;
+}
+
+lv_res_t AssetDecoder::decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    const AssetPackEntry *entry = instance->findImage(dsc->src);
+    if (NULL == entry)
+        return LV_RES_INV;
+    if (ASSET_COMPRESSION_NONE == entry->compression)
+    {
+        // mapped flash, drawn in place
+        dsc->img_data = instance->pack->getData(entry);
+        dsc->user_data = NULL;
+        return LV_RES_OK;
+    }
+    AssetCacheEntry *cached = instance->load(entry);
+    if (NULL == cached)
+        return LV_RES_INV;
+    cached->refs++;
+    dsc->img_data = cached->data;
+    dsc->user_data = cached;
+    return LV_RES_OK;
+}
+
+void AssetDecoder::decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    AssetCacheEntry *cached = (AssetCacheEntry *)dsc->user_data;
+    if (cached != NULL && cached->refs > 0)
+        cached->refs--;
+    dsc->user_data = NULL;
+}
+
+// "P:name" of a true color image packed for this LV_COLOR_DEPTH and byte order
+const AssetPackEntry *AssetDecoder::findImage(const void *src)
+{
+    if (NULL == pack || lv_img_src_get_type(src) != LV_IMG_SRC_FILE)
+        return NULL;
+    const char *path = (const char *)src;
+    if (strncmp(path, ASSET_SRC_PREFIX, strlen(ASSET_SRC_PREFIX)))
+        return NULL;
+    const AssetPackEntry *entry = pack->find(path + strlen(ASSET_SRC_PREFIX));
+    if (NULL == entry || entry->type != ASSET_TYPE_IMAGE)
+        return NULL;
+    if (((pack->getFlags() & ASSET_PACK_FLAG_SWAP16) != 0) != (LV_COLOR_16_SWAP != 0))
+    {
+        // the pixels would show with their bytes swapped, LVGL draws its fallback
+        if (!swapLogged)
+            Serial.printf("asset [%s]: packed for LV_COLOR_16_SWAP %d, skipped\r\n", entry->name, pack->getFlags() & ASSET_PACK_FLAG_SWAP16);
+        swapLogged = true;
+        return NULL;
+    }
+    lv_img_header_t header;
+    memcpy(&header, &entry->info, sizeof(header));
+    uint32_t size;
+    switch (header.cf)
+    {
+    case LV_IMG_CF_TRUE_COLOR:
+    case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+        size = LV_IMG_BUF_SIZE_TRUE_COLOR(header.w, header.h);
+        break;
+    case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        size = LV_IMG_BUF_SIZE_TRUE_COLOR_ALPHA(header.w, header.h);
+        break;
+    default:
+        return NULL;
+    }
+    return entry->rawSize == size ? entry : NULL;
+}
+
+// An image over the budget still loads, it is just the first one out
+AssetCacheEntry *AssetDecoder::load(const AssetPackEntry *entry)
+{
+    tick++;
+    AssetCacheEntry *slot = NULL;
+    for (uint8_t i = 0; i < ASSET_CACHE_ENTRIES; i++)
+    {
+        AssetCacheEntry *cached = &entries[i];
+        if (NULL == cached->data)
+        {
+            if (NULL == slot)
+                slot = cached;
+            continue;
+        }
+        if (cached->entry == entry)
+        {
+            cached->lastUse = tick;
+            hits++;
+            return cached;
+        }
+    }
+    misses++;
+    while (NULL == slot || used + entry->rawSize > budget)
+    {
+        AssetCacheEntry *cached = evict();
+        if (NULL == cached)
+            break;
+        if (NULL == slot)
+            slot = cached;
+    }
+    if (NULL == slot)
+        return NULL;
+    uint8_t *data = (uint8_t *)malloc(entry->rawSize);
+    if (NULL == data)
+        return NULL;
+    uint32_t beginTime = micros();
+    if (!inflate(entry, data))
+    {
+        Serial.printf("asset [%s]: inflate failed\r\n", entry->name);
+        free(data);
+        return NULL;
+    }
+    inflateTime += micros() - beginTime;
+    slot->entry = entry;
+    slot->data = data;
+    slot->size = entry->rawSize;
+    slot->lastUse = tick;
+    slot->refs = 0;
+    used += entry->rawSize;
+    return slot;
+}
+
+bool AssetDecoder::inflate(const AssetPackEntry *entry, uint8_t *out)
+{
+    // about 11 KB, too much for the render task stack
+    tinfl_decompressor *decompressor = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    if (NULL == decompressor)
+        return false;
+    tinfl_init(decompressor);
+    size_t inLen = entry->size;
+    size_t outLen = entry->rawSize;
+    tinfl_status status = tinfl_decompress(decompressor, pack->getData(entry), &inLen, out, out, &outLen,
+                                           TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    free(decompressor);
+    return TINFL_STATUS_DONE == status && outLen == entry->rawSize;
+}
+
+AssetCacheEntry *AssetDecoder::evict()
+{
+    AssetCacheEntry *oldest = NULL;
+    for (uint8_t i = 0; i < ASSET_CACHE_ENTRIES; i++)
+    {
+        AssetCacheEntry *cached = &entries[i];
+        if (cached->data != NULL && 0 == cached->refs &&
+            (NULL == oldest || tick - cached->lastUse > tick - oldest->lastUse))
+            oldest = cached;
+    }
+    if (oldest != NULL)
+    {
+        release(oldest);
+        evictions++;
+    }
+    return oldest;
+}
+
+void AssetDecoder::release(AssetCacheEntry *entry)
+{
+    if (NULL == entry->data)
+        return;
+    free(entry->data);
+    used -= entry->size;
+    entry->entry = NULL;
+    entry->data = NULL;
+    entry->size = 0;
+    entry->refs = 0;
+}
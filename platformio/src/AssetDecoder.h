@@ -0,0 +1,58 @@
+#ifndef _ASSET_DECODER_H_
+#define _ASSET_DECODER_H_
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "AssetPack.h"
+
+#define ASSET_SRC_PREFIX "P:" // lv_img_set_src(img, "P:scene-tv")
+#define ASSET_SRC_LEN (2 + ASSET_NAME_LEN)
+#define ASSET_CACHE_ENTRIES 8
+
+typedef struct
+{
+    const AssetPackEntry *entry;
+    uint8_t *data;
+    uint32_t size;    // uint: byte
+    uint32_t lastUse; // open tick, the smallest one is evicted first
+    uint8_t refs;     // opened by LVGL, never evicted meanwhile
+} AssetCacheEntry;
+
+// LVGL image decoder for the images of an AssetPack. Stored images are
+// drawn straight from the mapped partition; compressed ones are inflated
+// on first use and kept, least recently used out, up to the byte budget
+// given to init(). Called from LVGL, so only the render task changes it,
+// reset() included; other tasks only print it or ask hasImage().
+class AssetDecoder
+{
+public:
+    void init(AssetPack *pack, size_t budget);
+    bool hasImage(const char *name);
+    void clear();
+    void reset();
+    void print(Print &out);
+
+private:
+    static lv_res_t decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+    static lv_res_t decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+    static void decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+    const AssetPackEntry *findImage(const void *src);
+    AssetCacheEntry *load(const AssetPackEntry *entry);
+    bool inflate(const AssetPackEntry *entry, uint8_t *out);
+    AssetCacheEntry *evict();
+    void release(AssetCacheEntry *entry);
+
+    static AssetDecoder *instance;
+    AssetPack *pack = NULL;
+    AssetCacheEntry entries[ASSET_CACHE_ENTRIES];
+    size_t budget = 0; // uint: byte
+    size_t used = 0;   // uint: byte
+    uint32_t tick = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t inflateTime = 0; // uint: us
+    bool swapLogged = false;  // byte order mismatch reported once
+};
+
+#endif
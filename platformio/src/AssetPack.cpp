@@ -0,0 +1,94 @@
+#include <string.h>
+#include "AssetPack.h"
+#include "Crc32.h"
+
+bool AssetPack::attach(const uint8_t *data, size_t len, bool verify)
+{
+    detach();
+    if (NULL == data || len < sizeof(AssetPackHeader))
+        return false;
+    const AssetPackHeader *h = (const AssetPackHeader *)data;
+    if (h->magic != ASSET_PACK_MAGIC || h->version != ASSET_PACK_VERSION)
+        return false;
+    size_t tableEnd = sizeof(AssetPackHeader) + (size_t)h->entryNum * sizeof(AssetPackEntry);
+    if (h->size < tableEnd || h->size > len)
+        return false;
+    if (verify && crc32(data + sizeof(AssetPackHeader), h->size - sizeof(AssetPackHeader)) != h->crc)
+        return false;
+    const AssetPackEntry *table = (const AssetPackEntry *)(data + sizeof(AssetPackHeader));
+    for (uint16_t i = 0; i < h->entryNum; i++)
+    {
+        const AssetPackEntry *entry = &table[i];
+        if (entry->offset < tableEnd || entry->offset > h->size || entry->size > h->size - entry->offset)
+            return false;
+        if (entry->name[ASSET_NAME_LEN - 1] != '\0')
+            return false;
+    }
+    this->data = data;
+    this->header = h;
+    this->entries = table;
+    return true;
+}
+
+void AssetPack::detach()
+{
+    data = NULL;
+    header = NULL;
+    entries = NULL;
+}
+
+bool AssetPack::isValid()
+{
+    return header != NULL;
+}
+
+uint32_t AssetPack::getSize()
+{
+    return header ? header->size : 0;
+}
+
+uint32_t AssetPack::getStamp()
+{
+    return header ? header->stamp : 0;
+}
+
+uint16_t AssetPack::getFlags()
+{
+    return header ? header->flags : 0;
+}
+
+uint16_t AssetPack::getEntrySize()
+{
+    return header ? header->entryNum : 0;
+}
+
+const AssetPackEntry *AssetPack::getEntry(uint16_t idx)
+{
+    return header && idx < header->entryNum ? &entries[idx] : NULL;
+}
+
+// Entries are sorted by name, binary search
+const AssetPackEntry *AssetPack::find(const char *name)
+{
+    if (NULL == header)
+        return NULL;
+    int32_t low = 0;
+    int32_t high = (int32_t)header->entryNum - 1;
+    while (low <= high)
+    {
+        int32_t mid = (low + high) / 2;
+        int cmp = strncmp(name, entries[mid].name, ASSET_NAME_LEN);
+        if (0 == cmp)
+            return &entries[mid];
+        if (cmp < 0)
+            high = mid - 1;
+        else
+            low = mid + 1;
+    }
+    return NULL;
+}
+
+const uint8_t *AssetPack::getData(const AssetPackEntry *entry)
+{
+    return data && entry ? data + entry->offset : NULL;
+}
@@ -0,0 +1,79 @@
+#ifndef _ASSET_PACK_H_
+#define _ASSET_PACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Asset pack: images and fonts built by tools/asset_pack.py from
+// data/assets and installed into their own data partition, so they ship
+// with a data upload instead of the firmware and are used straight from
+// the memory mapped partition.
+//
+// [header][entries, sorted by name][data]
+//
+// Entry data is stored as is or raw deflate compressed. An image is LVGL
+// pixel data in the true color format given by its info word (an
+// lv_img_header_t); a font is an LVGL binary font.
+
+#define ASSET_PACK_MAGIC 0x4B505341 // "ASPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_NAME_LEN 24
+#define ASSET_PACK_FLAG_SWAP16 0x0001 // RGB565 pixels in LV_COLOR_16_SWAP order
+
+typedef enum
+{
+    ASSET_TYPE_IMAGE = 1,
+    ASSET_TYPE_FONT
+} AssetType;
+
+typedef enum
+{
+    ASSET_COMPRESSION_NONE = 0,
+    ASSET_COMPRESSION_DEFLATE
+} AssetCompression;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entryNum;
+    uint32_t size;  // whole pack, header included
+    uint32_t crc;   // over everything after the header
+    uint32_t stamp; // crc of the source files, tells uploads apart
+    uint16_t flags;
+    uint16_t reserved;
+} AssetPackHeader;
+
+typedef struct
+{
+    char name[ASSET_NAME_LEN]; // zero padded
+    uint8_t type;
+    uint8_t compression;
+    uint16_t reserved;
+    uint32_t offset;  // from the start of the pack
+    uint32_t size;    // stored
+    uint32_t rawSize; // decompressed
+    uint32_t info;    // image: lv_img_header_t
+} AssetPackEntry;
+
+class AssetPack
+{
+public:
+    bool attach(const uint8_t *data, size_t len, bool verify = true);
+    void detach();
+    bool isValid();
+    uint32_t getSize();
+    uint32_t getStamp();
+    uint16_t getFlags();
+    uint16_t getEntrySize();
+    const AssetPackEntry *getEntry(uint16_t idx);
+    const AssetPackEntry *find(const char *name);
+    const uint8_t *getData(const AssetPackEntry *entry);
+
+private:
+    const uint8_t *data = NULL;
+    const AssetPackHeader *header = NULL;
+    const AssetPackEntry *entries = NULL;
+};
+
+#endif
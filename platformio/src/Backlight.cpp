@@ -0,0 +1,103 @@
+#include "Backlight.h"
+
+// After ledcSetup()/ledcAttachPin() of the same channel
+void Backlight::init(uint8_t channel, uint32_t freq)
+{
+    // Arduino channels 0-7 are the high speed group, 8-15 the low speed one
+    this->mode = channel < 8 ? LEDC_HIGH_SPEED_MODE : LEDC_LOW_SPEED_MODE;
+    this->channel = (ledc_channel_t)(channel % 8);
+    this->freq = freq;
+    started = ledc_get_duty(mode, this->channel);
+}
+
+void Backlight::set(uint16_t duty, uint16_t fadeTime)
+{
+    portENTER_CRITICAL(&lock);
+    target = duty;
+    targetTime = fadeTime;
+    pending = true;
+    portEXIT_CRITICAL(&lock);
+}
+
+void Backlight::scan()
+{
+    if (!pending)
+        return;
+    portENTER_CRITICAL(&lock);
+    uint16_t duty = target;
+    uint16_t time = targetTime;
+    pending = false;
+    portEXIT_CRITICAL(&lock);
+    if (duty != started)
+        start(duty, time);
+}
+
+// Dark right away, ahead of a sleep that would hold a pending fade-out
+void Backlight::off()
+{
+    portENTER_CRITICAL(&lock);
+    target = 0;
+    pending = false;
+    portEXIT_CRITICAL(&lock);
+    start(0, 0);
+}
+
+uint16_t Backlight::getTarget()
+{
+    return pending ? target : started;
+}
+
+// As the hardware has it right now, mid fade included
+uint16_t Backlight::getDuty()
+{
+    return ledc_get_duty(mode, channel);
+}
+
+void Backlight::reset()
+{
+    portENTER_CRITICAL(&lock);
+    fades = 0;
+    startTime = 0;
+    portEXIT_CRITICAL(&lock);
+}
+
+void Backlight::print(Print &out)
+{
+    portENTER_CRITICAL(&lock);
+    uint32_t fadeNum = fades;
+    uint32_t time = startTime;
+    portEXIT_CRITICAL(&lock);
+    out.printf("backlight: duty %d -> %d, %d fades, %d us CPU to start them\r\n",
+               getDuty(), getTarget(), fadeNum, time);
+}
+
+// From the duty the hardware is at, a running fade included
+void Backlight::start(uint16_t duty, uint16_t time)
+{
+    uint32_t beginTime = micros();
+    uint32_t from = ledc_get_duty(mode, channel);
+    bool up = duty > from;
+    uint32_t delta = up ? duty - from : from - duty;
+    uint32_t cycles = (uint32_t)time * freq / 1000;
+    if (0 == delta || 0 == cycles)
+    {
+        ledc_set_duty(mode, channel, duty);
+    }
+    else
+    {
+        // few PWM cycles for the distance: bigger steps, one per cycle
+        uint32_t scale = min((delta + cycles - 1) / cycles, (uint32_t)BACKLIGHT_FADE_LIMIT);
+        uint32_t steps = min(delta / scale, (uint32_t)BACKLIGHT_FADE_LIMIT);
+        uint32_t cyclesPerStep = min(max((cycles + steps / 2) / steps, (uint32_t)1), (uint32_t)BACKLIGHT_FADE_LIMIT);
+        // what the steps do not cover is jumped at the start, the fade ends on duty
+        uint32_t begin = up ? duty - steps * scale : duty + steps * scale;
+        ledc_set_fade(mode, channel, begin, up ? LEDC_DUTY_DIR_INCREASE : LEDC_DUTY_DIR_DECREASE,
+                      steps, cyclesPerStep, scale);
+    }
+    ledc_update_duty(mode, channel);
+    portENTER_CRITICAL(&lock);
+    startTime += micros() - beginTime;
+    fades++;
+    portEXIT_CRITICAL(&lock);
+    started = duty;
+}
@@ -0,0 +1,43 @@
+#ifndef _BACKLIGHT_H_
+#define _BACKLIGHT_H_
+
+#include <Arduino.h>
+#include <driver/ledc.h>
+
+#define BACKLIGHT_FADE_LIMIT 1023 // step count, cycles per step and step size the LEDC takes
+
+// Panel backlight on an Arduino LEDC channel, every change faded by the
+// LEDC hardware: one ledc_set_fade() programs the step size, the PWM cycles
+// per step and the step count, the hardware steps the duty on its own and
+// no interrupt is taken. Without the driver's fade ISR (ledc_fade_func_install)
+// a new fade overrides the running one at once, so a wake during a fade-out
+// turns it around from the duty reached. set() may be called from any task,
+// scan() and off() from one.
+class Backlight
+{
+public:
+    void init(uint8_t channel, uint32_t freq);
+    void set(uint16_t duty, uint16_t fadeTime);
+    void scan();
+    void off();
+    uint16_t getTarget();
+    uint16_t getDuty();
+    void reset();
+    void print(Print &out);
+
+private:
+    void start(uint16_t duty, uint16_t time);
+
+    ledc_mode_t mode = LEDC_HIGH_SPEED_MODE;
+    ledc_channel_t channel = LEDC_CHANNEL_0;
+    uint32_t freq = 0; // uint: Hz
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    uint16_t target = 0;
+    uint16_t targetTime = 0; // uint: ms
+    bool pending = false;
+    uint16_t started = 0; // duty the last fade ends at
+    uint32_t fades = 0;
+    uint32_t startTime = 0; // CPU time to start the fades, uint: us
+};
+
+#endif
@@ -0,0 +1,53 @@
+#include "BootTimer.h"
+
+uint8_t BootTimer::begin(const char *name)
+{
+    uint32_t now = micros();
+    portENTER_CRITICAL(&lock);
+    uint8_t idx = phaseNum < BOOT_PHASE_MAX ? phaseNum++ : BOOT_PHASE_MAX;
+    portEXIT_CRITICAL(&lock);
+    if (idx >= BOOT_PHASE_MAX)
+        return idx;
+    phases[idx].name = name;
+    phases[idx].beginTime = now;
+    phases[idx].time = 0;
+    phases[idx].core = xPortGetCoreID();
+    return idx;
+}
+
+void BootTimer::end(uint8_t phase)
+{
+    if (phase < BOOT_PHASE_MAX)
+        phases[phase].time = max(micros() - phases[phase].beginTime, (uint32_t)1);
+}
+
+void BootTimer::ready()
+{
+    readyTime = micros();
+}
+
+uint32_t BootTimer::getTotal()
+{
+    return readyTime;
+}
+
+uint8_t BootTimer::getPhaseNum()
+{
+    return phaseNum;
+}
+
+const BootPhase *BootTimer::getPhase(uint8_t idx)
+{
+    return idx < phaseNum ? &phases[idx] : NULL;
+}
+
+void BootTimer::print(Print &out)
+{
+    out.printf("boot: ready in %d ms\r\n", readyTime / 1000);
+    for (uint8_t i = 0; i < phaseNum; i++)
+    {
+        const BootPhase *phase = &phases[i];
+        out.printf("  %-8s core %d  +%4d ms  %6d us\r\n", phase->name, phase->core,
+                   phase->beginTime / 1000, phase->time);
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef _BOOT_TIMER_H_
+#define _BOOT_TIMER_H_
+
+#include <Arduino.h>
+
+#define BOOT_PHASE_MAX 12
+
+typedef struct
+{
+    const char *name;
+    uint32_t beginTime; // uint: us since reset
+    uint32_t time;      // uint: us, 0 while running
+    uint8_t core;
+} BootPhase;
+
+// Duration of each init phase. Phases run on both cores at once, so
+// begin()/end() may be called concurrently; the total is the wall clock
+// from reset to ready(), not the sum of the phases.
+class BootTimer
+{
+public:
+    uint8_t begin(const char *name);
+    void end(uint8_t phase);
+    void ready();
+    uint32_t getTotal();
+    uint8_t getPhaseNum();
+    const BootPhase *getPhase(uint8_t idx);
+    void print(Print &out);
+
+private:
+    BootPhase phases[BOOT_PHASE_MAX];
+    uint8_t phaseNum = 0;
+    uint32_t readyTime = 0; // uint: us
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif
@@ -1,31 +1,129 @@
-#include <Arduino.h>
-#include <time.h>
+#include <esp_timer.h>
 #include "ClockHelper.h"
 
 void ClockHelper::setTime(uint64_t time)
 {
-    this->time = time;
-    this->bootDelay = time - millis();
-    refresh();
+    portENTER_CRITICAL(&lock);
+    bootDelay = (int64_t)time - (int64_t)uptime();
+    set = true;
+    fieldsValid = false;
+    portEXIT_CRITICAL(&lock);
 }
 
-void ClockHelper::refresh()
+void ClockHelper::setZone(int16_t offset)
 {
-    this->time = this->bootDelay + millis();
-    time_t t = (this->time + 8 * 3600000) / 1000; // GTM+8
-    struct tm *p = gmtime(&t);
-    this->year = p->tm_year + 1900;
-    this->month = p->tm_mon;
-    this->day = p->tm_mday;
-    this->hour = p->tm_hour;
-    this->minute = p->tm_min;
-    this->second = p->tm_sec;
+    portENTER_CRITICAL(&lock);
+    zone = offset;
+    fieldsValid = false;
+    portEXIT_CRITICAL(&lock);
+}
+
+bool ClockHelper::isSet()
+{
+    return set;
 }
 
 uint64_t ClockHelper::getTime()
 {
+    portENTER_CRITICAL(&lock);
+    uint64_t time = uptime() + bootDelay;
+    portEXIT_CRITICAL(&lock);
     return time;
 }
+
+// Cheap enough to call every pass: one division unless a second went by
+uint8_t ClockHelper::refresh()
+{
+    portENTER_CRITICAL(&lock);
+    int64_t local = ((int64_t)uptime() + bootDelay) / 1000 + zone * 60;
+    if (local < 0)
+        local = 0;
+    uint16_t oldYear = year;
+    uint8_t oldMonth = month;
+    uint8_t oldDay = day;
+    uint8_t oldHour = hour;
+    uint8_t oldMinute = minute;
+    uint8_t oldSecond = second;
+    uint8_t changed = 0;
+    if (!fieldsValid || (uint64_t)local < fieldsTime || (uint64_t)local - fieldsTime > CLOCK_STEP_LIMIT)
+    {
+        convert(local);
+        changed = fieldsValid ? 0 : CLOCK_CHANGED_ALL;
+        fieldsValid = true;
+    }
+    else if ((uint64_t)local != fieldsTime)
+    {
+        step(local - fieldsTime);
+    }
+    fieldsTime = local;
+    if (second != oldSecond)
+        changed |= CLOCK_CHANGED_SECOND;
+    if (minute != oldMinute)
+        changed |= CLOCK_CHANGED_MINUTE;
+    if (hour != oldHour)
+        changed |= CLOCK_CHANGED_HOUR;
+    if (day != oldDay)
+        changed |= CLOCK_CHANGED_DAY;
+    if (month != oldMonth)
+        changed |= CLOCK_CHANGED_MONTH;
+    if (year != oldYear)
+        changed |= CLOCK_CHANGED_YEAR;
+    portEXIT_CRITICAL(&lock);
+    return changed;
+}
+
+uint64_t ClockHelper::uptime()
+{
+    return esp_timer_get_time() / 1000;
+}
+
+// Days since 1970-01-01 to a civil date, proleptic Gregorian calendar
+void ClockHelper::convert(uint64_t local)
+{
+    uint32_t days = local / 86400;
+    uint32_t secs = local % 86400;
+    hour = secs / 3600;
+    minute = secs / 60 % 60;
+    second = secs % 60;
+    uint32_t z = days + 719468; // from 0000-03-01
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+void ClockHelper::step(uint32_t seconds)
+{
+    uint32_t total = second + seconds;
+    second = total % 60;
+    total = minute + total / 60;
+    minute = total % 60;
+    total = hour + total / 60;
+    hour = total % 24;
+    for (uint32_t days = total / 24; days > 0; days--)
+    {
+        nextDay();
+    }
+}
+
+void ClockHelper::nextDay()
+{
+    static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (0 == year % 4 && year % 100 != 0) || 0 == year % 400;
+    uint8_t last = monthDays[month - 1] + (2 == month && leap ? 1 : 0);
+    if (++day <= last)
+        return;
+    day = 1;
+    if (++month <= 12)
+        return;
+    month = 1;
+    year++;
+}
+
 uint16_t ClockHelper::getYear()
 {
     return year;
@@ -49,4 +147,4 @@ uint8_t ClockHelper::getMinute()
 uint8_t ClockHelper::getSecond()
 {
     return second;
-}
\ No newline at end of file
+}
@@ -1,25 +1,59 @@
-#include <stdint.h>
+#ifndef _CLOCK_HELPER_H_
+#define _CLOCK_HELPER_H_
 
+#include <Arduino.h>
+
+#define CLOCK_ZONE_OFFSET 480 // uint: min, GMT+8 until setZone()
+#define CLOCK_STEP_LIMIT 86400 // uint: s, a longer gap is converted from scratch
+
+// refresh() result, one bit per calendar field that moved
+#define CLOCK_CHANGED_SECOND 0x01
+#define CLOCK_CHANGED_MINUTE 0x02
+#define CLOCK_CHANGED_HOUR 0x04
+#define CLOCK_CHANGED_DAY 0x08
+#define CLOCK_CHANGED_MONTH 0x10
+#define CLOCK_CHANGED_YEAR 0x20
+#define CLOCK_CHANGED_ALL 0x3F
+
+// Wall clock: the server time given to setTime() carried forward on the
+// 64 bit esp_timer, so it does not jump when millis() wraps after 49 days.
+// refresh() steps the local calendar fields from where the last call left
+// them; only the first call, setTime(), setZone() or a gap over a day
+// convert from scratch, and those report CLOCK_CHANGED_ALL to the next
+// refresh(). May be used from any task.
 class ClockHelper
 {
 public:
-    uint64_t getTime();
+    uint64_t getTime(); // uint: ms since the epoch
     void setTime(uint64_t time);
+    void setZone(int16_t offset);
+    bool isSet();
     uint16_t getYear();
-    uint8_t getMonth();
+    uint8_t getMonth(); // 1 to 12
     uint8_t getDay();
     uint8_t getHour();
     uint8_t getMinute();
     uint8_t getSecond();
-    void refresh();
+    uint8_t refresh();
 
 private:
-    uint64_t bootDelay;
-    uint64_t time;
-    uint16_t year;
-    uint8_t month;
-    uint8_t day;
-    uint8_t hour;
-    uint8_t minute;
-    uint8_t second;
-};
\ No newline at end of file
+    uint64_t uptime();
+    void convert(uint64_t local);
+    void step(uint32_t seconds);
+    void nextDay();
+
+    int64_t bootDelay = 0; // wall clock minus uptime, uint: ms
+    bool set = false;
+    int16_t zone = CLOCK_ZONE_OFFSET; // uint: min
+    bool fieldsValid = false;
+    uint64_t fieldsTime = 0; // local time of the fields, uint: s
+    uint16_t year = 1970;
+    uint8_t month = 1;
+    uint8_t day = 1;
+    uint8_t hour = 0;
+    uint8_t minute = 0;
+    uint8_t second = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif
@@ -9,6 +9,14 @@ void CommandConsole::init(void (*task_run)(CCTask *task))
 
 void CommandConsole::read(uint8_t *data, uint32_t len)
 {
+    // a line that never ends is thrown away, the terminating NUL stays
+    if (line_buf_len + len >= CCLINE_BUF_LEN)
+    {
+        memset(line_buf, 0, CCLINE_BUF_LEN);
+        line_buf_len = 0;
+        if (len >= CCLINE_BUF_LEN)
+            return;
+    }
     memcpy((char *)&line_buf + line_buf_len, data, len);
     line_buf_len += len;
 
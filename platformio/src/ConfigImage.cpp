@@ -0,0 +1,710 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ConfigImage.h"
+#include "Crc32.h"
+
+#define CONFIG_IMAGE_ALIGN(n) (((n) + 7) & ~((size_t)7))
+#define CONFIG_IMAGE_PATH_LEN 64
+#define CONFIG_IMAGE_MSG_LEN 96
+
+static_assert(sizeof(ConfigImageHeader) % 8 == 0, "header must keep 8 byte alignment");
+static_assert(sizeof(ConfigImageScene) == 16, "scene record size changed");
+static_assert(sizeof(ConfigImageKey) == 16, "key record size changed");
+static_assert(sizeof(ConfigImageRemoteClient) == 8, "remote client record size changed");
+
+bool configImageParseCode(const char *text, uint64_t *value)
+{
+    if (NULL == text)
+        return false;
+    if ('0' == text[0] && ('x' == text[1] || 'X' == text[1]))
+        text += 2;
+    uint64_t num = 0;
+    uint8_t digits = 0;
+    for (const char *p = text; *p; p++)
+    {
+        char c = *p;
+        uint8_t n;
+        if (c >= '0' && c <= '9')
+            n = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            n = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            n = c - 'A' + 10;
+        else
+            return false;
+        if (++digits > CONFIG_IMAGE_CODE_MAX_DIGITS)
+            return false;
+        num = (num << 4) | n;
+    }
+    if (0 == digits)
+        return false;
+    *value = num;
+    return true;
+}
+
+IrProtocol configImageParseProtocol(const char *type)
+{
+    if (NULL == type || !strcmp(type, "") || !strcmp(type, "nec"))
+        return IR_PROTOCOL_NEC;
+    if (!strcmp(type, "sony"))
+        return IR_PROTOCOL_SONY;
+    return IR_PROTOCOL_NONE;
+}
+
+// Turn a parsed code into what IRsend takes for the protocol
+bool configImageResolveCode(IrProtocol protocol, uint64_t num, uint64_t *value, uint8_t *bits)
+{
+    if (IR_PROTOCOL_SONY == protocol)
+    {
+        if (num > 0x7FFF)
+            return false;
+        *bits = num > 0xFFF ? 15 : 12;
+        *value = 0x4000 | num;
+        return true;
+    }
+    if (num > 0xFFFFFFFF)
+        return false;
+    *bits = 32;
+    *value = num;
+    return true;
+}
+
+// verify = false skips the CRC pass, only for an image already checked this power cycle
+bool ConfigImage::attach(const uint8_t *data, size_t len, bool verify)
+{
+    detach();
+    if (NULL == data || len < sizeof(ConfigImageHeader))
+        return false;
+    const ConfigImageHeader *h = (const ConfigImageHeader *)data;
+    if (h->magic != CONFIG_IMAGE_MAGIC || h->version != CONFIG_IMAGE_VERSION)
+        return false;
+    if (h->size < sizeof(ConfigImageHeader) || h->size > len || h->stringOffset >= h->size)
+        return false;
+    if (verify && crc32(data + sizeof(ConfigImageHeader), h->size - sizeof(ConfigImageHeader)) != h->crc)
+        return false;
+    if (data[h->size - 1] != 0)
+        return false;
+    this->data = data;
+    this->header = h;
+    return true;
+}
+
+void ConfigImage::detach()
+{
+    data = NULL;
+    header = NULL;
+}
+
+bool ConfigImage::isValid()
+{
+    return header != NULL;
+}
+
+const uint8_t *ConfigImage::getData()
+{
+    return data;
+}
+
+uint32_t ConfigImage::getSize()
+{
+    return header ? header->size : 0;
+}
+
+uint32_t ConfigImage::getStamp()
+{
+    return header ? header->stamp : 0;
+}
+
+const char *ConfigImage::getString(uint32_t offset)
+{
+    if (NULL == header || header->stringOffset + offset >= header->size)
+        return "";
+    return (const char *)data + header->stringOffset + offset;
+}
+
+const char *ConfigImage::getCode()
+{
+    return header ? getString(header->code) : "";
+}
+
+const char *ConfigImage::getName()
+{
+    return header ? getString(header->name) : "";
+}
+
+uint8_t ConfigImage::getWifiSize()
+{
+    return header ? header->wifiNum : 0;
+}
+
+const char *ConfigImage::getWifiSsid(uint8_t idx)
+{
+    return idx < getWifiSize() ? getString(header->wifiSsid[idx]) : "";
+}
+
+const char *ConfigImage::getWifiPasswd(uint8_t idx)
+{
+    return idx < getWifiSize() ? getString(header->wifiPasswd[idx]) : "";
+}
+
+int8_t ConfigImage::findWifi(const char *ssid)
+{
+    for (uint8_t i = 0; i < getWifiSize(); i++)
+    {
+        if (!strcmp(getWifiSsid(i), ssid))
+            return i;
+    }
+    return -1;
+}
+
+const char *ConfigImage::getMqttIp()
+{
+    return header ? getString(header->mqttIp) : "";
+}
+
+uint16_t ConfigImage::getMqttPort()
+{
+    return header ? header->mqttPort : 0;
+}
+
+uint16_t ConfigImage::getPowerTimeout(uint8_t stage)
+{
+    return header && stage < CONFIG_POWER_STAGES ? header->powerTimeouts[stage] : 0;
+}
+
+PowerProfile ConfigImage::getPowerProfile()
+{
+    return header ? (PowerProfile)header->powerProfile : POWER_PROFILE_REMOTE;
+}
+
+uint8_t ConfigImage::getBacklightLevel(uint8_t idx)
+{
+    const uint8_t levelDefaults[] = CONFIG_BACKLIGHT_DEFAULTS;
+    if (idx >= CONFIG_BACKLIGHT_LEVELS)
+        return 0;
+    return header ? header->backlightLevels[idx] : levelDefaults[idx];
+}
+
+uint16_t ConfigImage::getBacklightFadeIn()
+{
+    return header ? header->backlightFadeIn : CONFIG_BACKLIGHT_FADE_IN;
+}
+
+uint16_t ConfigImage::getBacklightFadeOut()
+{
+    return header ? header->backlightFadeOut : CONFIG_BACKLIGHT_FADE_OUT;
+}
+
+const char *ConfigImage::getMqttUser()
+{
+    return header ? getString(header->mqttUser) : "";
+}
+
+const char *ConfigImage::getMqttPasswd()
+{
+    return header ? getString(header->mqttPasswd) : "";
+}
+
+uint16_t ConfigImage::getSceneSize()
+{
+    return header ? header->sceneNum : 0;
+}
+
+const char *ConfigImage::getSceneCode(uint16_t idx)
+{
+    if (idx >= getSceneSize())
+        return "";
+    const ConfigImageScene *scenes = (const ConfigImageScene *)(data + header->sceneOffset);
+    return getString(scenes[idx].code);
+}
+
+const char *ConfigImage::getSceneName(uint16_t idx)
+{
+    if (idx >= getSceneSize())
+        return "";
+    const ConfigImageScene *scenes = (const ConfigImageScene *)(data + header->sceneOffset);
+    return getString(scenes[idx].name);
+}
+
+IrProtocol ConfigImage::getSceneProtocol(uint16_t idx)
+{
+    if (idx >= getSceneSize())
+        return IR_PROTOCOL_NONE;
+    const ConfigImageScene *scenes = (const ConfigImageScene *)(data + header->sceneOffset);
+    return (IrProtocol)scenes[idx].protocol;
+}
+
+uint16_t ConfigImage::getRemoteClientSize()
+{
+    return header ? header->remoteClientNum : 0;
+}
+
+const char *ConfigImage::getRemoteClientCode(uint16_t idx)
+{
+    if (idx >= getRemoteClientSize())
+        return "";
+    const ConfigImageRemoteClient *clients = (const ConfigImageRemoteClient *)(data + header->remoteClientOffset);
+    return getString(clients[idx].code);
+}
+
+const char *ConfigImage::getRemoteClientName(uint16_t idx)
+{
+    if (idx >= getRemoteClientSize())
+        return "";
+    const ConfigImageRemoteClient *clients = (const ConfigImageRemoteClient *)(data + header->remoteClientOffset);
+    return getString(clients[idx].name);
+}
+
+int16_t ConfigImage::getKeyIndex(const char *key)
+{
+    if (NULL == header || NULL == key)
+        return -1;
+    const uint32_t *keyNames = (const uint32_t *)(data + header->keyNameOffset);
+    for (uint16_t i = 0; i < header->keyNum; i++)
+    {
+        if (!strcmp(getString(keyNames[i]), key))
+            return i;
+    }
+    return -1;
+}
+
+const ConfigImageKey *ConfigImage::getKey(uint16_t scene, const char *key, bool longPress)
+{
+    if (scene >= getSceneSize())
+        return NULL;
+    int16_t keyIdx = getKeyIndex(key);
+    if (keyIdx < 0)
+        return NULL;
+    const ConfigImageKey *keys = (const ConfigImageKey *)(data + header->keyOffset);
+    const ConfigImageKey *k = &keys[((uint32_t)scene * header->keyNum + keyIdx) * 2 + (longPress ? 1 : 0)];
+    if (IR_PROTOCOL_NONE == k->protocol)
+        return NULL;
+    return k;
+}
+
+bool ConfigImageBuilder::begin(const char *keys[], uint8_t keysNum, uint16_t sceneNum, uint16_t remoteClientNum)
+{
+    end();
+    size_t keyNameOffset = sizeof(ConfigImageHeader);
+    size_t sceneOffset = keyNameOffset + CONFIG_IMAGE_ALIGN(sizeof(uint32_t) * keysNum);
+    size_t keyOffset = sceneOffset + sizeof(ConfigImageScene) * sceneNum;
+    size_t remoteClientOffset = keyOffset + sizeof(ConfigImageKey) * sceneNum * keysNum * 2;
+    size_t stringOffset = remoteClientOffset + sizeof(ConfigImageRemoteClient) * remoteClientNum;
+
+    if (!reserve(stringOffset + 256))
+        return false;
+    memset(buf, 0, stringOffset + 1);
+    len = stringOffset + 1; // string pool offset 0 is ""
+
+    ConfigImageHeader *h = header();
+    h->magic = CONFIG_IMAGE_MAGIC;
+    h->version = CONFIG_IMAGE_VERSION;
+    h->keyNum = keysNum;
+    h->sceneNum = sceneNum;
+    h->remoteClientNum = remoteClientNum;
+    h->keyNameOffset = keyNameOffset;
+    h->sceneOffset = sceneOffset;
+    h->keyOffset = keyOffset;
+    h->remoteClientOffset = remoteClientOffset;
+    h->stringOffset = stringOffset;
+
+    this->keys = keys;
+    this->keysNum = keysNum;
+    for (uint8_t i = 0; i < keysNum; i++)
+    {
+        uint32_t name = intern(keys[i]);
+        ((uint32_t *)(buf + keyNameOffset))[i] = name;
+    }
+    return true;
+}
+
+void ConfigImageBuilder::setReport(ConfigImageReport report)
+{
+    reportCallback = report;
+}
+
+bool ConfigImageBuilder::setRoot(JsonObjectConst root)
+{
+    if (NULL == buf)
+        return false;
+    uint16_t errors = errorNum;
+    if (root.isNull())
+    {
+        report(true, "$", "config must be an object");
+        return false;
+    }
+    const char *code = root["code"];
+    if (NULL == code || 0 == strlen(code))
+        report(true, "$.code", "device code is required");
+    uint32_t s = intern(code);
+    header()->code = s;
+    s = intern(root["name"]);
+    header()->name = s;
+
+    // "wifi" is a single network or a list of them, in no particular order:
+    // the device ranks whatever it can hear when it joins
+    JsonVariantConst wifi = root["network-settings"]["wifi"];
+    header()->wifiNum = 0;
+    if (wifi.is<JsonArrayConst>())
+    {
+        JsonArrayConst wifis = wifi.as<JsonArrayConst>();
+        if (wifis.size() > CONFIG_WIFI_MAX)
+            report(false, "$.network-settings.wifi", "too many networks, the rest are ignored");
+        for (uint8_t i = 0; i < CONFIG_WIFI_MAX && i < wifis.size(); i++)
+        {
+            char path[CONFIG_IMAGE_PATH_LEN];
+            snprintf(path, sizeof(path), "$.network-settings.wifi[%d].ssid", i);
+            addWifi(wifis[i], path);
+        }
+    }
+    else if (!wifi.isNull())
+    {
+        addWifi(wifi, "$.network-settings.wifi.ssid");
+    }
+
+    JsonObjectConst mqtt = root["network-settings"]["mqtt"];
+    s = intern(mqtt["ip"]);
+    header()->mqttIp = s;
+    s = intern(mqtt["username"]);
+    header()->mqttUser = s;
+    s = intern(mqtt["passwd"]);
+    header()->mqttPasswd = s;
+    int port = mqtt["port"].is<const char *>() ? atoi(mqtt["port"].as<const char *>()) : mqtt["port"].as<int>();
+    if (!mqtt.isNull() && (port <= 0 || port > 65535))
+        report(true, "$.network-settings.mqtt.port", "port must be 1-65535");
+    header()->mqttPort = (uint16_t)port;
+
+    const char *powerNames[] = CONFIG_POWER_NAMES;
+    const uint16_t powerDefaults[] = CONFIG_POWER_DEFAULTS;
+    JsonObjectConst power = root["power-settings"];
+    const char *profile = power["profile"] | "remote";
+    header()->powerProfile = POWER_PROFILE_REMOTE;
+    if (!strcmp(profile, "receiver"))
+        header()->powerProfile = POWER_PROFILE_RECEIVER;
+    else if (strcmp(profile, "remote"))
+        report(false, "$.power-settings.profile", "unknown profile, used as remote");
+    uint16_t lastTimeout = 0;
+    for (uint8_t i = 0; i < CONFIG_POWER_STAGES; i++)
+    {
+        char path[48];
+        snprintf(path, sizeof(path), "$.power-settings.%s", powerNames[i]);
+        JsonVariantConst value = power[powerNames[i]];
+        uint16_t timeout = powerDefaults[i];
+        if (!value.isNull())
+        {
+            if (!value.is<unsigned int>() || value.as<unsigned int>() > 65535)
+                report(true, path, "must be 0-65535 seconds");
+            else
+                timeout = value.as<uint16_t>();
+        }
+        if (timeout > 0 && timeout <= lastTimeout)
+            report(false, path, "not after the previous stage, it is never reached");
+        if (timeout > 0)
+            lastTimeout = timeout;
+        header()->powerTimeouts[i] = timeout;
+    }
+
+    const char *backlightNames[] = CONFIG_BACKLIGHT_NAMES;
+    const uint8_t backlightDefaults[] = CONFIG_BACKLIGHT_DEFAULTS;
+    JsonObjectConst backlight = root["backlight-settings"];
+    for (uint8_t i = 0; i < CONFIG_BACKLIGHT_LEVELS; i++)
+    {
+        char path[48];
+        snprintf(path, sizeof(path), "$.backlight-settings.%s", backlightNames[i]);
+        JsonVariantConst value = backlight[backlightNames[i]];
+        uint8_t level = backlightDefaults[i];
+        if (!value.isNull())
+        {
+            if (!value.is<unsigned int>() || value.as<unsigned int>() > 100)
+                report(true, path, "must be 0-100 percent");
+            else
+                level = value.as<uint8_t>();
+        }
+        header()->backlightLevels[i] = level;
+    }
+    const char *fadeNames[] = {"fade-in", "fade-out"};
+    const uint16_t fadeDefaults[] = {CONFIG_BACKLIGHT_FADE_IN, CONFIG_BACKLIGHT_FADE_OUT};
+    uint16_t fades[2];
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        char path[48];
+        snprintf(path, sizeof(path), "$.backlight-settings.%s", fadeNames[i]);
+        JsonVariantConst value = backlight[fadeNames[i]];
+        fades[i] = fadeDefaults[i];
+        if (!value.isNull())
+        {
+            if (!value.is<unsigned int>() || value.as<unsigned int>() > 10000)
+                report(true, path, "must be 0-10000 ms");
+            else
+                fades[i] = value.as<uint16_t>();
+        }
+    }
+    header()->backlightFadeIn = fades[0];
+    header()->backlightFadeOut = fades[1];
+
+    JsonArrayConst clients = root["remote-clients"];
+    if (clients.size() != header()->remoteClientNum)
+        report(true, "$.remote-clients", "size does not match the image layout");
+    for (uint16_t i = 0; i < header()->remoteClientNum && i < clients.size(); i++)
+    {
+        char path[CONFIG_IMAGE_PATH_LEN];
+        snprintf(path, sizeof(path), "$.remote-clients[%d].code", i);
+        const char *clientCode = clients[i]["code"];
+        if (NULL == clientCode || 0 == strlen(clientCode))
+            report(true, path, "remote client code is required");
+        s = intern(clientCode);
+        remoteClient(i)->code = s;
+        s = intern(clients[i]["name"]);
+        remoteClient(i)->name = s;
+    }
+    return errors == errorNum;
+}
+
+void ConfigImageBuilder::addWifi(JsonObjectConst wifi, const char *path)
+{
+    const char *ssid = wifi["ssid"];
+    if (NULL == ssid || 0 == strlen(ssid) || strlen(ssid) > 32)
+    {
+        report(true, path, "ssid must be 1-32 characters");
+        return;
+    }
+    uint8_t idx = header()->wifiNum;
+    uint32_t s = intern(ssid);
+    header()->wifiSsid[idx] = s;
+    s = intern(wifi["passwd"]);
+    header()->wifiPasswd[idx] = s;
+    header()->wifiNum = idx + 1;
+}
+
+bool ConfigImageBuilder::addScene(JsonObjectConst sceneObj)
+{
+    if (NULL == buf)
+        return false;
+    uint16_t errors = errorNum;
+    char path[CONFIG_IMAGE_PATH_LEN];
+    uint16_t idx = sceneCount;
+    snprintf(path, sizeof(path), "$.scenes[%d]", idx);
+    if (idx >= header()->sceneNum)
+    {
+        report(true, path, "more scenes than the image layout");
+        return false;
+    }
+    sceneCount++;
+    if (sceneObj.isNull())
+    {
+        report(true, path, "scene must be an object");
+        return false;
+    }
+
+    const char *sceneCode = sceneObj["code"];
+    if (NULL == sceneCode || 0 == strlen(sceneCode))
+        report(true, path, "scene code is required");
+    uint32_t s = intern(sceneCode);
+    scene(idx)->code = s;
+    s = intern(sceneObj["name"]);
+    scene(idx)->name = s;
+    const char *type = sceneObj["type"];
+    IrProtocol protocol = configImageParseProtocol(type);
+    scene(idx)->protocol = protocol;
+    if (IR_PROTOCOL_NONE == protocol)
+    {
+        // codes can not be resolved without a protocol, none are checked
+        char msg[CONFIG_IMAGE_MSG_LEN];
+        snprintf(msg, sizeof(msg), "unknown IR type [%s]", type);
+        report(true, path, msg);
+        return false;
+    }
+
+    char mapPath[CONFIG_IMAGE_PATH_LEN];
+    snprintf(mapPath, sizeof(mapPath), "%s.key-map", path);
+    addKeyMap(idx, sceneObj["key-map"], false, protocol, mapPath);
+    snprintf(mapPath, sizeof(mapPath), "%s.key-map-long", path);
+    addKeyMap(idx, sceneObj["key-map-long"], true, protocol, mapPath);
+    return errors == errorNum;
+}
+
+bool ConfigImageBuilder::addKeyMap(uint16_t sceneIdx, JsonObjectConst keyMap, bool longPress, IrProtocol protocol, const char *path)
+{
+    uint16_t errors = errorNum;
+    char keyPath[CONFIG_IMAGE_PATH_LEN];
+    for (JsonPairConst kv : keyMap)
+    {
+        const char *keyName = kv.key().c_str();
+        snprintf(keyPath, sizeof(keyPath), "%s.%s", path, keyName);
+        int16_t keyIdx = -1;
+        for (uint8_t i = 0; i < keysNum; i++)
+        {
+            if (!strcmp(keys[i], keyName))
+            {
+                keyIdx = i;
+                break;
+            }
+        }
+        if (keyIdx < 0)
+        {
+            report(false, keyPath, "no such key on the device, ignored");
+            continue;
+        }
+        if (!kv.value().is<const char *>())
+        {
+            report(true, keyPath, "code must be a hex string");
+            continue;
+        }
+        const char *text = kv.value().as<const char *>();
+        if (0 == strlen(text) || !strcmp(text, "null"))
+            continue;
+        uint64_t num = 0;
+        if (!configImageParseCode(text, &num))
+        {
+            report(true, keyPath, "code is not a valid hex number");
+            continue;
+        }
+
+        uint64_t value = 0;
+        uint8_t bits = 0;
+        if (!configImageResolveCode(protocol, num, &value, &bits))
+        {
+            report(true, keyPath, IR_PROTOCOL_SONY == protocol ? "sony code exceeds 15 bits" : "nec code exceeds 32 bits");
+            continue;
+        }
+
+        uint32_t s = intern(text);
+        ConfigImageKey *k = key(sceneIdx, keyIdx, longPress);
+        if (IR_PROTOCOL_NONE == k->protocol)
+            scene(sceneIdx)->keyCount++;
+        k->value = value;
+        k->text = s;
+        k->protocol = protocol;
+        k->bits = bits;
+    }
+    return errors == errorNum;
+}
+
+// Errors drop the offending entries but still produce an image, it is up to
+// the caller to reject it through getErrorNum().
+const uint8_t *ConfigImageBuilder::finish(uint32_t stamp, size_t *size)
+{
+    if (NULL == buf)
+        return NULL;
+    if (sceneCount != header()->sceneNum)
+    {
+        report(true, "$.scenes", "fewer scenes than the image layout");
+        return NULL;
+    }
+    size_t total = CONFIG_IMAGE_ALIGN(len);
+    if (!reserve(total))
+        return NULL;
+    memset(buf + len, 0, total - len);
+    len = total;
+
+    ConfigImageHeader *h = header();
+    h->size = len;
+    h->stamp = stamp;
+    h->crc = crc32(buf + sizeof(ConfigImageHeader), len - sizeof(ConfigImageHeader));
+    *size = len;
+    return buf;
+}
+
+uint8_t *ConfigImageBuilder::release()
+{
+    uint8_t *data = buf;
+    buf = NULL;
+    end();
+    return data;
+}
+
+void ConfigImageBuilder::end()
+{
+    if (buf != NULL)
+        free(buf);
+    buf = NULL;
+    len = 0;
+    cap = 0;
+    keys = NULL;
+    keysNum = 0;
+    sceneCount = 0;
+    errorNum = 0;
+    warningNum = 0;
+}
+
+uint16_t ConfigImageBuilder::getErrorNum()
+{
+    return errorNum;
+}
+
+uint16_t ConfigImageBuilder::getWarningNum()
+{
+    return warningNum;
+}
+
+uint32_t ConfigImageBuilder::intern(const char *str)
+{
+    if (NULL == str || 0 == str[0])
+        return 0;
+    size_t stringOffset = header()->stringOffset;
+    size_t strLen = strlen(str);
+    size_t pos = stringOffset + 1;
+    while (pos < len)
+    {
+        const char *s = (const char *)buf + pos;
+        size_t sLen = strlen(s);
+        if (sLen == strLen && !memcmp(s, str, strLen))
+            return pos - stringOffset;
+        pos += sLen + 1;
+    }
+    if (!reserve(len + strLen + 1))
+        return 0;
+    memcpy(buf + len, str, strLen + 1);
+    len += strLen + 1;
+    return pos - stringOffset;
+}
+
+bool ConfigImageBuilder::reserve(size_t size)
+{
+    if (size <= cap)
+        return true;
+    size_t newCap = cap > 0 ? cap : 256;
+    while (newCap < size)
+        newCap *= 2;
+    uint8_t *newBuf = (uint8_t *)realloc(buf, newCap);
+    if (NULL == newBuf)
+    {
+        report(true, "$", "out of memory");
+        return false;
+    }
+    buf = newBuf;
+    cap = newCap;
+    return true;
+}
+
+void ConfigImageBuilder::report(bool error, const char *path, const char *msg)
+{
+    if (error)
+        errorNum++;
+    else
+        warningNum++;
+    if (reportCallback != NULL)
+        reportCallback(error, path, msg);
+}
+
+ConfigImageHeader *ConfigImageBuilder::header()
+{
+    return (ConfigImageHeader *)buf;
+}
+
+ConfigImageScene *ConfigImageBuilder::scene(uint16_t idx)
+{
+    return (ConfigImageScene *)(buf + header()->sceneOffset) + idx;
+}
+
+ConfigImageKey *ConfigImageBuilder::key(uint16_t sceneIdx, uint8_t keyIdx, bool longPress)
+{
+    ConfigImageKey *keys = (ConfigImageKey *)(buf + header()->keyOffset);
+    return &keys[((uint32_t)sceneIdx * keysNum + keyIdx) * 2 + (longPress ? 1 : 0)];
+}
+
+ConfigImageRemoteClient *ConfigImageBuilder::remoteClient(uint16_t idx)
+{
+    return (ConfigImageRemoteClient *)(buf + header()->remoteClientOffset) + idx;
+}
@@ -0,0 +1,180 @@
+#ifndef _CONFIG_IMAGE_H_
+#define _CONFIG_IMAGE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+
+// Compiled config image: the parsed form of config.json laid out in fixed
+// offset tables so it can be used straight from a memory mapped partition.
+//
+// [header][key names][scenes][keys][remote clients][string pool]
+//
+// Every string is an offset into the (interned) string pool, offset 0 is "".
+// Each scene owns keyNum * 2 key slots: short press at even, long at odd.
+
+#define CONFIG_IMAGE_MAGIC 0x47464352 // "RCFG"
+#define CONFIG_IMAGE_VERSION 4
+#define CONFIG_IMAGE_CODE_MAX_DIGITS 16
+#define CONFIG_WIFI_MAX 4
+#define CONFIG_POWER_STAGES 4
+#define CONFIG_POWER_NAMES {"dim", "screen-off", "light-sleep", "deep-sleep"}
+#define CONFIG_POWER_DEFAULTS {30, 60, 120, 300} // uint: second
+#define CONFIG_BACKLIGHT_LEVELS 6 // one per running mode from standby on, then dim
+#define CONFIG_BACKLIGHT_NAMES {"standby", "learning", "remote", "tip", "setting", "dim"}
+#define CONFIG_BACKLIGHT_DEFAULTS {100, 100, 100, 100, 100, 25} // uint: percent of the device backlight
+#define CONFIG_BACKLIGHT_DIM (CONFIG_BACKLIGHT_LEVELS - 1)
+#define CONFIG_BACKLIGHT_FADE_IN 200  // uint: ms
+#define CONFIG_BACKLIGHT_FADE_OUT 600 // uint: ms
+
+typedef enum
+{
+    IR_PROTOCOL_NONE = 0,
+    IR_PROTOCOL_NEC,
+    IR_PROTOCOL_SONY
+} IrProtocol;
+
+typedef enum
+{
+    POWER_PROFILE_REMOTE = 0, // handheld, sleeps down the whole ladder
+    POWER_PROFILE_RECEIVER    // unattended, never sleeps, stays on MQTT
+} PowerProfile;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t keyNum;
+    uint32_t size;  // whole image, header included
+    uint32_t crc;   // over everything after the header
+    uint32_t stamp; // crc of the source config.json
+    uint16_t sceneNum;
+    uint16_t remoteClientNum;
+    uint32_t keyNameOffset;
+    uint32_t sceneOffset;
+    uint32_t keyOffset;
+    uint32_t remoteClientOffset;
+    uint32_t stringOffset;
+    uint32_t code;
+    uint32_t name;
+    uint32_t wifiSsid[CONFIG_WIFI_MAX];
+    uint32_t wifiPasswd[CONFIG_WIFI_MAX];
+    uint32_t mqttIp;
+    uint32_t mqttUser;
+    uint32_t mqttPasswd;
+    uint16_t mqttPort;
+    uint16_t powerProfile;
+    uint16_t wifiNum;
+    uint16_t reserved2;
+    uint16_t powerTimeouts[CONFIG_POWER_STAGES]; // idle seconds before each stage, 0 = skipped
+    uint8_t backlightLevels[CONFIG_BACKLIGHT_LEVELS]; // uint: percent
+    uint16_t backlightFadeIn;  // uint: ms
+    uint16_t backlightFadeOut; // uint: ms
+} ConfigImageHeader;
+
+typedef struct
+{
+    uint32_t code;
+    uint32_t name;
+    uint16_t protocol;
+    uint16_t keyCount;
+    uint32_t reserved;
+} ConfigImageScene;
+
+typedef struct
+{
+    uint64_t value; // ready to send, protocol specific bits already applied
+    uint32_t text;  // code as written in config.json
+    uint8_t protocol;
+    uint8_t bits;
+    uint16_t reserved;
+} ConfigImageKey;
+
+typedef struct
+{
+    uint32_t code;
+    uint32_t name;
+} ConfigImageRemoteClient;
+
+typedef void (*ConfigImageReport)(bool error, const char *path, const char *msg);
+
+bool configImageParseCode(const char *text, uint64_t *value);
+IrProtocol configImageParseProtocol(const char *type);
+bool configImageResolveCode(IrProtocol protocol, uint64_t num, uint64_t *value, uint8_t *bits);
+
+class ConfigImage
+{
+public:
+    bool attach(const uint8_t *data, size_t len, bool verify = true);
+    void detach();
+    bool isValid();
+    const uint8_t *getData();
+    uint32_t getSize();
+    uint32_t getStamp();
+    const char *getCode();
+    const char *getName();
+    uint8_t getWifiSize();
+    const char *getWifiSsid(uint8_t idx);
+    const char *getWifiPasswd(uint8_t idx);
+    int8_t findWifi(const char *ssid);
+    const char *getMqttIp();
+    uint16_t getMqttPort();
+    const char *getMqttUser();
+    const char *getMqttPasswd();
+    uint16_t getPowerTimeout(uint8_t stage);
+    PowerProfile getPowerProfile();
+    uint8_t getBacklightLevel(uint8_t idx);
+    uint16_t getBacklightFadeIn();
+    uint16_t getBacklightFadeOut();
+    uint16_t getSceneSize();
+    const char *getSceneCode(uint16_t idx);
+    const char *getSceneName(uint16_t idx);
+    IrProtocol getSceneProtocol(uint16_t idx);
+    uint16_t getRemoteClientSize();
+    const char *getRemoteClientCode(uint16_t idx);
+    const char *getRemoteClientName(uint16_t idx);
+    int16_t getKeyIndex(const char *key);
+    const ConfigImageKey *getKey(uint16_t scene, const char *key, bool longPress);
+    const char *getString(uint32_t offset);
+
+private:
+    const uint8_t *data = NULL;
+    const ConfigImageHeader *header = NULL;
+};
+
+class ConfigImageBuilder
+{
+public:
+    bool begin(const char *keys[], uint8_t keysNum, uint16_t sceneNum, uint16_t remoteClientNum);
+    void setReport(ConfigImageReport report);
+    bool setRoot(JsonObjectConst root);
+    bool addScene(JsonObjectConst scene);
+    const uint8_t *finish(uint32_t stamp, size_t *size);
+    uint8_t *release();
+    void end();
+    uint16_t getErrorNum();
+    uint16_t getWarningNum();
+
+private:
+    uint32_t intern(const char *str);
+    bool reserve(size_t len);
+    void report(bool error, const char *path, const char *msg);
+    void addWifi(JsonObjectConst wifi, const char *path);
+    bool addKeyMap(uint16_t sceneIdx, JsonObjectConst keyMap, bool longPress, IrProtocol protocol, const char *path);
+    ConfigImageHeader *header();
+    ConfigImageScene *scene(uint16_t idx);
+    ConfigImageKey *key(uint16_t sceneIdx, uint8_t keyIdx, bool longPress);
+    ConfigImageRemoteClient *remoteClient(uint16_t idx);
+
+    uint8_t *buf = NULL;
+    size_t len = 0;
+    size_t cap = 0;
+    const char **keys = NULL;
+    uint8_t keysNum = 0;
+    uint16_t sceneCount = 0;
+    uint16_t errorNum = 0;
+    uint16_t warningNum = 0;
+    ConfigImageReport reportCallback = NULL;
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include <Arduino.h>
+#include "ConfigJournal.h"
+#include "ConfigImage.h"
+#include "Crc32.h"
+
+#define CONFIG_JOURNAL_PAYLOAD_LEN (1 + CONFIG_SCENE_CODE_LEN + CONFIG_JOURNAL_KEY_LEN + CONFIG_JOURNAL_VALUE_LEN)
+
+const char *configJournalFile = "/journal.bin";
+const char *configJournalNewFile = "/journal.new"; // rewrite() target before the rename
+
+void ConfigJournal::init(fs::FS *fs)
+{
+    this->fs = fs;
+}
+
+uint8_t ConfigJournal::load()
+{
+    recordNum = 0;
+    if (!fs->exists(configJournalFile) && fs->exists(configJournalNewFile))
+    {
+        // power lost between removing the old journal and renaming the new one in
+        Serial.println("Recover the journal");
+        fs->rename(configJournalNewFile, configJournalFile);
+    }
+    File file = fs->open(configJournalFile, FILE_READ);
+    if (!file)
+        return 0;
+    ConfigJournalHeader header;
+    uint8_t payload[CONFIG_JOURNAL_PAYLOAD_LEN];
+    bool damaged = false;
+    while (recordNum < CONFIG_JOURNAL_MAX)
+    {
+        size_t len = file.read((uint8_t *)&header, sizeof(header));
+        if (0 == len)
+            break;
+        if (len != sizeof(header) || header.magic != CONFIG_JOURNAL_MAGIC || header.len > sizeof(payload))
+        {
+            Serial.println("Journal record corrupt, drop the tail");
+            damaged = true;
+            break;
+        }
+        if (file.read(payload, header.len) != header.len || crc32(payload, header.len) != header.crc)
+        {
+            Serial.println("Journal record torn, drop the tail");
+            damaged = true;
+            break;
+        }
+        if (parseRecord(payload, header.len, &records[recordNum]))
+            recordNum++;
+    }
+    file.close();
+    // new records must not land behind the damaged tail
+    if (damaged)
+        rewrite();
+    return recordNum;
+}
+
+bool ConfigJournal::append(const char *scene, const char *key, const char *value, bool longPress)
+{
+    if (recordNum >= CONFIG_JOURNAL_MAX)
+        return false;
+    if (strlen(scene) >= CONFIG_SCENE_CODE_LEN || strlen(key) >= CONFIG_JOURNAL_KEY_LEN || strlen(value) >= CONFIG_JOURNAL_VALUE_LEN)
+        return false;
+
+    ConfigJournalRecord *record = &records[recordNum];
+    strcpy(record->scene, scene);
+    strcpy(record->key, key);
+    strcpy(record->value, value);
+    record->longPress = longPress;
+    if (!configImageParseCode(value, &record->code))
+        return false;
+
+    File file = fs->open(configJournalFile, FILE_APPEND);
+    if (!file)
+        return false;
+    bool success = writeRecord(file, record);
+    file.close();
+    if (success)
+        recordNum++;
+    return success;
+}
+
+const ConfigJournalRecord *ConfigJournal::find(const char *scene, const char *key, bool longPress)
+{
+    // last write wins
+    for (int16_t i = recordNum - 1; i >= 0; i--)
+    {
+        ConfigJournalRecord *record = &records[i];
+        if (record->longPress == longPress && !strcmp(record->key, key) && !strcmp(record->scene, scene))
+            return record;
+    }
+    return NULL;
+}
+
+uint8_t ConfigJournal::getRecordNum()
+{
+    return recordNum;
+}
+
+const ConfigJournalRecord *ConfigJournal::getRecord(uint8_t idx)
+{
+    return idx < recordNum ? &records[idx] : NULL;
+}
+
+void ConfigJournal::clear()
+{
+    fs->remove(configJournalFile);
+    fs->remove(configJournalNewFile);
+    recordNum = 0;
+}
+
+bool ConfigJournal::writeRecord(File &file, const ConfigJournalRecord *record)
+{
+    // payload: [longPress][scene\0][key\0][value\0]
+    uint8_t payload[CONFIG_JOURNAL_PAYLOAD_LEN];
+    uint16_t len = 0;
+    payload[len++] = record->longPress ? 1 : 0;
+    const char *fields[] = {record->scene, record->key, record->value};
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        size_t fieldLen = strlen(fields[i]) + 1;
+        memcpy(payload + len, fields[i], fieldLen);
+        len += fieldLen;
+    }
+    ConfigJournalHeader header = {CONFIG_JOURNAL_MAGIC, len, crc32(payload, len)};
+    return file.write((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+           file.write(payload, len) == len;
+}
+
+// The survivors go to a new file renamed over the journal, as ConfigStore
+// commits its files: a power loss midway leaves one of the two complete
+void ConfigJournal::rewrite()
+{
+    File file = fs->open(configJournalNewFile, FILE_WRITE);
+    if (!file)
+        return;
+    bool success = true;
+    for (uint8_t i = 0; i < recordNum && success; i++)
+    {
+        success = writeRecord(file, &records[i]);
+    }
+    file.close();
+    if (!success)
+    {
+        fs->remove(configJournalNewFile);
+        return;
+    }
+    if (fs->rename(configJournalNewFile, configJournalFile))
+        return;
+    // not every filesystem renames over an existing file (SPIFFS does not)
+    fs->remove(configJournalFile);
+    fs->rename(configJournalNewFile, configJournalFile);
+}
+
+bool ConfigJournal::parseRecord(const uint8_t *payload, uint16_t len, ConfigJournalRecord *record)
+{
+    if (len < 4 || payload[len - 1] != 0)
+        return false;
+    record->longPress = payload[0] != 0;
+    const char *p = (const char *)payload + 1;
+    const char *end = (const char *)payload + len;
+    char *fields[] = {record->scene, record->key, record->value};
+    size_t fieldLens[] = {sizeof(record->scene), sizeof(record->key), sizeof(record->value)};
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        if (p >= end)
+            return false;
+        size_t fieldLen = strlen(p);
+        if (fieldLen >= fieldLens[i])
+            return false;
+        memcpy(fields[i], p, fieldLen + 1);
+        p += fieldLen + 1;
+    }
+    return configImageParseCode(record->value, &record->code);
+}
@@ -0,0 +1,53 @@
+#ifndef _CONFIG_JOURNAL_H_
+#define _CONFIG_JOURNAL_H_
+
+#include <FS.h>
+#include "ConfigLimits.h"
+
+#define CONFIG_JOURNAL_MAGIC 0x4A52 // "RJ"
+#define CONFIG_JOURNAL_MAX 32
+#define CONFIG_JOURNAL_KEY_LEN 16
+#define CONFIG_JOURNAL_VALUE_LEN 20
+
+typedef struct
+{
+    uint16_t magic;
+    uint16_t len; // payload bytes
+    uint32_t crc; // over the payload
+} ConfigJournalHeader;
+
+typedef struct
+{
+    char scene[CONFIG_SCENE_CODE_LEN];
+    char key[CONFIG_JOURNAL_KEY_LEN];
+    char value[CONFIG_JOURNAL_VALUE_LEN];
+    bool longPress;
+    uint64_t code; // value parsed once on append/replay
+} ConfigJournalRecord;
+
+// Append-only log of key-map changes not yet compacted into the scene files.
+// Each record carries its own CRC, so a record torn by power loss is dropped
+// on replay together with everything after it. Records are idempotent
+// (last write wins), replaying them again after a crashed compaction is safe.
+class ConfigJournal
+{
+public:
+    void init(fs::FS *fs);
+    uint8_t load();
+    bool append(const char *scene, const char *key, const char *value, bool longPress);
+    const ConfigJournalRecord *find(const char *scene, const char *key, bool longPress);
+    uint8_t getRecordNum();
+    const ConfigJournalRecord *getRecord(uint8_t idx);
+    void clear();
+
+private:
+    bool writeRecord(File &file, const ConfigJournalRecord *record);
+    void rewrite();
+    bool parseRecord(const uint8_t *payload, uint16_t len, ConfigJournalRecord *record);
+
+    fs::FS *fs = NULL;
+    ConfigJournalRecord records[CONFIG_JOURNAL_MAX];
+    uint8_t recordNum = 0;
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef _CONFIG_LIMITS_H_
+#define _CONFIG_LIMITS_H_
+
+// RAM budget of the paged config, shared with tools/config-compiler
+#define CONFIG_SCENE_MAX 64
+#define CONFIG_SCENE_CODE_LEN 17 // scene files are /scenes/<code>.json, keep the name short
+#define CONFIG_SCENE_NAME_LEN 25
+#define CONFIG_ROOT_JSON_SIZE 1536
+#define CONFIG_SCENE_JSON_SIZE 2048
+
+#endif
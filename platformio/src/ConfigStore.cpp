@@ -0,0 +1,428 @@
+#include <Arduino.h>
+#include "ConfigStore.h"
+
+const char *configRootFile = "/root.json";
+const char *configSceneIndexFile = "/scenes/index";
+const char *configStampFile = "/scenes/stamp";
+
+class CountPrint : public Print
+{
+public:
+    size_t write(uint8_t c)
+    {
+        count++;
+        return 1;
+    }
+    size_t write(const uint8_t *buffer, size_t size)
+    {
+        count += size;
+        return size;
+    }
+    size_t count = 0;
+};
+
+void ConfigStore::init(fs::FS *fs)
+{
+    this->fs = fs;
+}
+
+bool ConfigStore::importConfig(const char *path, uint32_t stamp)
+{
+    Serial.printf("import config [%s]...\r\n", path);
+    File file = fs->open(path, FILE_READ);
+    if (!file)
+    {
+        Serial.println("Failed to open config file");
+        return false;
+    }
+
+    // root settings only, scenes are streamed one by one below
+    StaticJsonDocument<128> filter;
+    filter["code"] = true;
+    filter["name"] = true;
+    filter["network-settings"] = true;
+    filter["remote-clients"] = true;
+    filter["power-settings"] = true;
+    filter["backlight-settings"] = true;
+    rootDoc.clear();
+    DeserializationError error = deserializeJson(rootDoc, file, DeserializationOption::Filter(filter));
+    if (error)
+    {
+        Serial.printf("Failed to read config root: %s\r\n", error.c_str());
+        file.close();
+        return false;
+    }
+
+    loaded = false;
+    sceneSize = 0;
+    // a store cut short by a failed import never matches config.json
+    fs->remove(configStampFile);
+    fs->remove(tempPath(configStampFile));
+    fs->mkdir("/scenes");
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        sceneSlots[i] = -1;
+    }
+    prefetchIdx = -1;
+    JsonDocument &sceneDoc = sceneDocs[0];
+    bool complete = true;
+    file.seek(0);
+    if (file.find("\"scenes\"") && file.find("["))
+    {
+        do
+        {
+            error = deserializeJson(sceneDoc, file);
+            if (error)
+            {
+                Serial.printf("Failed to read scene[%d]: %s\r\n", sceneSize, error.c_str());
+                complete = false;
+                break;
+            }
+            if (sceneSize >= CONFIG_SCENE_MAX)
+            {
+                Serial.printf("More than %d scenes, the rest are ignored\r\n", CONFIG_SCENE_MAX);
+                complete = false;
+                break;
+            }
+            const char *code = sceneDoc["code"] | "";
+            if (0 == strlen(code) || strlen(code) >= CONFIG_SCENE_CODE_LEN)
+            {
+                Serial.printf("Invalid scene code [%s], ignored\r\n", code);
+                continue;
+            }
+            ConfigSceneEntry *entry = &scenes[sceneSize];
+            strlcpy(entry->code, code, sizeof(entry->code));
+            strlcpy(entry->name, sceneDoc["name"] | "", sizeof(entry->name));
+            if (!writeScene(sceneDoc, code))
+            {
+                complete = false;
+                break;
+            }
+            sceneSize++;
+        } while (file.findUntil(",", "]"));
+    }
+    file.close();
+    sceneDoc.clear();
+
+    // the scenes read so far serve meanwhile, only a complete import is
+    // stamped, so the next boot imports config.json again
+    loaded = storageRoot() && storageIndex();
+    Serial.printf("import config: %d scenes%s\r\n", sceneSize, complete ? "" : ", incomplete");
+    return loaded && complete && storageStamp(stamp);
+}
+
+bool ConfigStore::load()
+{
+    File file = openFile(configRootFile);
+    if (!file)
+        return false;
+    rootDoc.clear();
+    DeserializationError error = deserializeJson(rootDoc, file);
+    file.close();
+    if (error)
+    {
+        Serial.printf("Failed to read config root: %s\r\n", error.c_str());
+        return false;
+    }
+    if (!loadIndex())
+        return false;
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        sceneSlots[i] = -1;
+    }
+    prefetchIdx = -1;
+    loaded = true;
+    return true;
+}
+
+bool ConfigStore::isLoaded()
+{
+    return loaded;
+}
+
+JsonObject ConfigStore::getRoot()
+{
+    return rootDoc.as<JsonObject>();
+}
+
+uint16_t ConfigStore::getSceneSize()
+{
+    return sceneSize;
+}
+
+const char *ConfigStore::getSceneCode(uint16_t idx)
+{
+    return idx < sceneSize ? scenes[idx].code : "";
+}
+
+const char *ConfigStore::getSceneName(uint16_t idx)
+{
+    return idx < sceneSize ? scenes[idx].name : "";
+}
+
+JsonObject ConfigStore::getScene(uint16_t idx)
+{
+    if (idx >= sceneSize)
+        return JsonObject();
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        if (sceneSlots[i] == idx)
+        {
+            activeSlot = i;
+            return sceneDocs[i].as<JsonObject>();
+        }
+    }
+    // replace the active scene, keep the prefetched one
+    if (loadScene(idx, activeSlot) < 0)
+        return JsonObject();
+    return sceneDocs[activeSlot].as<JsonObject>();
+}
+
+JsonObjectConst ConfigStore::readScene(uint16_t idx)
+{
+    if (idx >= sceneSize)
+        return JsonObjectConst();
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        if (sceneSlots[i] == idx)
+            return sceneDocs[i].as<JsonObjectConst>();
+    }
+    // one-off reads go through the prefetch slot, the active scene stays
+    uint8_t slot = (activeSlot + 1) % CONFIG_SCENE_SLOTS;
+    if (loadScene(idx, slot) < 0)
+        return JsonObjectConst();
+    return sceneDocs[slot].as<JsonObjectConst>();
+}
+
+int16_t ConfigStore::findScene(const char *code)
+{
+    for (uint16_t i = 0; i < sceneSize; i++)
+    {
+        if (!strcmp(scenes[i].code, code))
+            return i;
+    }
+    return -1;
+}
+
+// Forget a cached scene document, e.g. after a failed edit left it half applied
+void ConfigStore::dropScene(uint16_t idx)
+{
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        if (sceneSlots[i] == idx)
+        {
+            sceneSlots[i] = -1;
+            sceneDocs[i].clear();
+        }
+    }
+}
+
+void ConfigStore::setPrefetch(uint16_t idx)
+{
+    prefetchIdx = idx < sceneSize ? idx : -1;
+}
+
+bool ConfigStore::isPrefetchPending()
+{
+    if (!loaded || prefetchIdx < 0)
+        return false;
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        if (sceneSlots[i] == prefetchIdx)
+            return false;
+    }
+    return true;
+}
+
+void ConfigStore::prefetch()
+{
+    if (!isPrefetchPending())
+        return;
+    loadScene(prefetchIdx, (activeSlot + 1) % CONFIG_SCENE_SLOTS);
+    prefetchIdx = -1;
+}
+
+bool ConfigStore::storageRoot()
+{
+    File file = fs->open(tempPath(configRootFile), FILE_WRITE);
+    if (!file)
+        return false;
+    bool success = serializeJson(rootDoc, file) > 0;
+    file.close();
+    return success && commitFile(configRootFile);
+}
+
+bool ConfigStore::storageScene(uint16_t idx)
+{
+    for (uint8_t i = 0; i < CONFIG_SCENE_SLOTS; i++)
+    {
+        if (sceneSlots[i] == idx)
+            return writeScene(sceneDocs[i], scenes[idx].code);
+    }
+    return false;
+}
+
+size_t ConfigStore::measureConfig()
+{
+    CountPrint counter;
+    printConfig(counter);
+    return counter.count;
+}
+
+// Reassemble the single document layout used by the upload and the cloud
+void ConfigStore::printConfig(Print &out)
+{
+    String root;
+    serializeJson(rootDoc, root);
+    if (root.length() < 2 || root[0] != '{')
+        root = "{}";
+    root.remove(root.length() - 1);
+    out.print(root);
+    if (root.length() > 1)
+        out.print(",");
+    out.print("\"scenes\":[");
+    uint8_t buf[128];
+    for (uint16_t i = 0; i < sceneSize; i++)
+    {
+        if (i > 0)
+            out.print(",");
+        File file = openFile(scenePath(scenes[i].code));
+        if (!file)
+        {
+            out.print("{}");
+            continue;
+        }
+        size_t len;
+        while ((len = file.read(buf, sizeof(buf))) > 0)
+        {
+            out.write(buf, len);
+        }
+        file.close();
+    }
+    out.print("]}");
+}
+
+bool ConfigStore::loadIndex()
+{
+    File file = openFile(configSceneIndexFile);
+    if (!file)
+        return false;
+    sceneSize = 0;
+    while (file.available() && sceneSize < CONFIG_SCENE_MAX)
+    {
+        String code = file.readStringUntil('\t');
+        String name = file.readStringUntil('\n');
+        if (0 == code.length())
+            continue;
+        strlcpy(scenes[sceneSize].code, code.c_str(), sizeof(scenes[sceneSize].code));
+        strlcpy(scenes[sceneSize].name, name.c_str(), sizeof(scenes[sceneSize].name));
+        sceneSize++;
+    }
+    file.close();
+    return true;
+}
+
+bool ConfigStore::storageIndex()
+{
+    File file = fs->open(tempPath(configSceneIndexFile), FILE_WRITE);
+    if (!file)
+        return false;
+    for (uint16_t i = 0; i < sceneSize; i++)
+    {
+        file.printf("%s\t%s\n", scenes[i].code, scenes[i].name);
+    }
+    file.close();
+    return commitFile(configSceneIndexFile);
+}
+
+// Stamp of the config.json the store was imported from, 0 if none
+uint32_t ConfigStore::getStamp()
+{
+    File file = openFile(configStampFile);
+    if (!file)
+        return 0;
+    uint32_t stamp = strtoul(file.readStringUntil('\n').c_str(), NULL, 16);
+    file.close();
+    return stamp;
+}
+
+bool ConfigStore::storageStamp(uint32_t stamp)
+{
+    File file = fs->open(tempPath(configStampFile), FILE_WRITE);
+    if (!file)
+        return false;
+    bool success = file.printf("%08x\n", stamp) > 0;
+    file.close();
+    return success && commitFile(configStampFile);
+}
+
+int8_t ConfigStore::loadScene(uint16_t idx, uint8_t slot)
+{
+    sceneSlots[slot] = -1;
+    File file = openFile(scenePath(scenes[idx].code));
+    if (!file)
+    {
+        Serial.printf("Failed to open scene [%s]\r\n", scenes[idx].code);
+        return -1;
+    }
+    DeserializationError error = deserializeJson(sceneDocs[slot], file);
+    file.close();
+    if (error)
+    {
+        // NoMemory means the scene outgrew CONFIG_SCENE_JSON_SIZE, never use it truncated
+        Serial.printf("Failed to read scene [%s]: %s\r\n", scenes[idx].code, error.c_str());
+        sceneDocs[slot].clear();
+        return -1;
+    }
+    sceneSlots[slot] = idx;
+    return slot;
+}
+
+bool ConfigStore::writeScene(JsonVariantConst scene, const char *code)
+{
+    String path = scenePath(code);
+    File file = fs->open(tempPath(path), FILE_WRITE);
+    if (!file)
+    {
+        Serial.printf("Failed to write scene [%s]\r\n", code);
+        return false;
+    }
+    bool success = serializeJson(scene, file) > 0;
+    file.close();
+    return success && commitFile(path);
+}
+
+String ConfigStore::scenePath(const char *code)
+{
+    return String("/scenes/") + code + ".json";
+}
+
+// Files are written next to their target first: "x.json" -> "x.new"
+String ConfigStore::tempPath(const String &path)
+{
+    if (path.endsWith(".json"))
+        return path.substring(0, path.length() - 5) + ".new";
+    return path + ".new";
+}
+
+File ConfigStore::openFile(const String &path)
+{
+    String newPath = tempPath(path);
+    if (!fs->exists(path) && fs->exists(newPath))
+    {
+        // power lost between removing the old file and renaming the new one in
+        Serial.printf("Recover [%s]\r\n", path.c_str());
+        fs->rename(newPath, path);
+    }
+    return fs->open(path, FILE_READ);
+}
+
+bool ConfigStore::commitFile(const String &path)
+{
+    String newPath = tempPath(path);
+    if (fs->rename(newPath, path))
+        return true;
+    // not every filesystem renames over an existing file (SPIFFS does not)
+    fs->remove(path);
+    return fs->rename(newPath, path);
+}
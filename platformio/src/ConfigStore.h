@@ -0,0 +1,69 @@
+#ifndef _CONFIG_STORE_H_
+#define _CONFIG_STORE_H_
+
+#include <FS.h>
+#include <ArduinoJson.h>
+#include "ConfigLimits.h"
+
+#define CONFIG_SCENE_SLOTS 2 // active + prefetched
+
+typedef struct
+{
+    char code[CONFIG_SCENE_CODE_LEN];
+    char name[CONFIG_SCENE_NAME_LEN];
+} ConfigSceneEntry;
+
+// Paged config storage: the uploaded config.json is split into a root
+// document (device, network, remote clients), a scene index and one file
+// per scene. Only the root, the index and two scene documents (active and
+// prefetched) are ever held in RAM, so the scene count is bounded by
+// CONFIG_SCENE_MAX instead of a single JSON document. The stamp of the
+// imported config.json is kept with it, so an unchanged upload is not
+// imported again.
+class ConfigStore
+{
+public:
+    void init(fs::FS *fs);
+    bool importConfig(const char *path, uint32_t stamp);
+    uint32_t getStamp();
+    bool load();
+    bool isLoaded();
+    JsonObject getRoot();
+    uint16_t getSceneSize();
+    const char *getSceneCode(uint16_t idx);
+    const char *getSceneName(uint16_t idx);
+    JsonObject getScene(uint16_t idx);
+    JsonObjectConst readScene(uint16_t idx);
+    int16_t findScene(const char *code);
+    void dropScene(uint16_t idx);
+    void setPrefetch(uint16_t idx);
+    bool isPrefetchPending();
+    void prefetch();
+    bool storageRoot();
+    bool storageScene(uint16_t idx);
+    size_t measureConfig();
+    void printConfig(Print &out);
+
+private:
+    bool loadIndex();
+    bool storageIndex();
+    bool storageStamp(uint32_t stamp);
+    int8_t loadScene(uint16_t idx, uint8_t slot);
+    bool writeScene(JsonVariantConst scene, const char *code);
+    String scenePath(const char *code);
+    String tempPath(const String &path);
+    File openFile(const String &path);
+    bool commitFile(const String &path);
+
+    fs::FS *fs = NULL;
+    bool loaded = false;
+    StaticJsonDocument<CONFIG_ROOT_JSON_SIZE> rootDoc;
+    ConfigSceneEntry scenes[CONFIG_SCENE_MAX];
+    uint16_t sceneSize = 0;
+    StaticJsonDocument<CONFIG_SCENE_JSON_SIZE> sceneDocs[CONFIG_SCENE_SLOTS];
+    int16_t sceneSlots[CONFIG_SCENE_SLOTS] = {-1, -1};
+    uint8_t activeSlot = 0;
+    int16_t prefetchIdx = -1;
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "CpuGovernor.h"
+
+void CpuGovernor::init()
+{
+    mutex = xSemaphoreCreateMutex();
+    currentMhz = getCpuFrequencyMhz();
+    lastSwitchTime = millis();
+    apply();
+}
+
+void CpuGovernor::acquire(CpuLock lock)
+{
+    set(lock, true);
+}
+
+void CpuGovernor::release(CpuLock lock)
+{
+    set(lock, false);
+}
+
+void CpuGovernor::set(CpuLock lock, bool hold)
+{
+    uint8_t bit = 1 << lock;
+    if (hold == ((locks & bit) != 0))
+        return;
+    if (mutex)
+        xSemaphoreTake(mutex, portMAX_DELAY);
+    if (hold)
+        locks |= bit;
+    else
+        locks &= ~bit;
+    apply();
+    if (mutex)
+        xSemaphoreGive(mutex);
+}
+
+bool CpuGovernor::isBoosted()
+{
+    return getCpuFrequencyMhz() >= CPU_GOVERNOR_HIGH_MHZ;
+}
+
+// Called on latency critical paths, a low clock run there is a governor bug.
+// Only counted, printStats() reports it; no print on the critical path.
+void CpuGovernor::checkCritical(const char *path)
+{
+    criticalRuns++;
+    if (!isBoosted())
+        criticalLowRuns++;
+}
+
+void CpuGovernor::printStats(Print &out)
+{
+    uint32_t now = millis();
+    uint32_t low = lowTime + (currentMhz < CPU_GOVERNOR_HIGH_MHZ ? now - lastSwitchTime : 0);
+    uint32_t high = highTime + (currentMhz >= CPU_GOVERNOR_HIGH_MHZ ? now - lastSwitchTime : 0);
+    out.printf("cpu: %d MHz, %d switches, low %d s, high %d s, critical %d runs, %d at low clock\r\n",
+               currentMhz, switchCount, low / 1000, high / 1000, criticalRuns, criticalLowRuns);
+}
+
+void CpuGovernor::apply()
+{
+    uint32_t targetMhz = locks ? CPU_GOVERNOR_HIGH_MHZ : CPU_GOVERNOR_LOW_MHZ;
+    if (targetMhz == currentMhz)
+        return;
+    uint32_t now = millis();
+    if (currentMhz < CPU_GOVERNOR_HIGH_MHZ)
+        lowTime += now - lastSwitchTime;
+    else
+        highTime += now - lastSwitchTime;
+    lastSwitchTime = now;
+    if (!setCpuFrequencyMhz(targetMhz))
+    {
+        Serial.printf("cpu: Failed to switch to %d MHz\r\n", targetMhz);
+        return;
+    }
+    currentMhz = targetMhz;
+    switchCount++;
+}
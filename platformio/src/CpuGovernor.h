@@ -0,0 +1,49 @@
+#ifndef _CPU_GOVERNOR_H_
+#define _CPU_GOVERNOR_H_
+
+#include <Arduino.h>
+
+#define CPU_GOVERNOR_LOW_MHZ 80
+#define CPU_GOVERNOR_HIGH_MHZ 240
+
+typedef enum
+{
+    CPU_LOCK_MODE = 0,  // any mode but STANDBY
+    CPU_LOCK_ACTIVITY,  // just after a key press
+    CPU_LOCK_ANIMATION, // LVGL animation running
+    CPU_LOCK_IR_SEND,
+    CPU_LOCK_NETWORK,
+    CPU_LOCK_NUM
+} CpuLock;
+
+// CPU frequency governor modelled on ESP-IDF power management locks: the
+// clock runs low unless some lock is held. The Arduino core ships without
+// CONFIG_PM, so esp_pm locks are no-ops there and setCpuFrequencyMhz() does
+// the switch instead. APB stays at 80 MHz, peripherals keep their timing.
+// Locks may be taken from any task.
+class CpuGovernor
+{
+public:
+    void init();
+    void acquire(CpuLock lock);
+    void release(CpuLock lock);
+    void set(CpuLock lock, bool hold);
+    bool isBoosted();
+    void checkCritical(const char *path);
+    void printStats(Print &out);
+
+private:
+    void apply();
+
+    SemaphoreHandle_t mutex = NULL;
+    uint8_t locks = 0;
+    uint32_t currentMhz = CPU_GOVERNOR_HIGH_MHZ;
+    uint32_t switchCount = 0;
+    uint32_t lastSwitchTime = 0;
+    uint32_t lowTime = 0;  // uint: ms
+    uint32_t highTime = 0; // uint: ms
+    uint32_t criticalRuns = 0;
+    uint32_t criticalLowRuns = 0;
+};
+
+#endif
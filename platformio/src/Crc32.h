@@ -0,0 +1,15 @@
+#ifndef _CRC32_H_
+#define _CRC32_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CRC32_INIT 0xFFFFFFFF
+
+// CRC-32 (IEEE 802.3), usable on host tools and firmware alike.
+// Chain calls with the returned value, finish with crc32Final().
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len);
+uint32_t crc32Final(uint32_t crc);
+uint32_t crc32(const uint8_t *data, size_t len);
+
+#endif
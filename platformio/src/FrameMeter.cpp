@@ -0,0 +1,139 @@
+#include "FrameMeter.h"
+
+void FrameMeter::init()
+{
+    frameHist.init(FRAME_METER_TIME_BASE);
+    flushHist.init(FRAME_METER_TIME_BASE);
+    areaHist.init(FRAME_METER_AREA_BASE);
+}
+
+void FrameMeter::setName(uint8_t slot, const char *name)
+{
+    if (slot < FRAME_METER_SLOTS)
+        stats[slot].name = name;
+}
+
+void FrameMeter::begin()
+{
+    beginTime = micros();
+}
+
+// pixels and flushTime: what the flush callback sent during this frame
+void FrameMeter::end(uint8_t slot, uint32_t pixels, uint32_t flushTime)
+{
+    lastTime = micros() - beginTime;
+    lastPixels = pixels;
+    lastFlushTime = flushTime;
+    if (lastTime > worstTime)
+        worstTime = lastTime;
+    frameHist.add(lastTime);
+    // passes where LVGL only ran its timers say nothing about drawing cost
+    if (pixels > 0)
+    {
+        flushHist.add(flushTime);
+        areaHist.add(pixels);
+    }
+    if (slot < FRAME_METER_SLOTS)
+    {
+        FrameStat *stat = &stats[slot];
+        stat->frames++;
+        stat->busyTime += lastTime;
+        if (lastTime > stat->maxTime)
+            stat->maxTime = lastTime;
+    }
+    windowFrames++;
+    countWindow();
+}
+
+void FrameMeter::skip(uint8_t slot)
+{
+    if (slot < FRAME_METER_SLOTS)
+        stats[slot].skips++;
+    // an idle second reads as 0 fps, not as the last busy one
+    countWindow();
+}
+
+// Counted on top of the skip() of the same pass
+void FrameMeter::drop(uint8_t slot)
+{
+    if (slot < FRAME_METER_SLOTS)
+        stats[slot].drops++;
+}
+
+void FrameMeter::countWindow()
+{
+    uint32_t now = millis();
+    if (now - windowTime < FRAME_METER_WINDOW)
+        return;
+    fps = (uint32_t)windowFrames * 1000 / (now - windowTime);
+    windowFrames = 0;
+    windowTime = now;
+}
+
+uint32_t FrameMeter::getLastTime()
+{
+    return lastTime;
+}
+
+uint32_t FrameMeter::getWorstTime()
+{
+    return worstTime;
+}
+
+uint32_t FrameMeter::getLastPixels()
+{
+    return lastPixels;
+}
+
+uint32_t FrameMeter::getLastFlushTime()
+{
+    return lastFlushTime;
+}
+
+uint16_t FrameMeter::getFps()
+{
+    return fps;
+}
+
+void FrameMeter::reset()
+{
+    for (uint8_t i = 0; i < FRAME_METER_SLOTS; i++)
+    {
+        stats[i].frames = 0;
+        stats[i].skips = 0;
+        stats[i].drops = 0;
+        stats[i].busyTime = 0;
+        stats[i].maxTime = 0;
+    }
+    worstTime = 0;
+    frameHist.reset();
+    flushHist.reset();
+    areaHist.reset();
+}
+
+void FrameMeter::print(Print &out)
+{
+    out.printf("render: %d fps, last frame %d us, worst %d us\r\n", fps, lastTime, worstTime);
+    out.printf("render p50/p95: frame <%d us/<%d us, flush <%d us/<%d us, area <%d/<%d px\r\n",
+               frameHist.getPercentile(50), frameHist.getPercentile(95),
+               flushHist.getPercentile(50), flushHist.getPercentile(95),
+               areaHist.getPercentile(50), areaHist.getPercentile(95));
+    for (uint8_t i = 0; i < FRAME_METER_SLOTS; i++)
+    {
+        FrameStat *stat = &stats[i];
+        if (0 == stat->frames && 0 == stat->skips)
+            continue;
+        uint32_t avg = stat->frames > 0 ? stat->busyTime / stat->frames : 0;
+        out.printf("render %s: %d frames, %d skipped, %d dropped, avg %d us, max %d us\r\n",
+                   stat->name ? stat->name : "-", stat->frames, stat->skips, stat->drops, avg, stat->maxTime);
+    }
+}
+
+// "frameTime":{...},"flushTime":{...},"flushArea":{...} for a telemetry event
+String FrameMeter::toJson()
+{
+    return "\"fps\":" + String(fps) + ",\"worstFrame\":" + String(worstTime) +
+           ",\"frameTime\":" + frameHist.toJson() +
+           ",\"flushTime\":" + flushHist.toJson() +
+           ",\"flushArea\":" + areaHist.toJson();
+}
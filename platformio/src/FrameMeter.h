@@ -0,0 +1,62 @@
+#ifndef _FRAME_METER_H_
+#define _FRAME_METER_H_
+
+#include <Arduino.h>
+#include "Histogram.h"
+
+#define FRAME_METER_SLOTS 8
+#define FRAME_METER_WINDOW 1000 // uint: ms, FPS is counted over this
+#define FRAME_METER_TIME_BASE 1000 // uint: us, first frame and flush time bucket
+#define FRAME_METER_AREA_BASE 240  // uint: pixel, first flushed area bucket
+
+typedef struct
+{
+    const char *name;
+    uint32_t frames;
+    uint32_t skips;    // render passes with nothing to draw
+    uint32_t drops;    // animation frames given up to input or an overrun
+    uint64_t busyTime; // uint: us
+    uint32_t maxTime;  // uint: us
+} FrameStat;
+
+// Cost of the LVGL handler per slot (one per running mode): frames drawn,
+// passes skipped, animation frames dropped, average and worst frame time,
+// and the frame rate over the last window. Frame time, flush time and
+// flushed area also go into histograms for telemetry. Written by the render
+// task only, reset() included; other tasks only print it.
+class FrameMeter
+{
+public:
+    void init();
+    void setName(uint8_t slot, const char *name);
+    void begin();
+    void end(uint8_t slot, uint32_t pixels, uint32_t flushTime);
+    void skip(uint8_t slot);
+    void drop(uint8_t slot);
+    uint32_t getLastTime();
+    uint32_t getWorstTime();
+    uint32_t getLastPixels();
+    uint32_t getLastFlushTime();
+    uint16_t getFps();
+    void reset();
+    void print(Print &out);
+    String toJson();
+
+private:
+    void countWindow();
+
+    FrameStat stats[FRAME_METER_SLOTS];
+    uint32_t beginTime = 0;   // uint: us
+    uint32_t lastTime = 0;    // uint: us
+    uint32_t worstTime = 0;   // uint: us
+    uint32_t lastPixels = 0;
+    uint32_t lastFlushTime = 0; // uint: us
+    uint32_t windowTime = 0;  // uint: ms
+    uint16_t windowFrames = 0;
+    uint16_t fps = 0;
+    Histogram frameHist;
+    Histogram flushHist;
+    Histogram areaHist;
+};
+
+#endif
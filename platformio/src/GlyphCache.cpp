@@ -0,0 +1,173 @@
+#include <esp_heap_caps.h>
+#include "GlyphCache.h"
+
+GlyphCache *GlyphCache::instance = NULL;
+
+void GlyphCache::init(size_t budget)
+{
+    clear();
+    this->budget = budget;
+    instance = this;
+}
+
+// Only compressed fmt_txt fonts, a plain one is already a bitmap in flash
+bool GlyphCache::attach(lv_font_t *font)
+{
+    if (fontNum >= GLYPH_CACHE_FONTS || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt)
+        return false;
+    const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    if (LV_FONT_FMT_TXT_PLAIN == dsc->bitmap_format)
+        return false;
+    fonts[fontNum] = font;
+    decoders[fontNum] = font->get_glyph_bitmap;
+    fontNum++;
+    font->get_glyph_bitmap = fontBitmap;
+    return true;
+}
+
+const uint8_t *GlyphCache::fontBitmap(const lv_font_t *font, uint32_t letter)
+{
+    return instance != NULL ? instance->get(font, letter) : NULL;
+}
+
+const uint8_t *GlyphCache::get(const lv_font_t *font, uint32_t letter)
+{
+    int8_t fontIdx = findFont(font);
+    if (fontIdx < 0)
+        return NULL;
+    tick++;
+    GlyphCacheEntry *slot = NULL;
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        GlyphCacheEntry *entry = &entries[i];
+        if (NULL == entry->data)
+        {
+            if (NULL == slot)
+                slot = entry;
+            continue;
+        }
+        if (entry->font == font && entry->letter == letter)
+        {
+            entry->lastUse = tick;
+            hits++;
+            return entry->data;
+        }
+    }
+    misses++;
+
+    // decoded into LVGL's shared buffer, valid until the next letter
+    const uint8_t *bitmap = decoders[fontIdx](font, letter);
+    lv_font_glyph_dsc_t dsc;
+    if (NULL == bitmap || !lv_font_get_glyph_dsc(font, &dsc, letter, 0))
+        return bitmap;
+    uint8_t bpp = 3 == dsc.bpp ? 4 : dsc.bpp; // 3 bpp is decompressed as 4
+    size_t size = ((size_t)dsc.box_w * dsc.box_h * bpp + 7) / 8;
+    if (0 == size || size > budget)
+        return bitmap;
+    while (NULL == slot || used + size > budget)
+    {
+        GlyphCacheEntry *entry = evict();
+        if (NULL == entry)
+            return bitmap;
+        if (NULL == slot)
+            slot = entry;
+    }
+    uint8_t *data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (NULL == data)
+        return bitmap;
+    memcpy(data, bitmap, size);
+    slot->font = font;
+    slot->letter = letter;
+    slot->data = data;
+    slot->size = size;
+    slot->lastUse = tick;
+    used += size;
+    return data;
+}
+
+void GlyphCache::clear()
+{
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        release(&entries[i]);
+    }
+}
+
+uint32_t GlyphCache::getHits()
+{
+    return hits;
+}
+
+uint32_t GlyphCache::getMisses()
+{
+    return misses;
+}
+
+size_t GlyphCache::getUsed()
+{
+    return used;
+}
+
+void GlyphCache::reset()
+{
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+void GlyphCache::print(Print &out)
+{
+    uint8_t glyphs = 0;
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].data != NULL)
+            glyphs++;
+    }
+    uint32_t lookups = hits + misses;
+    out.printf("glyph cache: %d hits, %d misses (%d%% hit), %d evicted, %d/%d B in %d glyphs\r\n",
+               hits, misses, lookups > 0 ? hits * 100 / lookups : 0, evictions, used, budget, glyphs);
+}
+
+// {"hits":n,"misses":n,"evictions":n,"used":n} for a telemetry event
+String GlyphCache::toJson()
+{
+    return "{\"hits\":" + String(hits) + ",\"misses\":" + String(misses) +
+           ",\"evictions\":" + String(evictions) + ",\"used\":" + String((uint32_t)used) + "}";
+}
+
+int8_t GlyphCache::findFont(const lv_font_t *font)
+{
+    for (uint8_t i = 0; i < fontNum; i++)
+    {
+        if (fonts[i] == font)
+            return i;
+    }
+    return -1;
+}
+
+GlyphCacheEntry *GlyphCache::evict()
+{
+    GlyphCacheEntry *oldest = NULL;
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        GlyphCacheEntry *entry = &entries[i];
+        if (entry->data != NULL && (NULL == oldest || tick - entry->lastUse > tick - oldest->lastUse))
+            oldest = entry;
+    }
+    if (oldest != NULL)
+    {
+        release(oldest);
+        evictions++;
+    }
+    return oldest;
+}
+
+void GlyphCache::release(GlyphCacheEntry *entry)
+{
+    if (NULL == entry->data)
+        return;
+    heap_caps_free(entry->data);
+    used -= entry->size;
+    entry->data = NULL;
+    entry->size = 0;
+}
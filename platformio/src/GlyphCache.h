@@ -0,0 +1,59 @@
+#ifndef _GLYPH_CACHE_H_
+#define _GLYPH_CACHE_H_
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define GLYPH_CACHE_ENTRIES 64
+#define GLYPH_CACHE_FONTS 4
+
+typedef struct
+{
+    const lv_font_t *font;
+    uint32_t letter;
+    uint8_t *data;
+    uint16_t size;     // uint: byte
+    uint32_t lastUse;  // lookup tick, the smallest one is evicted first
+} GlyphCacheEntry;
+
+// Decoded glyph bitmaps of compressed LVGL fonts, least recently used out.
+// A compressed font is decompressed into one shared buffer for every letter
+// drawn, so a label redrawn each frame decodes the same glyphs over and
+// over. attach() puts the cache in front of a font's get_glyph_bitmap; the
+// bitmaps are kept in internal RAM up to the byte budget given to init().
+// Called from LVGL, so only the render task changes it, reset() included;
+// other tasks only print it.
+class GlyphCache
+{
+public:
+    void init(size_t budget);
+    bool attach(lv_font_t *font);
+    const uint8_t *get(const lv_font_t *font, uint32_t letter);
+    void clear();
+    uint32_t getHits();
+    uint32_t getMisses();
+    size_t getUsed();
+    void reset();
+    void print(Print &out);
+    String toJson();
+
+private:
+    static const uint8_t *fontBitmap(const lv_font_t *font, uint32_t letter);
+    int8_t findFont(const lv_font_t *font);
+    GlyphCacheEntry *evict();
+    void release(GlyphCacheEntry *entry);
+
+    static GlyphCache *instance;
+    const lv_font_t *fonts[GLYPH_CACHE_FONTS];
+    const uint8_t *(*decoders[GLYPH_CACHE_FONTS])(const lv_font_t *, uint32_t);
+    uint8_t fontNum = 0;
+    GlyphCacheEntry entries[GLYPH_CACHE_ENTRIES];
+    size_t budget = 0; // uint: byte
+    size_t used = 0;   // uint: byte
+    uint32_t tick = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+};
+
+#endif
@@ -0,0 +1,64 @@
+#include "Histogram.h"
+
+void Histogram::init(uint32_t base)
+{
+    this->base = base > 0 ? base : 1;
+    reset();
+}
+
+void Histogram::add(uint32_t value)
+{
+    uint8_t bucket = 0;
+    uint32_t bound = base;
+    while (bucket < HISTOGRAM_BUCKETS - 1 && value >= bound)
+    {
+        bucket++;
+        bound <<= 1;
+    }
+    counts[bucket]++;
+    total++;
+}
+
+uint32_t Histogram::getTotal()
+{
+    return total;
+}
+
+// Upper bound of the bucket holding the given percentile, 0 when empty
+uint32_t Histogram::getPercentile(uint8_t percent)
+{
+    if (0 == total)
+        return 0;
+    uint32_t rank = ((uint64_t)total * percent + 99) / 100;
+    uint32_t count = 0;
+    for (uint8_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        count += counts[i];
+        if (count >= rank)
+            return base << i;
+    }
+    return base << (HISTOGRAM_BUCKETS - 1);
+}
+
+void Histogram::reset()
+{
+    memset(counts, 0, sizeof(counts));
+    total = 0;
+}
+
+// {"base":1000,"counts":[...]}, trailing empty buckets left out
+String Histogram::toJson()
+{
+    uint8_t len = HISTOGRAM_BUCKETS;
+    while (len > 0 && 0 == counts[len - 1])
+        len--;
+    String json = "{\"base\":" + String(base) + ",\"counts\":[";
+    for (uint8_t i = 0; i < len; i++)
+    {
+        if (i > 0)
+            json += ",";
+        json += String(counts[i]);
+    }
+    json += "]}";
+    return json;
+}
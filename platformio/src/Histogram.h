@@ -0,0 +1,27 @@
+#ifndef _HISTOGRAM_H_
+#define _HISTOGRAM_H_
+
+#include <Arduino.h>
+
+#define HISTOGRAM_BUCKETS 12
+
+// Power-of-two buckets: bucket i counts values below base << i, the last
+// one everything above. Cheap enough to add to on every frame. Not locked,
+// add() and reset() belong to the task of the owner.
+class Histogram
+{
+public:
+    void init(uint32_t base);
+    void add(uint32_t value);
+    uint32_t getTotal();
+    uint32_t getPercentile(uint8_t percent);
+    void reset();
+    String toJson();
+
+private:
+    uint32_t base = 1;
+    uint32_t counts[HISTOGRAM_BUCKETS];
+    uint32_t total = 0;
+};
+
+#endif
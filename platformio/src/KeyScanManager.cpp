@@ -1,20 +1,30 @@
 #include <Arduino.h>
 #include <string.h>
+#include <driver/gpio.h>
+#include <driver/rtc_io.h>
+#include <esp_sleep.h>
+#include <esp32/ulp.h>
+#include <soc/rtc_io_reg.h>
 #include "KeyScanManager.h"
 
 void KeyScanManager::init(uint8_t write_pins[], uint8_t read_pins[],
                           const char *keys[], uint8_t keysNum,
                           void (*keyPress)(const char *key, KeyPressType KeyPressType))
 {
+    // release the pins parked by prepareSleep()
+    gpio_deep_sleep_hold_dis();
     for (int i = 0; i < KEY_SCAN_ROWS; i++)
     {
         this->writePins[i] = write_pins[i];
+        gpio_hold_dis((gpio_num_t)writePins[i]);
         pinMode(writePins[i], OUTPUT);
         digitalWrite(writePins[i], HIGH);
     }
     for (int i = 0; i < KEY_SCAN_COLS; i++)
     {
         this->readPins[i] = read_pins[i];
+        if (rtc_gpio_is_valid_gpio((gpio_num_t)readPins[i]))
+            rtc_gpio_deinit((gpio_num_t)readPins[i]);
         pinMode(readPins[i], INPUT);
     }
     for (int i = 0; i < keysNum; i++)
@@ -40,7 +50,11 @@ void KeyScanManager::scan()
         keyObj = &keyObjs[currentRow * KEY_SCAN_COLS + i];
         if (readValues[i])
         {
-            if (keyObj->stayNum > KEY_SCAN_LONG_PRESS_MIN_NUM)
+            if (keyObj->ignore)
+            {
+                keyObj->ignore = false;
+            }
+            else if (keyObj->stayNum > KEY_SCAN_LONG_PRESS_MIN_NUM)
             {
                 // long press
                 keyPress(keyObj->key, KeyPressType::PRESS_LONG);
@@ -58,3 +72,136 @@ void KeyScanManager::scan()
         }
     }
 }
+
+// Find the key held right now by driving one row at a time, -1 if none
+int8_t KeyScanManager::probe()
+{
+    int8_t found = -1;
+    for (int row = 0; row < KEY_SCAN_ROWS && found < 0; row++)
+    {
+        digitalWrite(writePins[row], LOW);
+        delayMicroseconds(10);
+        for (int col = 0; col < KEY_SCAN_COLS; col++)
+        {
+            if (!digitalRead(readPins[col]))
+            {
+                found = row * KEY_SCAN_COLS + col;
+                break;
+            }
+        }
+        digitalWrite(writePins[row], HIGH);
+    }
+    return found;
+}
+
+const char *KeyScanManager::getKey(uint8_t idx)
+{
+    return idx < KEY_SCAN_ROWS * KEY_SCAN_COLS ? keyObjs[idx].key : "";
+}
+
+void KeyScanManager::ignore(uint8_t idx)
+{
+    if (idx < KEY_SCAN_ROWS * KEY_SCAN_COLS)
+        keyObjs[idx].ignore = true;
+}
+
+// Park every row low so any key pulls its column low, then let the ULP
+// poll the columns. EXT1 only wakes on all-low or any-high, neither fits
+// a matrix with pull-ups, so the ULP wakes the chip on any-low instead.
+bool KeyScanManager::prepareSleep()
+{
+    int8_t low = -1;
+    int8_t high = -1;
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        int rtcio = rtc_io_number_get((gpio_num_t)readPins[i]);
+        if (rtcio < 0)
+            return false;
+        if (low < 0 || rtcio < low)
+            low = rtcio;
+        if (rtcio > high)
+            high = rtcio;
+    }
+    if (high - low >= 16)
+        return false;
+    uint16_t mask = 0;
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        mask |= 1 << (rtc_io_number_get((gpio_num_t)readPins[i]) - low);
+        rtc_gpio_init((gpio_num_t)readPins[i]);
+        rtc_gpio_set_direction((gpio_num_t)readPins[i], RTC_GPIO_MODE_INPUT_ONLY);
+    }
+    for (int i = 0; i < KEY_SCAN_ROWS; i++)
+    {
+        digitalWrite(writePins[i], LOW);
+        gpio_hold_en((gpio_num_t)writePins[i]);
+    }
+    gpio_deep_sleep_hold_en();
+
+    const ulp_insn_t program[] = {
+        I_RD_REG(RTC_GPIO_IN_REG, RTC_GPIO_IN_NEXT_S + low, RTC_GPIO_IN_NEXT_S + high),
+        I_ANDI(R0, R0, mask),
+        I_MOVI(R3, KEY_SCAN_ULP_STATE_ADDR),
+        I_ST(R0, R3, 0),
+        I_SUBI(R0, R0, mask),
+        M_BXZ(1), // all columns high, nothing pressed
+        I_WAKE(),
+        I_END(),
+        M_LABEL(1),
+        I_HALT()};
+    size_t size = sizeof(program) / sizeof(ulp_insn_t);
+    RTC_SLOW_MEM[KEY_SCAN_ULP_STATE_ADDR] = mask;
+    if (ulp_process_macros_and_load(0, program, &size) != ESP_OK)
+        return false;
+    ulp_set_wakeup_period(0, KEY_SCAN_ULP_PERIOD);
+    if (ulp_run(0) != ESP_OK)
+        return false;
+    return esp_sleep_enable_ulp_wakeup() == ESP_OK;
+}
+
+// Columns seen low by the ULP when it woke the chip, bit per column
+uint8_t KeyScanManager::getWakeColumns()
+{
+    int8_t low = -1;
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        int rtcio = rtc_io_number_get((gpio_num_t)readPins[i]);
+        if (rtcio >= 0 && (low < 0 || rtcio < low))
+            low = rtcio;
+    }
+    uint16_t state = RTC_SLOW_MEM[KEY_SCAN_ULP_STATE_ADDR] & 0xFFFF;
+    uint8_t columns = 0;
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        int rtcio = rtc_io_number_get((gpio_num_t)readPins[i]);
+        if (rtcio >= 0 && !(state & (1 << (rtcio - low))))
+            columns |= 1 << i;
+    }
+    return columns;
+}
+
+// Light sleep keeps the GPIO matrix powered, any column going low wakes it
+void KeyScanManager::prepareLightSleep()
+{
+    for (int i = 0; i < KEY_SCAN_ROWS; i++)
+    {
+        digitalWrite(writePins[i], LOW);
+    }
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        gpio_wakeup_enable((gpio_num_t)readPins[i], GPIO_INTR_LOW_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+}
+
+void KeyScanManager::resume()
+{
+    for (int i = 0; i < KEY_SCAN_COLS; i++)
+    {
+        gpio_wakeup_disable((gpio_num_t)readPins[i]);
+    }
+    for (int i = 0; i < KEY_SCAN_ROWS; i++)
+    {
+        digitalWrite(writePins[i], i == currentRow ? LOW : HIGH);
+    }
+}
@@ -7,6 +7,8 @@
 #define KEY_SCAN_KEY_CODE_LEN 30
 #define KEY_SCAN_SHORT_PRESS_MIN_NUM 8
 #define KEY_SCAN_LONG_PRESS_MIN_NUM 100
+#define KEY_SCAN_ULP_STATE_ADDR 64 // uint: 32-bit word in RTC slow memory
+#define KEY_SCAN_ULP_PERIOD 20000  // uint: us
 
 typedef enum
 {
@@ -18,6 +20,7 @@ typedef struct
 {
     char key[KEY_SCAN_KEY_CODE_LEN];
     uint8_t stayNum;
+    bool ignore; // already handled, swallow its release
 } KeyObj;
 
 class KeyScanManager
@@ -25,6 +28,13 @@ class KeyScanManager
 public:
     void init(uint8_t write_pins[], uint8_t read_pins[], const char *keys[], uint8_t keysNum, void (*keyPress)(const char *key, KeyPressType type));
     void scan();
+    int8_t probe();
+    const char *getKey(uint8_t idx);
+    void ignore(uint8_t idx);
+    bool prepareSleep();
+    void prepareLightSleep();
+    void resume();
+    uint8_t getWakeColumns();
 
 private:
     KeyObj keyObjs[KEY_SCAN_ROWS * KEY_SCAN_COLS];
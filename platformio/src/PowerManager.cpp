@@ -0,0 +1,69 @@
+#include "PowerManager.h"
+
+void PowerManager::init(uint32_t now)
+{
+    for (uint8_t i = 0; i < POWER_STAGE_NUM; i++)
+    {
+        stageTimes[i] = 0;
+    }
+    lastActiveTime = now;
+    stageBeginTime = now;
+    stage = POWER_ACTIVE;
+}
+
+void PowerManager::setTimeout(PowerStage stage, uint32_t timeout)
+{
+    if (stage > POWER_ACTIVE && stage < POWER_STAGE_NUM)
+        timeouts[stage] = timeout;
+}
+
+uint32_t PowerManager::getTimeout(PowerStage stage)
+{
+    return stage < POWER_STAGE_NUM ? timeouts[stage] : 0;
+}
+
+void PowerManager::notifyActive(uint32_t now)
+{
+    lastActiveTime = now;
+    update(now);
+}
+
+PowerStage PowerManager::update(uint32_t now)
+{
+    uint32_t idle = now - lastActiveTime;
+    PowerStage target = POWER_ACTIVE;
+    for (uint8_t i = POWER_ACTIVE + 1; i < POWER_STAGE_NUM; i++)
+    {
+        if (timeouts[i] > 0 && idle >= timeouts[i])
+            target = (PowerStage)i;
+    }
+    if (target != stage)
+    {
+        stageTimes[stage] += now - stageBeginTime;
+        stageBeginTime = now;
+        stage = target;
+    }
+    return stage;
+}
+
+PowerStage PowerManager::getStage()
+{
+    return stage;
+}
+
+// Total time spent in a stage, the running one included
+uint32_t PowerManager::getStageTime(PowerStage stage, uint32_t now)
+{
+    if (stage >= POWER_STAGE_NUM)
+        return 0;
+    uint32_t time = stageTimes[stage];
+    if (stage == this->stage)
+        time += now - stageBeginTime;
+    return time;
+}
+
+const char *PowerManager::getStageName(PowerStage stage)
+{
+    const char *names[] = {"active", "dim", "screen-off", "light-sleep", "deep-sleep"};
+    return stage < POWER_STAGE_NUM ? names[stage] : "";
+}
@@ -0,0 +1,41 @@
+#ifndef _POWER_MANAGER_H_
+#define _POWER_MANAGER_H_
+
+#include <stdint.h>
+
+typedef enum
+{
+    POWER_ACTIVE = 0,
+    POWER_DIM,
+    POWER_SCREEN_OFF,
+    POWER_LIGHT_SLEEP,
+    POWER_DEEP_SLEEP,
+    POWER_STAGE_NUM
+} PowerStage;
+
+// Power ladder driven by the time since the last activity. Each stage has
+// its own idle timeout (0 skips it), the deepest stage whose timeout has
+// passed wins. Time is passed in, so the ladder runs the same on a
+// simulated clock (see test/power-ladder.cpp); all arithmetic is unsigned
+// and survives the millis() wrap.
+class PowerManager
+{
+public:
+    void init(uint32_t now);
+    void setTimeout(PowerStage stage, uint32_t timeout);
+    uint32_t getTimeout(PowerStage stage);
+    void notifyActive(uint32_t now);
+    PowerStage update(uint32_t now);
+    PowerStage getStage();
+    uint32_t getStageTime(PowerStage stage, uint32_t now);
+    static const char *getStageName(PowerStage stage);
+
+private:
+    uint32_t timeouts[POWER_STAGE_NUM] = {0}; // uint: ms
+    uint32_t stageTimes[POWER_STAGE_NUM] = {0};
+    uint32_t lastActiveTime = 0;
+    uint32_t stageBeginTime = 0;
+    PowerStage stage = POWER_ACTIVE;
+};
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef _REMOTE_KEYS_H_
+#define _REMOTE_KEYS_H_
+
+// Key names in key matrix order (row by row), shared with the host tools
+#define REMOTE_KEY_NAMES {"power", "mode", "sence", "quick", \
+                          "A", "B", "C", "D",                \
+                          "menu", "up", "cancel", "right",   \
+                          "left", "ok", "down", "fn"}
+
+#endif
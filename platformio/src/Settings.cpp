@@ -0,0 +1,183 @@
+#include <Arduino.h>
+#include "Settings.h"
+#include "Crc32.h"
+
+bool Settings::begin()
+{
+    ready = prefs.begin(SETTINGS_NAMESPACE, false);
+    if (!ready)
+    {
+        Serial.println("Failed to open settings");
+        return false;
+    }
+    scene = read("scene", 0);
+    remoteClient = read("client", 0);
+    return true;
+}
+
+uint8_t Settings::getScene()
+{
+    return scene;
+}
+
+void Settings::setScene(uint8_t scene)
+{
+    write("scene", scene, &this->scene);
+}
+
+uint8_t Settings::getRemoteClient()
+{
+    return remoteClient;
+}
+
+void Settings::setRemoteClient(uint8_t remoteClient)
+{
+    write("client", remoteClient, &this->remoteClient);
+}
+
+uint16_t Settings::getBacklight(uint16_t defaultValue)
+{
+    backlight = read("backlight", defaultValue);
+    return backlight;
+}
+
+void Settings::setBacklight(uint16_t backlight)
+{
+    write("backlight", backlight, &this->backlight);
+}
+
+uint16_t Settings::getSleepTimeout(uint16_t defaultValue)
+{
+    sleepTimeout = read("sleep", defaultValue);
+    return sleepTimeout;
+}
+
+void Settings::setSleepTimeout(uint16_t sleepTimeout)
+{
+    write("sleep", sleepTimeout, &this->sleepTimeout);
+}
+
+bool Settings::getWifiCache(WifiCache *cache)
+{
+    if (!ready)
+        return false;
+    uint32_t beginTime = micros();
+    bool found = prefs.getBytes("wifi", cache, sizeof(WifiCache)) == sizeof(WifiCache);
+    readTime += micros() - beginTime;
+    readCount++;
+    return found;
+}
+
+void Settings::setWifiCache(const WifiCache *cache)
+{
+    if (!ready)
+        return;
+    WifiCache stored;
+    if (prefs.getBytes("wifi", &stored, sizeof(stored)) == sizeof(stored) && !memcmp(&stored, cache, sizeof(stored)))
+        return;
+    uint32_t beginTime = micros();
+    prefs.putBytes("wifi", cache, sizeof(WifiCache));
+    writeTime += micros() - beginTime;
+    writeCount++;
+}
+
+void Settings::clearWifiCache()
+{
+    if (ready)
+        prefs.remove("wifi");
+}
+
+bool Settings::getWifiHistory(const char *ssid, WifiHistory *entry)
+{
+    loadWifiHistory();
+    uint32_t hash = crc32((const uint8_t *)ssid, strlen(ssid));
+    for (uint8_t i = 0; i < SETTINGS_WIFI_HISTORY; i++)
+    {
+        if (wifiHistory[i].ssidHash == hash && (wifiHistory[i].joins || wifiHistory[i].fails))
+        {
+            *entry = wifiHistory[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// One entry per network, the least joined entry makes room for a new one
+void Settings::recordWifiJoin(const char *ssid, bool joined, uint32_t joinTime)
+{
+    if (!ready)
+        return;
+    loadWifiHistory();
+    uint32_t hash = crc32((const uint8_t *)ssid, strlen(ssid));
+    WifiHistory *entry = NULL;
+    for (uint8_t i = 0; i < SETTINGS_WIFI_HISTORY && NULL == entry; i++)
+    {
+        if (wifiHistory[i].ssidHash == hash)
+            entry = &wifiHistory[i];
+    }
+    if (NULL == entry)
+    {
+        entry = &wifiHistory[0];
+        for (uint8_t i = 1; i < SETTINGS_WIFI_HISTORY; i++)
+        {
+            if (wifiHistory[i].joins < entry->joins)
+                entry = &wifiHistory[i];
+        }
+        memset(entry, 0, sizeof(WifiHistory));
+        entry->ssidHash = hash;
+    }
+    if (joined)
+    {
+        entry->joins += entry->joins < 255 ? 1 : 0;
+        entry->fails = 0;
+        entry->joinTime = joinTime < 65535 ? joinTime : 65535;
+    }
+    else
+    {
+        entry->fails += entry->fails < 255 ? 1 : 0;
+    }
+    uint32_t beginTime = micros();
+    prefs.putBytes("wifihist", wifiHistory, sizeof(wifiHistory));
+    writeTime += micros() - beginTime;
+    writeCount++;
+}
+
+void Settings::printStats(Print &out)
+{
+    out.printf("settings: %d reads %d us, %d writes %d us\r\n",
+               readCount, readTime, writeCount, writeTime);
+}
+
+void Settings::loadWifiHistory()
+{
+    if (wifiHistoryLoaded)
+        return;
+    wifiHistoryLoaded = true;
+    uint32_t beginTime = micros();
+    if (!ready || prefs.getBytes("wifihist", wifiHistory, sizeof(wifiHistory)) != sizeof(wifiHistory))
+        memset(wifiHistory, 0, sizeof(wifiHistory));
+    readTime += micros() - beginTime;
+    readCount++;
+}
+
+uint16_t Settings::read(const char *key, uint16_t defaultValue)
+{
+    if (!ready)
+        return defaultValue;
+    uint32_t beginTime = micros();
+    uint16_t value = prefs.getUShort(key, defaultValue);
+    readTime += micros() - beginTime;
+    readCount++;
+    return value;
+}
+
+void Settings::write(const char *key, uint16_t value, uint16_t *cache)
+{
+    if (!ready || *cache == value)
+        return;
+    *cache = value;
+    uint32_t beginTime = micros();
+    prefs.putUShort(key, value);
+    writeTime += micros() - beginTime;
+    writeCount++;
+}
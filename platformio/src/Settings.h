@@ -0,0 +1,74 @@
+#ifndef _SETTINGS_H_
+#define _SETTINGS_H_
+
+#include <Preferences.h>
+
+#define SETTINGS_NAMESPACE "i-remote"
+
+// Last good WiFi join, lets a reconnect skip the scan and DHCP
+typedef struct
+{
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t leaseBegin; // RTC time the lease was given, uint: s
+    uint32_t leaseTime;  // uint: s, 0 unknown
+} WifiCache;
+
+#define SETTINGS_WIFI_HISTORY 8
+
+// Join history of one network, keyed by the crc of its ssid
+typedef struct
+{
+    uint32_t ssidHash;
+    uint8_t joins; // saturating
+    uint8_t fails; // in a row, reset by a good join
+    uint16_t joinTime; // last good join, uint: ms
+} WifiHistory;
+
+// Small, often changed settings kept in NVS instead of the filesystem:
+// a put only rewrites one key/value entry. Values are cached, unchanged
+// values are never written again.
+class Settings
+{
+public:
+    bool begin();
+    uint8_t getScene();
+    void setScene(uint8_t scene);
+    uint8_t getRemoteClient();
+    void setRemoteClient(uint8_t remoteClient);
+    uint16_t getBacklight(uint16_t defaultValue);
+    void setBacklight(uint16_t backlight);
+    uint16_t getSleepTimeout(uint16_t defaultValue);
+    void setSleepTimeout(uint16_t sleepTimeout);
+    bool getWifiCache(WifiCache *cache);
+    void setWifiCache(const WifiCache *cache);
+    void clearWifiCache();
+    bool getWifiHistory(const char *ssid, WifiHistory *entry);
+    void recordWifiJoin(const char *ssid, bool joined, uint32_t joinTime);
+    void printStats(Print &out);
+
+private:
+    uint16_t read(const char *key, uint16_t defaultValue);
+    void write(const char *key, uint16_t value, uint16_t *cache);
+    void loadWifiHistory();
+
+    Preferences prefs;
+    bool ready = false;
+    uint16_t scene = 0;
+    uint16_t remoteClient = 0;
+    uint16_t backlight = 0;
+    uint16_t sleepTimeout = 0;
+    WifiHistory wifiHistory[SETTINGS_WIFI_HISTORY];
+    bool wifiHistoryLoaded = false;
+    uint32_t readTime = 0; // uint: us
+    uint16_t readCount = 0;
+    uint32_t writeTime = 0; // uint: us
+    uint16_t writeCount = 0;
+};
+
+#endif
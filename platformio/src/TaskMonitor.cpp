@@ -0,0 +1,78 @@
+#include "TaskMonitor.h"
+
+uint8_t TaskMonitor::add(const char *name, uint32_t stackSize, uint8_t core)
+{
+    if (statNum >= TASK_MONITOR_MAX)
+        return TASK_MONITOR_MAX;
+    TaskStat *stat = &stats[statNum];
+    memset(stat, 0, sizeof(TaskStat));
+    stat->name = name;
+    stat->stackSize = stackSize;
+    stat->core = core;
+    if (0 == resetTime)
+        resetTime = micros();
+    return statNum++;
+}
+
+void TaskMonitor::attach(uint8_t id, TaskHandle_t handle)
+{
+    if (id < statNum)
+        stats[id].handle = handle;
+}
+
+void TaskMonitor::begin(uint8_t id)
+{
+    if (id >= statNum)
+        return;
+    TaskStat *stat = &stats[id];
+    uint32_t now = micros();
+    if (stat->loops > 0 && now - stat->lastBegin > stat->maxGap)
+        stat->maxGap = now - stat->lastBegin;
+    stat->lastBegin = now;
+}
+
+void TaskMonitor::end(uint8_t id)
+{
+    if (id >= statNum)
+        return;
+    TaskStat *stat = &stats[id];
+    uint32_t busy = micros() - stat->lastBegin;
+    stat->busyTime += busy;
+    if (busy > stat->maxBusy)
+        stat->maxBusy = busy;
+    stat->loops++;
+}
+
+void TaskMonitor::drop(uint8_t id)
+{
+    if (id < statNum)
+        stats[id].drops++;
+}
+
+// Counters start over, the stack high-water mark is kept by FreeRTOS
+void TaskMonitor::reset()
+{
+    for (uint8_t i = 0; i < statNum; i++)
+    {
+        stats[i].loops = 0;
+        stats[i].busyTime = 0;
+        stats[i].maxBusy = 0;
+        stats[i].maxGap = 0;
+        stats[i].drops = 0;
+    }
+    resetTime = micros();
+}
+
+void TaskMonitor::print(Print &out)
+{
+    uint32_t wall = max(micros() - resetTime, (uint32_t)1);
+    for (uint8_t i = 0; i < statNum; i++)
+    {
+        TaskStat *stat = &stats[i];
+        // on ESP32 the high-water mark is in bytes, not words
+        uint32_t stackFree = stat->handle ? uxTaskGetStackHighWaterMark(stat->handle) : 0;
+        out.printf("task %-6s core %d: cpu %d.%d%%, %d loops, max loop %d us, max gap %d us, stack %d / %d B free, %d drops\r\n",
+                   stat->name, stat->core, (int)(stat->busyTime * 100 / wall), (int)(stat->busyTime * 1000 / wall % 10),
+                   stat->loops, stat->maxBusy, stat->maxGap, stackFree, stat->stackSize, stat->drops);
+    }
+}
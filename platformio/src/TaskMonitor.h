@@ -0,0 +1,42 @@
+#ifndef _TASK_MONITOR_H_
+#define _TASK_MONITOR_H_
+
+#include <Arduino.h>
+
+#define TASK_MONITOR_MAX 4
+
+typedef struct
+{
+    const char *name;
+    TaskHandle_t handle;
+    uint8_t core;
+    uint32_t stackSize;
+    uint32_t loops;
+    uint64_t busyTime; // uint: us
+    uint32_t maxBusy;  // longest loop, uint: us
+    uint32_t maxGap;   // longest time between two loop starts, uint: us
+    uint32_t lastBegin;
+    uint32_t drops;    // queue items this task never got
+} TaskStat;
+
+// Per task CPU use and stack high-water mark. Every task wraps one pass of
+// its loop in begin()/end() on its own slot, so no locking is needed; the
+// report only reads.
+class TaskMonitor
+{
+public:
+    uint8_t add(const char *name, uint32_t stackSize, uint8_t core);
+    void attach(uint8_t id, TaskHandle_t handle);
+    void begin(uint8_t id);
+    void end(uint8_t id);
+    void drop(uint8_t id);
+    void reset();
+    void print(Print &out);
+
+private:
+    TaskStat stats[TASK_MONITOR_MAX];
+    uint8_t statNum = 0;
+    uint32_t resetTime = 0; // uint: us
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include "UiCommandQueue.h"
+
+void UiCommandQueue::init(UiViewLoader loader)
+{
+    viewLoader = loader;
+    mutex = xSemaphoreCreateMutex();
+}
+
+void UiCommandQueue::setText(lv_obj_t **target, const char *text)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    UiCommand *command = post(UI_CMD_SET_TEXT, target);
+    if (command)
+        strlcpy(command->text, text, sizeof(command->text));
+    xSemaphoreGive(mutex);
+}
+
+void UiCommandQueue::setHidden(lv_obj_t **target, bool hidden)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    UiCommand *command = post(UI_CMD_SET_HIDDEN, target);
+    if (command)
+        command->hidden = hidden;
+    xSemaphoreGive(mutex);
+}
+
+void UiCommandQueue::setBgColor(lv_obj_t **target, uint32_t color)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    UiCommand *command = post(UI_CMD_SET_BG_COLOR, target);
+    if (command)
+        command->color = color;
+    xSemaphoreGive(mutex);
+}
+
+void UiCommandQueue::showView(uint8_t view)
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    // keyed on the type alone, only the last view of a frame matters
+    UiCommand *command = post(UI_CMD_SHOW_VIEW, NULL);
+    if (command)
+        command->view = view;
+    xSemaphoreGive(mutex);
+}
+
+bool UiCommandQueue::isPending()
+{
+    return commandNum > 0;
+}
+
+// Render task only: run everything posted since the last frame
+uint8_t UiCommandQueue::apply()
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    uint8_t num = commandNum;
+    memcpy(running, commands, num * sizeof(UiCommand));
+    commandNum = 0;
+    applied += num;
+    if (num > 0)
+        frames++;
+    xSemaphoreGive(mutex);
+
+    for (uint8_t i = 0; i < num; i++)
+    {
+        if (UI_CMD_SHOW_VIEW == running[i].type)
+            run(&running[i]);
+    }
+    for (uint8_t i = 0; i < num; i++)
+    {
+        if (UI_CMD_SHOW_VIEW != running[i].type)
+            run(&running[i]);
+    }
+    return num;
+}
+
+void UiCommandQueue::reset()
+{
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    posted = 0;
+    coalesced = 0;
+    applied = 0;
+    frames = 0;
+    drops = 0;
+    stale = 0;
+    xSemaphoreGive(mutex);
+}
+
+void UiCommandQueue::print(Print &out)
+{
+    out.printf("ui commands: %u posted, %u coalesced, %u applied in %u frames, %u dropped, %u stale\r\n",
+               posted, coalesced, applied, frames, drops, stale);
+}
+
+// Caller holds the mutex. Same object and type reuse the pending slot.
+UiCommand *UiCommandQueue::post(UiCommandType type, lv_obj_t **target)
+{
+    posted++;
+    for (uint8_t i = 0; i < commandNum; i++)
+    {
+        UiCommand *command = &commands[i];
+        if (command->type == type && command->target == target)
+        {
+            coalesced++;
+            return command;
+        }
+    }
+    if (commandNum >= UI_COMMAND_MAX)
+    {
+        drops++;
+        return NULL;
+    }
+    UiCommand *command = &commands[commandNum++];
+    command->type = type;
+    command->target = target;
+    command->text[0] = '\0';
+    return command;
+}
+
+void UiCommandQueue::run(const UiCommand *command)
+{
+    if (UI_CMD_SHOW_VIEW == command->type)
+    {
+        if (viewLoader)
+            viewLoader(command->view);
+        return;
+    }
+    lv_obj_t *obj = *command->target;
+    if (NULL == obj)
+    {
+        stale++;
+        return;
+    }
+    switch (command->type)
+    {
+    case UI_CMD_SET_TEXT:
+        lv_label_set_text(obj, command->text);
+        break;
+    case UI_CMD_SET_HIDDEN:
+        lv_obj_set_hidden(obj, command->hidden);
+        break;
+    case UI_CMD_SET_BG_COLOR:
+        lv_obj_set_style_local_bg_color(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, lv_color_hex(command->color));
+        break;
+    default:
+        break;
+    }
+}
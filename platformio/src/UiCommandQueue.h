@@ -0,0 +1,71 @@
+#ifndef _UI_COMMAND_QUEUE_H_
+#define _UI_COMMAND_QUEUE_H_
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define UI_COMMAND_MAX 16
+#define UI_COMMAND_TEXT_LEN 160
+
+typedef enum
+{
+    UI_CMD_SET_TEXT = 0,
+    UI_CMD_SET_HIDDEN,
+    UI_CMD_SET_BG_COLOR,
+    UI_CMD_SHOW_VIEW // one view at a time, loaded by the UiViewLoader given to init()
+} UiCommandType;
+
+typedef struct
+{
+    UiCommandType type;
+    lv_obj_t **target; // resolved when applied, the screen may not be built yet
+    union
+    {
+        bool hidden;
+        uint32_t color; // 0xRRGGBB
+        uint8_t view;
+    };
+    char text[UI_COMMAND_TEXT_LEN];
+} UiCommand;
+
+typedef void (*UiViewLoader)(uint8_t view);
+
+// LVGL is not thread-safe: any task posts typed commands here, only the
+// render task applies them. Commands wait until the next frame and a newer
+// one for the same object and type replaces the pending one, so a label
+// rewritten several times in a frame is set (and redrawn) once.
+//
+// Objects are passed by the address of their pointer. The view is switched
+// first, so a screen built on demand exists before its labels are set;
+// commands for objects that still do not exist are dropped.
+class UiCommandQueue
+{
+public:
+    void init(UiViewLoader loader);
+    void setText(lv_obj_t **target, const char *text);
+    void setHidden(lv_obj_t **target, bool hidden);
+    void setBgColor(lv_obj_t **target, uint32_t color);
+    void showView(uint8_t view);
+    bool isPending();
+    uint8_t apply();
+    void reset();
+    void print(Print &out);
+
+private:
+    UiCommand *post(UiCommandType type, lv_obj_t **target);
+    void run(const UiCommand *command);
+
+    UiCommand commands[UI_COMMAND_MAX];
+    UiCommand running[UI_COMMAND_MAX]; // taken out of the lock, so applying may post
+    uint8_t commandNum = 0;
+    UiViewLoader viewLoader = NULL;
+    SemaphoreHandle_t mutex = NULL;
+    uint32_t posted = 0;
+    uint32_t coalesced = 0;
+    uint32_t applied = 0;
+    uint32_t frames = 0;
+    uint32_t drops = 0;
+    uint32_t stale = 0; // target not built
+};
+
+#endif
@@ -1,2033 +0,0 @@
-#include <pgmspace.h>
-#ifndef _FONT_CUSTOME24_H_
-#define _FONT_CUSTOME24_H_
-
-const uint8_t  font_custom24[] PROGMEM = {
-	// 软件生成的字库数据
-	// 请选择需学习的按键再次接收红外信号成功失败
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x4E, 0x60, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE1, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8D, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x9F, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x53, 0xF7, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x16, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x31, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x66, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x62, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xE9, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x09, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xA5, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x65, 0x36, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x21, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x84, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xA2, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x8B, 0xF7, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x25, 
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x17, 
-0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x2E, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x38, 0x0C, 
-0x00, 0xEC, 0xFF, 0x33, 0x00, 0xE6, 0xFF, 0x2D, 0x00, 0xDF, 0xFF, 0x26, 0x00, 0xD9, 0xFF, 0x20, 
-0x00, 0xD3, 0xFF, 0x1A, 0x00, 0xCD, 0xFF, 0x14, 0x00, 0xC6, 0xFF, 0x0D, 0x00, 0xC0, 0xFF, 0x07, 
-0x00, 0xBA, 0xFF, 0x01, 0x00, 0xB4, 0xFB, 0x00, 0x00, 0xAD, 0xF4, 0x00, 0x00, 0xA7, 0xEE, 0x00, 
-0x00, 0x60, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5C, 0x5C, 0x1B, 
-0x04, 0xFF, 0xFF, 0x4C, 0x03, 0xF8, 0xF8, 0x49, 0x09, 0x0C, 0x04, 0x04, 0x0C, 0x08, 0xBF, 0xFF, 
-0x4E, 0x57, 0xFF, 0xB6, 0xAE, 0xFF, 0x3E, 0x47, 0xFF, 0xA6, 0x9C, 0xFF, 0x2D, 0x36, 0xFF, 0x95, 
-0x8B, 0xFF, 0x1D, 0x26, 0xFF, 0x85, 0x7A, 0xFF, 0x0C, 0x15, 0xFF, 0x74, 0x69, 0xFB, 0x00, 0x05, 
-0xFF, 0x64, 0x01, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x38, 0x03, 
-0x00, 0x00, 0x00, 0x34, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF0, 0x01, 0x00, 
-0x00, 0x0E, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xBE, 0x00, 0x00, 0x00, 
-0x41, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x74, 
-0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x55, 0x00, 0x00, 0x00, 0xA8, 0xFB, 
-0x09, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x8C, 0xFF, 0x24, 0x04, 0x04, 0x04, 0xDB, 0xD2, 0x04, 
-0x04, 0x01, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x74, 0x20, 0x94, 0x94, 0x97, 0xFF, 0xDB, 0x94, 0x94, 0x94, 0xB8, 0xFF, 0xB9, 0x94, 0x94, 0x43, 
-0x00, 0x00, 0x00, 0x2D, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x61, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0xB1, 0xF8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x96, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0xE6, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xCB, 0xE5, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xDC, 0xDC, 0xFC, 
-0xF8, 0xDC, 0xDC, 0xDC, 0xE3, 0xFF, 0xEC, 0xDC, 0xDC, 0x97, 0x00, 0xB5, 0xB8, 0xCA, 0xFF, 0xD6, 
-0xB8, 0xB8, 0xB8, 0xE1, 0xFF, 0xC0, 0xB8, 0xB8, 0x7E, 0x00, 0x00, 0x00, 0x65, 0xFF, 0x4A, 0x00, 
-0x00, 0x00, 0xB5, 0xF6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x16, 0x00, 0x00, 
-0x00, 0xE9, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xE1, 0x00, 0x00, 0x00, 0x1E, 
-0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0xAC, 0x00, 0x00, 0x00, 0x53, 0xFF, 
-0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xF8, 0x75, 0x00, 0x00, 0x00, 0x82, 0xF8, 0x27, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCD, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x40, 0xB6, 0xF7, 0xFF, 0xFF, 0xFB, 0xC4, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 
-0xFE, 0xFF, 0xD9, 0xEE, 0xFF, 0xD9, 0xFF, 0xFF, 0x97, 0x01, 0x00, 0x00, 0x40, 0xFE, 0xEC, 0x46, 
-0x00, 0xC8, 0xFF, 0x0C, 0x40, 0xE0, 0xFF, 0x78, 0x00, 0x00, 0xAC, 0xFF, 0x59, 0x00, 0x00, 0xC8, 
-0xFF, 0x0C, 0x00, 0x19, 0xA9, 0x1C, 0x00, 0x00, 0xD6, 0xFF, 0x18, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x39, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xCC, 0x18, 0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0D, 0xCD, 0xFF, 0xF0, 0x8C, 0xD9, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0C, 0x8F, 0xF4, 0xFF, 0xFF, 0xFF, 0xA0, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0E, 0x5D, 0xE7, 0xFF, 0xFF, 0xFF, 0xD6, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xFF, 0x59, 0xC1, 0xFF, 0xF8, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 
-0xFF, 0x0C, 0x01, 0x8A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 
-0x00, 0x07, 0xFB, 0xF5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x01, 
-0xF3, 0xFB, 0x01, 0x0E, 0xAB, 0xAE, 0x04, 0x00, 0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x46, 0xFF, 0xCF, 
-0x00, 0x05, 0xC0, 0xFF, 0xC6, 0x3A, 0x00, 0xC8, 0xFF, 0x10, 0x55, 0xEA, 0xFF, 0x5D, 0x00, 0x00, 
-0x0F, 0xAD, 0xFF, 0xFF, 0xE5, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x46, 0xAE, 0xE7, 0xFF, 0xFF, 0xE3, 0xA5, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 
-0xD4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2F, 0x1A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x38, 0x0B, 0x00, 0x00, 0x00, 0x13, 0xAA, 0xFC, 0xFF, 
-0xFF, 0xC0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xC3, 0x02, 0x00, 0x00, 0x03, 
-0xC8, 0xFC, 0x93, 0x58, 0x7F, 0xF3, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEC, 0xF1, 0x20, 
-0x00, 0x00, 0x00, 0x4B, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x01, 
-0xB8, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xA3, 
-0x00, 0x00, 0x00, 0x6D, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x26, 0x00, 0x00, 
-0x00, 0x02, 0xF7, 0x9D, 0x00, 0x00, 0x29, 0xF6, 0xE3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 
-0xFF, 0x9A, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x5A, 0x00, 0x06, 0xCE, 0xFE, 0x43, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xC6, 0x8B, 0xB1, 0xFF, 0xBD, 0x03, 0x00, 0x89, 0xFF, 0x8D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xCF, 0xF0, 0xDA, 0x81, 0x07, 0x00, 
-0x3F, 0xFD, 0xD2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0F, 0xE1, 0xF8, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0x71, 0x00, 0x00, 0x02, 0x21, 0x27, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xBB, 0x01, 0x00, 0x53, 
-0xDF, 0xFF, 0xFF, 0xEC, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xEF, 0xED, 
-0x1B, 0x00, 0x48, 0xFE, 0xD5, 0x64, 0x5B, 0xB9, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xBE, 0xFF, 0x55, 0x00, 0x00, 0xC8, 0xE9, 0x11, 0x00, 0x00, 0x01, 0xC0, 0xEF, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xFA, 0xA5, 0x00, 0x00, 0x00, 0x00, 
-0x6A, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF9, 0xDE, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xAC, 
-0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x08, 0xD3, 0xFC, 0x3B, 0x00, 0x00, 
-0x00, 0x00, 0xB4, 0xF5, 0x24, 0x00, 0x00, 0x0C, 0xD7, 0xE1, 0x02, 0x00, 0x00, 0x00, 0x90, 0xFF, 
-0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF2, 0xEF, 0x97, 0x8E, 0xDF, 0xFD, 0x51, 0x00, 0x00, 
-0x00, 0x40, 0xF6, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xA8, 0xE7, 0xEC, 0xB9, 
-0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x48, 0x7A, 0x80, 0x51, 0x06, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x24, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDB, 0xFF, 0x9E, 0x3A, 0x36, 0xAB, 0xFF, 0xD0, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x02, 0xCD, 0xFF, 0x3A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0x5B, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0x45, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x41, 0xFB, 0xEA, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD4, 0xFF, 0x5A, 0x11, 0x87, 0xFB, 0xFA, 0x4B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF7, 0xF6, 0xF2, 0xFF, 0xDA, 0x3F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x92, 0xFB, 0xFF, 0xFF, 0x87, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x31, 0xE6, 0xFF, 0xCF, 0x98, 0xFF, 0xDF, 0x18, 0x00, 0x00, 0x00, 0x13, 
-0x5C, 0x0C, 0x00, 0x20, 0xF1, 0xFC, 0x76, 0x01, 0x00, 0x98, 0xFF, 0xCD, 0x0C, 0x00, 0x00, 0x6F, 
-0xFF, 0x72, 0x00, 0x92, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x03, 0xB4, 0xFF, 0xB8, 0x04, 0x02, 0xD5, 
-0xFB, 0x16, 0x00, 0xCD, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xFF, 0x9E, 0x67, 0xFF, 
-0xA6, 0x00, 0x00, 0xD8, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xDE, 0xFF, 0xFA, 0xF3, 
-0x1C, 0x00, 0x00, 0xB7, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0x9A, 
-0x00, 0x00, 0x00, 0x5A, 0xFF, 0xD6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xDD, 0xFF, 0xFE, 0xFB, 
-0x49, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xEA, 0x8C, 0x67, 0x7A, 0xBF, 0xFF, 0xFD, 0x7D, 0x55, 0xFE, 
-0xF4, 0x34, 0x00, 0x00, 0x04, 0x82, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0xB0, 0x30, 0x00, 0x00, 0x71, 
-0xF8, 0xE1, 0x1F, 0x00, 0x00, 0x00, 0x08, 0x35, 0x49, 0x37, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0xC0, 0xFF, 0x4E, 0xAF, 0xFF, 0x3C, 0x9F, 0xFF, 0x2A, 0x8E, 
-0xFF, 0x19, 0x7E, 0xFF, 0x07, 0x6D, 0xF5, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x28, 
-0x11, 0x00, 0x00, 0x00, 0xA3, 0xFE, 0x2B, 0x00, 0x00, 0x25, 0xFC, 0xAD, 0x00, 0x00, 0x00, 0x97, 
-0xFF, 0x38, 0x00, 0x00, 0x04, 0xEB, 0xDF, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x8A, 0x00, 0x00, 0x00, 
-0x8B, 0xFF, 0x41, 0x00, 0x00, 0x00, 0xBE, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0xEF, 0xDA, 0x00, 0x00, 
-0x00, 0x0F, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x98, 
-0x00, 0x00, 0x00, 0x25, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x02, 
-0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x07, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x36, 0x00, 
-0x00, 0x00, 0x58, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x0C, 0xF7, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0xFF, 0x21, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xF4, 0x13, 0x00, 
-0x00, 0x00, 0x2F, 0x70, 0x2A, 0x07, 0x28, 0x17, 0x00, 0x00, 0x00, 0x06, 0xE4, 0xDE, 0x04, 0x00, 
-0x00, 0x00, 0x6F, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x09, 0xF0, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xA3, 
-0xFF, 0x2E, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xC8, 0x00, 0x00, 
-0x00, 0x00, 0xD1, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x7B, 0xFF, 
-0x4D, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x59, 0xFF, 0x6E, 0x00, 0x00, 0x00, 
-0x64, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x76, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x3B, 0x00, 
-0x00, 0x00, 0xC2, 0xFD, 0x0C, 0x00, 0x00, 0x02, 0xF3, 0xD6, 0x00, 0x00, 0x00, 0x35, 0xFF, 0x99, 
-0x00, 0x00, 0x00, 0x8A, 0xFF, 0x45, 0x00, 0x00, 0x00, 0xDE, 0xED, 0x04, 0x00, 0x00, 0x4B, 0xFF, 
-0x87, 0x00, 0x00, 0x00, 0xC7, 0xF3, 0x13, 0x00, 0x00, 0x0E, 0x70, 0x4B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x18, 0x38, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67, 0xFB, 0x00, 0x00, 0x00, 0x01, 
-0xBD, 0x71, 0x5D, 0xEC, 0x1E, 0xB5, 0x5D, 0x0A, 0x8F, 0xF6, 0xEB, 0xF7, 0xF3, 0xD5, 0x4B, 0x00, 
-0x01, 0x6C, 0xFE, 0xFF, 0xDD, 0x25, 0x00, 0x0B, 0xD0, 0xFC, 0xC4, 0xF1, 0xCE, 0xFB, 0x72, 0x00, 
-0x7E, 0x34, 0x5E, 0xF0, 0x04, 0x77, 0x38, 0x00, 0x00, 0x00, 0x65, 0xF2, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x66, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA8, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x24, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x10, 0x10, 0x10, 0x10, 0xAD, 0xFF, 0x31, 0x10, 0x10, 0x10, 0x0A, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x1E, 0x98, 0x98, 0x98, 0x98, 0xDC, 0xFF, 0xA6, 0x98, 
-0x98, 0x98, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA8, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x24, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x34, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x5C, 0x5C, 0x1C, 0x04, 0xFF, 0xFF, 0x50, 0x03, 0xF8, 0xFD, 0x4F, 0x00, 0x00, 0xCA, 0x3E, 0x00, 
-0x36, 0xED, 0x0B, 0x28, 0xED, 0x51, 0x00, 0x00, 0x22, 0x00, 0x00, 0x33, 0x34, 0x34, 0x34, 0x34, 
-0x34, 0x34, 0x15, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x7A, 0x7C, 0x7C, 0x7C, 0x7C, 
-0x7C, 0x7C, 0x32, 0x17, 0x5C, 0x5C, 0x05, 0x40, 0xFF, 0xFF, 0x10, 0x3E, 0xF8, 0xF8, 0x0F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 
-0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF0, 0xE8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 
-0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xE3, 0xF3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x85, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFA, 0x10, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x24, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x6C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFD, 0xCC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 
-0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x53, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0xE6, 0xE4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x6D, 
-0x84, 0x6E, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9B, 0x07, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xD8, 0x5A, 0x31, 0x59, 0xD7, 0xFF, 0xA2, 0x00, 
-0x00, 0x00, 0x41, 0xFF, 0xE0, 0x12, 0x00, 0x00, 0x00, 0x10, 0xDD, 0xFF, 0x46, 0x00, 0x00, 0xB4, 
-0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xBB, 0x00, 0x0B, 0xF8, 0xF0, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0xEA, 0xFB, 0x10, 0x3A, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xAB, 0xFF, 0x43, 0x60, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
-0xFF, 0x6A, 0x74, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x7F, 0x7F, 
-0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x8B, 0x7D, 0xFF, 0x6D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0x88, 0x71, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6E, 0xFF, 0x7C, 0x57, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x8B, 0xFF, 0x62, 0x2F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0x39, 
-0x03, 0xEE, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xF3, 0x07, 0x00, 0x9E, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xA5, 0x00, 0x00, 0x27, 0xFC, 0xF5, 0x37, 0x00, 
-0x00, 0x00, 0x30, 0xF1, 0xFD, 0x2B, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xF7, 0x9D, 0x74, 0x9A, 0xF5, 
-0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xE6, 0xFF, 0xFF, 0xFF, 0xE7, 0x62, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x49, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x35, 0x21, 0x00, 0x01, 0x54, 0xD6, 0xFF, 0x98, 0x46, 0xCD, 0xFF, 0xFF, 0xFF, 0x98, 
-0xD8, 0xFC, 0x9F, 0x62, 0xFF, 0x98, 0x89, 0x29, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 
-0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 
-0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 
-0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 
-0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x41, 0xF8, 0x93, 
-0x00, 0x00, 0x00, 0x27, 0x64, 0x83, 0x74, 0x3E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA7, 0xFD, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x2C, 0x00, 0x00, 0x08, 0xC7, 0xFF, 0xCD, 0x59, 0x32, 0x4E, 0xB7, 
-0xFF, 0xE6, 0x17, 0x00, 0x77, 0xFF, 0xB4, 0x06, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x84, 0x00, 
-0x62, 0xD5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x47, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x55, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xDE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x17, 0xE5, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xC3, 0xFF, 
-0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xBB, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xD3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 
-0xFF, 0xE4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFA, 0xF1, 0x2E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xF0, 0xFA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x1A, 0xE2, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xF4, 0xC0, 
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x24, 0xC5, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-0xF8, 0xF8, 0xF8, 0x2E, 0x0E, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00, 
-0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x1F, 0x7C, 0x7C, 0x7C, 
-0x7C, 0x7C, 0x7C, 0x7C, 0xE7, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 
-0xFF, 0xC4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFE, 0xD4, 0x11, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xF8, 0xE1, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x24, 0xEB, 0xEB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xDA, 0xF4, 0x36, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xDC, 0xB9, 0xA2, 0x5A, 0x06, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xBB, 0xFB, 0xD5, 0xCE, 0xF8, 0xFF, 0xD1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x15, 
-0x1A, 0x00, 0x00, 0x0D, 0x91, 0xFF, 0xD7, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xAA, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xB3, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xCF, 0x00, 0x15, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xBF, 0x6B, 0xFB, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x75, 0xFF, 0x90, 0x1C, 0xF5, 0xF5, 0x47, 0x00, 0x00, 0x00, 0x00, 0x36, 0xF2, 0xFC, 0x2C, 
-0x00, 0x4C, 0xF7, 0xFF, 0xBA, 0x80, 0x74, 0xA7, 0xFB, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x35, 0xC4, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x46, 0x44, 0x25, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x38, 0x33, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFD, 0xFF, 0xEC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0xFF, 0xFE, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xAB, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x11, 0xEA, 0xF4, 0x1D, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 
-0xFF, 0x77, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFD, 0xD7, 0x05, 
-0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0xFF, 0x43, 0x00, 0x00, 0xF4, 
-0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x12, 0xEB, 0xF3, 0x1B, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x98, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x33, 
-0xFD, 0xD5, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x01, 0xC9, 0xFF, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 
-0xE0, 0xE0, 0xE0, 0xFE, 0xFD, 0xE0, 0xE0, 0x26, 0x45, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 
-0xD4, 0xFD, 0xFC, 0xD4, 0xD4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 
-0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xEC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0D, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2E, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x5C, 0xFF, 0xB7, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-0x66, 0x00, 0x00, 0x6E, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x3A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB7, 0xFF, 0x12, 0x00, 0x08, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 
-0xFC, 0x4B, 0xC6, 0xFD, 0xFF, 0xF9, 0xB2, 0x36, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0xFF, 0xED, 0xB3, 
-0xAD, 0xDF, 0xFF, 0xFA, 0x59, 0x00, 0x00, 0xE7, 0xFF, 0x84, 0x06, 0x00, 0x00, 0x01, 0x6A, 0xFD, 
-0xF4, 0x1F, 0x00, 0x0A, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x84, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x15, 0xFF, 0xD4, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0xFF, 0xBF, 0x68, 0xF8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x8A, 0x22, 0xF9, 
-0xF2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x33, 0xF1, 0xFA, 0x26, 0x00, 0x57, 0xFA, 0xFE, 0xB7, 0x7F, 
-0x74, 0xA6, 0xFA, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x40, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x4F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x45, 0x45, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x37, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x67, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEB, 0xFC, 0x2D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFB, 0xEB, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB9, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 
-0xCD, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD5, 0xFE, 0x3D, 0x36, 0x55, 
-0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xDC, 0xDB, 0xFF, 0xFF, 0xFF, 0xF6, 0x91, 
-0x07, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xC4, 0x75, 0x62, 0x86, 0xE7, 0xFF, 0xBF, 0x03, 0x00, 
-0x36, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x12, 0xCE, 0xFF, 0x73, 0x00, 0x78, 0xFF, 0xAF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0x00, 0x9E, 0xFF, 0x57, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0x11, 0xA9, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC6, 0xFF, 0x24, 0x91, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 
-0x0C, 0x54, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xCE, 0x00, 0x06, 0xDE, 
-0xFF, 0x82, 0x01, 0x00, 0x00, 0x00, 0x21, 0xDD, 0xFF, 0x5C, 0x00, 0x00, 0x33, 0xF1, 0xFF, 0xD1, 
-0x84, 0x74, 0x9D, 0xF3, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x23, 0xB3, 0xFC, 0xFF, 0xFF, 0xFF, 
-0xE0, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3B, 0x46, 0x2A, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x0E, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x14, 0x40, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x1F, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-0x7C, 0x7C, 0x7C, 0xF1, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 
-0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x63, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF7, 0xEF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x76, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDE, 0xFE, 0x26, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 
-0xFE, 0xE2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x7A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEE, 0xF9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x63, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 
-0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x15, 0xF9, 0xF0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF8, 0x8E, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x70, 0x85, 0x70, 0x2F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x1B, 0x00, 0x00, 
-0x00, 0x11, 0xDC, 0xFF, 0xBE, 0x51, 0x32, 0x54, 0xC6, 0xFF, 0xD5, 0x0C, 0x00, 0x00, 0x7D, 0xFF, 
-0xAC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0xFF, 0x71, 0x00, 0x00, 0xC0, 0xFF, 0x30, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3D, 0xFF, 0xB3, 0x00, 0x00, 0xCA, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x22, 0xFF, 0xBE, 0x00, 0x00, 0x99, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x8F, 
-0x00, 0x00, 0x23, 0xF6, 0xE5, 0x2D, 0x00, 0x00, 0x00, 0x31, 0xEA, 0xF5, 0x1E, 0x00, 0x00, 0x00, 
-0x42, 0xE7, 0xFB, 0xBA, 0x9A, 0xBB, 0xFC, 0xE7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7C, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x74, 0x06, 0x00, 0x00, 0x00, 0x10, 0xCB, 0xFE, 0xA4, 0x4C, 0x33, 0x4E, 
-0xA9, 0xFF, 0xC2, 0x0C, 0x00, 0x00, 0xB9, 0xFE, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 
-0xAC, 0x00, 0x38, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x2C, 0x75, 
-0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x68, 0x76, 0xFF, 0x78, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0x69, 0x4A, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xD3, 0xFF, 0x3D, 0x03, 0xDA, 0xFF, 0x8D, 0x02, 0x00, 0x00, 0x00, 0x04, 0x97, 
-0xFF, 0xD0, 0x00, 0x00, 0x2C, 0xEE, 0xFF, 0xD8, 0x87, 0x70, 0x89, 0xDC, 0xFF, 0xEA, 0x25, 0x00, 
-0x00, 0x00, 0x1B, 0xA5, 0xF7, 0xFF, 0xFF, 0xFF, 0xF5, 0xA0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0D, 0x36, 0x49, 0x35, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x57, 0x7B, 
-0x7E, 0x5D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x7D, 
-0x02, 0x00, 0x00, 0x8D, 0xFF, 0xE9, 0x73, 0x37, 0x38, 0x75, 0xEA, 0xFF, 0x94, 0x00, 0x39, 0xFF, 
-0xE8, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE6, 0xFF, 0x3C, 0x9D, 0xFF, 0x68, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA1, 0xCD, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-0xFF, 0xD0, 0xDC, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE1, 0xC2, 0xFF, 
-0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xCF, 0x80, 0xFF, 0x94, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x99, 0xFF, 0xA2, 0x1C, 0xF1, 0xFE, 0x6B, 0x01, 0x00, 0x00, 0x05, 0x7E, 0xFF, 
-0xFF, 0x5C, 0x00, 0x51, 0xF8, 0xFF, 0xDA, 0xA5, 0xAD, 0xE9, 0xFF, 0xFF, 0xEE, 0x09, 0x00, 0x00, 
-0x33, 0xB2, 0xF8, 0xFF, 0xFC, 0xBE, 0xB7, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 
-0x08, 0x21, 0xF7, 0xEA, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x6B, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xD4, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0xD6, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
-0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xF0, 0xF9, 0x23, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xF8, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xCC, 
-0xCC, 0x0C, 0x40, 0xFF, 0xFF, 0x10, 0x22, 0x88, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x5C, 0x5C, 0x05, 0x40, 0xFF, 0xFF, 0x10, 0x3E, 0xF8, 
-0xF8, 0x0F, 0x03, 0xCC, 0xCC, 0x3F, 0x04, 0xFF, 0xFF, 0x50, 0x02, 0x88, 0x88, 0x2A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5C, 0x5C, 0x1C, 0x04, 0xFF, 
-0xFF, 0x50, 0x03, 0xF8, 0xFD, 0x4F, 0x00, 0x00, 0xCA, 0x3E, 0x00, 0x36, 0xED, 0x0B, 0x28, 0xED, 
-0x51, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2C, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA1, 0xFD, 0x98, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x15, 0x90, 0xF9, 0xFF, 0xC4, 0x36, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x7F, 
-0xF2, 0xFF, 0xCD, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6E, 0xEA, 0xFF, 0xD5, 0x54, 0x01, 0x00, 
-0x00, 0x00, 0x02, 0x5D, 0xDF, 0xFF, 0xDC, 0x5D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 
-0xF8, 0x69, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE4, 0xFF, 0xD3, 0x50, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x76, 0xEE, 0xFF, 0xCA, 0x46, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x87, 0xF6, 0xFF, 0xC0, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x19, 0x98, 0xFB, 0xFF, 0xB6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x25, 0xAA, 0xFE, 0xFE, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-0xBB, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x27, 0xC0, 
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x81, 0x30, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 
-0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x58, 0x58, 0x58, 0x58, 0x58, 
-0x58, 0x58, 0x58, 0x58, 0x58, 0x3B, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xAC, 0x10, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x35, 0x16, 0x6A, 
-0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xDC, 0x59, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0xF4, 0xFF, 0xCE, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x17, 0x91, 0xF8, 0xFF, 0xBF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1D, 0x9A, 0xFB, 0xFF, 0xAE, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x23, 0xA4, 0xFD, 0xFC, 0x9D, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xC3, 
-0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x97, 0xFA, 0xFE, 0x72, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0x8C, 0xF7, 0xFF, 0xB6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82, 0xF3, 
-0xFF, 0xC6, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x78, 0xEE, 0xFF, 0xD5, 0x50, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x15, 0xE8, 0xFF, 0xE1, 0x61, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEC, 
-0x72, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x5A, 0x7E, 0x7A, 0x4B, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x2F, 0x00, 0x00, 0x66, 0xFF, 0xEF, 
-0x79, 0x3A, 0x48, 0xAA, 0xFF, 0xE4, 0x0D, 0x1A, 0xF2, 0xEF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xAE, 
-0xFF, 0x65, 0x03, 0x5D, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x8C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0xCA, 0xFF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xB3, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xCD, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 
-0xCC, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xEE, 0x17, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 
-0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x98, 0x4D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x5C, 0x51, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x68, 0xF8, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x62, 
-0x80, 0x87, 0x74, 0x47, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 
-0xD0, 0xFF, 0xFF, 0xF1, 0xED, 0xFF, 0xFF, 0xF2, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x8E, 0xFF, 0xD5, 0x62, 0x17, 0x00, 0x00, 0x0B, 0x41, 0xA9, 0xFD, 0xD1, 0x25, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA4, 0xFF, 0x93, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xEC, 
-0xE1, 0x11, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x38, 0xFB, 0xAC, 0x00, 0x00, 0x0D, 0xEF, 0xC5, 0x03, 0x00, 0x00, 0x0D, 0x65, 0x91, 
-0x7E, 0x24, 0x00, 0x3C, 0x1A, 0x00, 0x84, 0xFF, 0x33, 0x00, 0x68, 0xFF, 0x45, 0x00, 0x00, 0x2A, 
-0xE1, 0xFF, 0xF3, 0xF7, 0xF8, 0x58, 0xF0, 0x68, 0x00, 0x1A, 0xFC, 0x8D, 0x00, 0xB3, 0xE4, 0x02, 
-0x00, 0x03, 0xD6, 0xF4, 0x53, 0x01, 0x03, 0x63, 0xF2, 0xFC, 0x68, 0x00, 0x00, 0xC5, 0xC6, 0x00, 
-0xE3, 0xAE, 0x00, 0x00, 0x45, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0x68, 0x00, 0x00, 
-0xA5, 0xE4, 0x00, 0xFA, 0x93, 0x00, 0x00, 0x70, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 
-0x68, 0x00, 0x00, 0x93, 0xE9, 0x01, 0xFD, 0x8A, 0x00, 0x00, 0x6A, 0xFF, 0x46, 0x00, 0x00, 0x00, 
-0x00, 0x58, 0xFF, 0x68, 0x00, 0x00, 0xA9, 0xD3, 0x00, 0xEC, 0xA7, 0x00, 0x00, 0x2D, 0xFF, 0xA6, 
-0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0x7E, 0x00, 0x07, 0xEB, 0x98, 0x00, 0xBF, 0xD6, 0x00, 0x00, 
-0x00, 0xA8, 0xFF, 0xA9, 0x50, 0x54, 0xB8, 0xDC, 0xAF, 0xE8, 0x5D, 0xAD, 0xFB, 0x2B, 0x00, 0x74, 
-0xFF, 0x39, 0x00, 0x00, 0x08, 0x97, 0xFA, 0xFF, 0xFF, 0xCF, 0x27, 0x19, 0xCD, 0xFF, 0xEE, 0x57, 
-0x00, 0x00, 0x13, 0xF3, 0xBD, 0x02, 0x00, 0x00, 0x00, 0x11, 0x36, 0x26, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xA6, 0x0E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFA, 
-0xF3, 0x9B, 0x53, 0x35, 0x26, 0x3F, 0x7A, 0xDC, 0xFD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2C, 0xA1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xB8, 0x52, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2A, 0x46, 0x4A, 0x34, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x32, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFE, 0x1F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFC, 0xDE, 0xF8, 0xD7, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x78, 0xAD, 0xFF, 0x34, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFE, 0x1E, 0x52, 0xFF, 0x91, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xC1, 0x00, 0x07, 0xF0, 0xEA, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x66, 0x00, 0x00, 0x9D, 0xFF, 0x4B, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xF9, 0x11, 0x00, 0x00, 0x42, 0xFF, 0xA7, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x02, 0xE4, 0xF6, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x57, 0x04, 0x04, 0x04, 0x04, 0x8E, 0xFF, 0x61, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xE0, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xEC, 0xFE, 
-0x1D, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x12, 0xF9, 0xE3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFE, 
-0xD4, 0x00, 0x00, 0x00, 0x68, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0xFF, 0x31, 0x00, 0x00, 0xC4, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
-0xFF, 0x8E, 0x00, 0x21, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-0xF9, 0xE7, 0x03, 0x77, 0xF8, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xAA, 0xF8, 0x44, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xB8, 0x44, 0x00, 0x00, 0x00, 0x14, 
-0xFF, 0xE3, 0x88, 0x88, 0x88, 0x8E, 0xA6, 0xE0, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xFA, 0xFD, 0x2A, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x78, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0xFF, 0x8A, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x95, 0xFF, 0x63, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xFA, 
-0xE5, 0x0B, 0x00, 0x14, 0xFF, 0xDE, 0x70, 0x70, 0x70, 0x7A, 0x96, 0xD8, 0xFF, 0xD4, 0x28, 0x00, 
-0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x35, 0x01, 0x00, 0x00, 0x14, 
-0xFF, 0xD8, 0x58, 0x58, 0x58, 0x5C, 0x6D, 0x97, 0xE3, 0xFF, 0xBD, 0x1B, 0x00, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7E, 0xFF, 0xD4, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x4F, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x78, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x96, 0xFF, 0x6C, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 
-0xF0, 0xFF, 0x2F, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x66, 0xE9, 0xFF, 0xAD, 
-0x00, 0x14, 0xFF, 0xF2, 0xC8, 0xC8, 0xC8, 0xCD, 0xE0, 0xFE, 0xFF, 0xFF, 0xA9, 0x0A, 0x00, 0x13, 
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF4, 0xE8, 0xC8, 0x91, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x09, 0x4B, 0x78, 0x86, 0x70, 0x47, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x0E, 0xB8, 0xFF, 
-0xF6, 0x96, 0x58, 0x3C, 0x54, 0xA1, 0xF8, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xB2, 0xFF, 0xCB, 0x19, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD2, 0xFF, 0x51, 0x00, 0x5A, 0xFF, 0xD8, 0x0C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x4A, 0x00, 0x01, 0xDA, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x98, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x82, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x58, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x18, 0xFD, 0xEE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB7, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0xFA, 0xF2, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0x06, 0x00, 0x00, 0x7D, 
-0xFF, 0xEF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF2, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x79, 
-0xFE, 0xFF, 0xD2, 0x94, 0x78, 0x8F, 0xDB, 0xFF, 0xFC, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
-0xBE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xB5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x11, 0x3D, 0x4B, 0x36, 0x11, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 
-0x2A, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD7, 0x81, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xE3, 0x88, 0x88, 0x88, 0x8C, 
-0x9E, 0xC9, 0xFB, 0xFF, 0xE9, 0x44, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x18, 0x92, 0xFE, 0xFD, 0x50, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xEB, 0x18, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x96, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFB, 0xF0, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0x34, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0x5A, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0x6A, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x67, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0x52, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0x25, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xDC, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0x71, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x06, 0x9F, 0xFF, 0xC5, 0x04, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x11, 0x5C, 0xD4, 0xFF, 0xDE, 0x1D, 0x00, 0x00, 0x14, 0xFF, 0xF2, 0xC8, 0xC8, 0xC8, 0xCE, 
-0xE0, 0xFE, 0xFF, 0xFF, 0xA5, 0x0E, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF4, 
-0xE6, 0xC2, 0x88, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x2C, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xCC, 0x00, 0x14, 0xFF, 0xE3, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x6C, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x14, 0xFF, 0xDA, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x19, 0x00, 0x14, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x14, 0xFF, 0xDB, 0x64, 0x64, 
-0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x1A, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xF2, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 
-0xC8, 0xC8, 0x15, 0x13, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x1B, 
-0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x20, 0x14, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x14, 0xFF, 0xE3, 0x88, 0x88, 0x88, 0x88, 0x88, 
-0x88, 0x88, 0x88, 0x4E, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC5, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x14, 0xFF, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
-0xC0, 0xC0, 0xB1, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x4F, 0x79, 0x86, 0x6F, 0x45, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8C, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x62, 
-0x00, 0x00, 0x00, 0x00, 0x15, 0xC6, 0xFF, 0xF5, 0x93, 0x58, 0x3C, 0x54, 0xA4, 0xFA, 0xFF, 0x9F, 
-0x01, 0x00, 0x01, 0xC1, 0xFF, 0xC8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xDD, 0xFF, 0x4F, 
-0x00, 0x66, 0xFF, 0xD6, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x56, 0x00, 0x00, 
-0xD7, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 
-0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0x8C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x66, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0x50, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x85, 0x92, 0xFF, 0x55, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7B, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0F, 0x38, 0x38, 0x38, 0x38, 0xED, 0xF4, 0x5F, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xF4, 0x1A, 0xFE, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xE8, 0xF4, 0x00, 0xC8, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0xF4, 0x00, 0x48, 0xFF, 0xE7, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x32, 0xF7, 0xF3, 0x00, 0x00, 0xA5, 0xFF, 0xE1, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 
-0xF0, 0xFF, 0x6D, 0x00, 0x00, 0x05, 0xA1, 0xFF, 0xFF, 0xC5, 0x8F, 0x77, 0x8F, 0xD7, 0xFF, 0xF6, 
-0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xA5, 0x26, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x41, 0x49, 0x31, 0x0B, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x38, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x38, 0x0A, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 
-0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xD5, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-0x4C, 0x4C, 0x4C, 0x4C, 0xC2, 0xFF, 0x30, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x14, 0xFF, 0xDE, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
-0x70, 0x70, 0xCE, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA8, 0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 
-0xFF, 0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 
-0x30, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x30, 0x13, 0xF8, 
-0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xF8, 0x2E, 0x04, 0x38, 0x2A, 
-0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 
-0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 
-0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 0x14, 0xFF, 0xC4, 
-0x14, 0xFF, 0xC4, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x38, 0x14, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
-0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 
-0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0x54, 0x0F, 0x78, 0x5F, 0x00, 
-0x00, 0x00, 0x00, 0xC3, 0xFF, 0x38, 0x42, 0xFF, 0xE5, 0x17, 0x00, 0x00, 0x37, 0xFF, 0xEF, 0x08, 
-0x00, 0xAD, 0xFF, 0xE5, 0x84, 0x91, 0xF0, 0xFF, 0x7C, 0x00, 0x00, 0x08, 0x9B, 0xFC, 0xFF, 0xFF, 
-0xFB, 0x8B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40, 0x43, 0x12, 0x00, 0x00, 0x00, 0x04, 0x38, 
-0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x38, 0x38, 0x0E, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xCC, 0xFF, 0xA1, 0x02, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x12, 0xCE, 0xFF, 0x9C, 0x02, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x13, 
-0xCF, 0xFF, 0x97, 0x01, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x14, 0xD1, 0xFF, 0x92, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x15, 0xD2, 0xFF, 0x8D, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x16, 0xD4, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x17, 0xD5, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 
-0xD7, 0xD6, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0x79, 0xBF, 0xFF, 
-0xA9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC7, 0x00, 0x10, 0xD5, 0xFF, 0x8A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x1F, 0xE7, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x33, 0xF4, 0xFC, 0x4B, 0x00, 0x00, 
-0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFC, 0xF4, 0x33, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xE7, 0x1F, 0x00, 0x00, 0x14, 0xFF, 
-0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xD5, 0x10, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA7, 0xFF, 0xBE, 0x05, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0xBE, 0xF8, 0x99, 0x04, 0x38, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xF2, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xBB, 
-0x13, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE8, 0x04, 0x38, 0x32, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x38, 0x00, 0x14, 
-0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 
-0xFF, 0x04, 0x14, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x06, 0xDC, 0xFF, 0xFF, 0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x76, 0xFF, 0xFF, 0xFF, 0x04, 0x14, 0xFF, 0xDF, 0xF4, 0xE8, 0x0D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xF1, 0xE8, 0xE8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x7D, 0xFF, 
-0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x64, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 
-0xC4, 0x09, 0xE1, 0xF8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFD, 0xD0, 0x02, 0xD8, 0xFF, 
-0x04, 0x14, 0xFF, 0xC4, 0x00, 0x59, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x42, 
-0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0xC6, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x50, 
-0xFF, 0xB0, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x37, 0xFE, 0xCC, 0x01, 
-0x00, 0x06, 0xDB, 0xFA, 0x25, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0xA4, 0xFF, 0x60, 0x00, 0x74, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x1C, 0xF5, 0xE6, 0x21, 0xF0, 0xEB, 0x10, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEA, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 
-0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE4, 0xFF, 0xD5, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xF8, 
-0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x04, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0xFF, 0x04, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xD8, 0xFF, 0x04, 0x04, 0x38, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0E, 0x38, 0x20, 0x14, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x44, 0xFF, 0x94, 0x14, 0xFF, 0xFF, 0xE7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0xFF, 0x94, 0x14, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 
-0x94, 0x14, 0xFF, 0xCB, 0xD0, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 
-0x14, 0xFF, 0xC4, 0x32, 0xFB, 0xE2, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 
-0xFF, 0xC4, 0x00, 0x86, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 
-0xC4, 0x00, 0x07, 0xD6, 0xFE, 0x42, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x38, 0xFD, 0xDD, 0x0B, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x8E, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x0A, 0xDC, 0xFD, 0x3B, 0x00, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x3F, 0xFE, 0xD8, 0x08, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x96, 0xFF, 0x89, 0x00, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0D, 0xE1, 0xFC, 0x34, 0x44, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x47, 0xFF, 0xD3, 0x4A, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x9F, 0xFF, 0xC6, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-0xE6, 0xFF, 0xFF, 0x94, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 
-0xFF, 0xFF, 0x94, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 
-0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x55, 0x7D, 0x87, 0x75, 0x44, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x91, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x65, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xC6, 0xFF, 0xEF, 0x88, 0x53, 0x3D, 0x5D, 0xA5, 0xFC, 
-0xFF, 0x94, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xBD, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2F, 0xE6, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xCF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x27, 0xF7, 0xF8, 0x27, 0x00, 0x00, 0xD4, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x93, 0x00, 0x25, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE3, 0x01, 0x66, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x25, 0x80, 0xFF, 0x66, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x3F, 0x97, 0xFF, 0x50, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x56, 0x92, 0xFF, 0x55, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x51, 0x7A, 0xFF, 0x6B, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x39, 0x5C, 0xFF, 
-0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1B, 0x16, 
-0xFD, 0xE6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD2, 0x00, 
-0x00, 0xC0, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0x80, 
-0x00, 0x00, 0x3E, 0xFE, 0xE7, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xE9, 
-0x12, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xE2, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x67, 0xFA, 0xFF, 
-0x57, 0x00, 0x00, 0x00, 0x00, 0x03, 0x97, 0xFF, 0xFF, 0xC4, 0x8E, 0x79, 0x98, 0xDD, 0xFF, 0xFA, 
-0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xB4, 
-0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x42, 0x4C, 0x3B, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x24, 0x05, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xB9, 0x49, 0x00, 
-0x00, 0x00, 0x14, 0xFF, 0xE3, 0x88, 0x88, 0x88, 0x8D, 0xA5, 0xDE, 0xFF, 0xFF, 0x91, 0x00, 0x00, 
-0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xF0, 0xFF, 0x60, 0x00, 0x14, 0xFF, 
-0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xCF, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xED, 0xFF, 0x06, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0x11, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0E, 0xF9, 0xF6, 0x01, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x93, 0xFF, 0xB1, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3E, 0xB0, 0xFF, 0xF8, 
-0x30, 0x00, 0x14, 0xFF, 0xFA, 0xE8, 0xE8, 0xE8, 0xEC, 0xFC, 0xFF, 0xFF, 0xE8, 0x46, 0x00, 0x00, 
-0x14, 0xFF, 0xF5, 0xD4, 0xD4, 0xD4, 0xD1, 0xC4, 0xA2, 0x61, 0x0C, 0x00, 0x00, 0x00, 0x14, 0xFF, 
-0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x51, 0x79, 0x83, 0x71, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x09, 0x8F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x61, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x14, 0xC7, 0xFF, 0xF1, 0x8C, 0x57, 0x41, 0x61, 0xA9, 0xFD, 0xFF, 0x91, 
-0x02, 0x00, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xC1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xE8, 
-0xFF, 0x7D, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xD1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2A, 0xF8, 0xF8, 0x26, 0x00, 0x00, 0xD7, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x87, 0xFF, 0x93, 0x00, 0x28, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE3, 0x01, 0x67, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x25, 0x80, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x3F, 0x97, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x56, 0x92, 0xFF, 0x55, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0x53, 0x7A, 0xFF, 0x6B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x40, 0x5D, 0xFF, 0x99, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0x19, 0x18, 0xFE, 0xE5, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x00, 0x27, 0xFF, 0xDA, 0x00, 0x00, 0xC5, 
-0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0xBB, 0x04, 0x9A, 0xFF, 0x7F, 0x00, 0x00, 
-0x45, 0xFF, 0xE7, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0xFF, 0xBC, 0xFE, 0xF2, 0x14, 0x00, 
-0x00, 0x00, 0xA2, 0xFF, 0xE2, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF1, 0xFF, 0xFF, 0x58, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0xA2, 0xFF, 0xFF, 0xC4, 0x8E, 0x78, 0x94, 0xDE, 0xFF, 0xFF, 0xFE, 0x4D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBA, 0x73, 0xFD, 
-0xF4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4A, 0x54, 0x42, 0x13, 0x00, 0x00, 
-0x6E, 0xFF, 0xE4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x8F, 0x6F, 0x00, 0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x20, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xAA, 0x35, 0x00, 0x00, 
-0x00, 0x14, 0xFF, 0xE3, 0x88, 0x88, 0x88, 0x90, 0xAA, 0xE7, 0xFF, 0xFD, 0x6D, 0x00, 0x00, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x68, 0xF9, 0xFD, 0x36, 0x00, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x9D, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xCA, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x22, 0xFF, 0xCF, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x76, 0xFF, 0xA5, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6C, 0xF9, 
-0xFF, 0x3F, 0x00, 0x14, 0xFF, 0xE7, 0x98, 0x98, 0x98, 0x9F, 0xB8, 0xEF, 0xFF, 0xFC, 0x6E, 0x00, 
-0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xA3, 0x37, 0x00, 0x00, 0x00, 0x14, 
-0xFF, 0xCE, 0x2C, 0x2C, 0x2C, 0x36, 0xF0, 0xF1, 0x19, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0xD3, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0xFF, 0xD6, 0x05, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA9, 0xFF, 0x76, 0x00, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF4, 
-0xF4, 0x1D, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xAC, 
-0x00, 0x13, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD6, 0xF7, 0x42, 0x00, 
-0x00, 0x00, 0x00, 0x10, 0x57, 0x79, 0x83, 0x69, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 
-0x8C, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x2F, 0x00, 0x00, 0x00, 0x04, 0xB8, 0xFF, 0xE7, 
-0x7E, 0x45, 0x3E, 0x67, 0xC9, 0xFF, 0xF8, 0x49, 0x00, 0x00, 0x5F, 0xFF, 0xCB, 0x10, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6C, 0xFD, 0xDC, 0x05, 0x00, 0xB5, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x50, 0x18, 0x00, 0x00, 0xCF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5E, 0xFF, 0xE4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0xA6, 0xFF, 0xFC, 0xAA, 0x53, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x63, 0xDC, 0xFF, 0xFF, 0xFA, 0xB9, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x3C, 0x8C, 0xDD, 0xFF, 0xFF, 0xE9, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x34, 0xA4, 0xFE, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x4E, 0xFD, 0xF1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB2, 0xFF, 0x46, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 
-0x55, 0x10, 0xAA, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x32, 0x03, 
-0xBA, 0xFF, 0xBE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x07, 0x94, 0xFF, 0xD0, 0x00, 0x00, 0x12, 0xBE, 
-0xFF, 0xFA, 0xB1, 0x84, 0x77, 0x97, 0xE4, 0xFF, 0xEF, 0x2D, 0x00, 0x00, 0x00, 0x02, 0x6B, 0xD3, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xA5, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3D, 
-0x48, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x2F, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD8, 0x3F, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE0, 0xFF, 0x98, 0x88, 0x88, 0x88, 0x88, 
-0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 
-0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 
-0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x24, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xF8, 0x22, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x38, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 
-0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 
-0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x14, 0xFF, 0xC4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xDC, 0x11, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xD8, 0x01, 0xF9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1E, 0xFF, 0xC1, 0x00, 0xD6, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x5A, 0xFF, 0x9C, 0x00, 0x83, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xFF, 
-0x47, 0x00, 0x19, 0xEC, 0xFE, 0x71, 0x01, 0x00, 0x00, 0x00, 0x07, 0x9E, 0xFF, 0xC5, 0x02, 0x00, 
-0x00, 0x48, 0xF5, 0xFF, 0xD0, 0x87, 0x75, 0x92, 0xE3, 0xFF, 0xDF, 0x21, 0x00, 0x00, 0x00, 0x00, 
-0x2C, 0xB3, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0x98, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x13, 0x37, 0x48, 0x30, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x22, 0x38, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x38, 0x17, 0x66, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0x30, 0x10, 0xF8, 0xEB, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xD4, 0x00, 0x00, 0xAD, 0xFF, 0x4A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x77, 0x00, 0x00, 0x51, 0xFF, 0xA5, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFD, 0x1C, 0x00, 0x00, 0x06, 0xED, 0xF5, 0x0B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x5B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xB6, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0xE7, 0xF6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0xFB, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x46, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x6C, 0x00, 
-0x00, 0x00, 0x00, 0xA1, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xC7, 0x00, 
-0x00, 0x00, 0x09, 0xF2, 0xE9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0x23, 
-0x00, 0x00, 0x57, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x7D, 
-0x00, 0x00, 0xB2, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFB, 0xD8, 
-0x00, 0x12, 0xFA, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 
-0x32, 0x67, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 
-0x8D, 0xC2, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 
-0xF1, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 
-0xFF, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-0xF8, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x38, 0x12, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1C, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x38, 0x24, 
-0x76, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xAE, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x7D, 0x31, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0xF1, 0xFF, 0xF1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0x38, 0x01, 0xEA, 
-0xFA, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0E, 0xFB, 0xEF, 0x03, 0x00, 0xA7, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 
-0x93, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xAC, 0x00, 0x00, 0x62, 0xFF, 0x8F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xF6, 0x13, 0xF8, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 
-0xFF, 0x66, 0x00, 0x00, 0x1D, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFD, 0xB7, 0x00, 0xBB, 
-0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0x21, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x18, 0x00, 
-0x00, 0x00, 0x59, 0xFF, 0x6F, 0x00, 0x73, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xDB, 0x00, 
-0x00, 0x00, 0x00, 0x93, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x27, 0x00, 0x2A, 0xFF, 0xA1, 
-0x00, 0x00, 0x00, 0x5F, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 
-0xE6, 0xDF, 0x00, 0x00, 0x00, 0xE1, 0xE7, 0x01, 0x00, 0x00, 0xA3, 0xFF, 0x50, 0x00, 0x00, 0x00, 
-0x00, 0x0D, 0xFB, 0xE5, 0x00, 0x00, 0x2E, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x2F, 0x00, 
-0x00, 0xE6, 0xFB, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x2A, 0x00, 0x74, 0xFF, 0x4E, 
-0x00, 0x00, 0x00, 0x51, 0xFF, 0x76, 0x00, 0x2C, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7F, 0xFF, 0x6E, 0x00, 0xBB, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0xBE, 0x00, 0x70, 0xFF, 
-0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xB3, 0x0A, 0xF8, 0xBE, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC0, 0xF9, 0x0B, 0xB4, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF1, 
-0xF2, 0x4E, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x51, 0xF3, 0xEF, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xD0, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2F, 0xFF, 0xD2, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 
-0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 
-0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xF8, 0x53, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xF8, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x38, 
-0x38, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x38, 0x38, 0x03, 0x00, 0xB7, 0xFF, 
-0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xAC, 0x00, 0x00, 0x1D, 0xF2, 0xF8, 
-0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF9, 0xEE, 0x18, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xC4, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x6B, 
-0x00, 0x00, 0x00, 0x5C, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xF5, 0xF2, 0x1D, 
-0x00, 0x10, 0xE8, 0xF4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xB4, 0x00, 
-0x96, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC7, 0xFF, 0x8B, 0xFD, 
-0xC6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xF8, 0xFF, 0xF8, 0x29, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0xB5, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFE, 0x3C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xF6, 0x5D, 0xFF, 0xD5, 0x06, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x7E, 0x00, 0xA1, 0xFF, 0x7C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x37, 0xFD, 0xDE, 0x08, 0x00, 0x16, 0xEE, 0xF7, 0x25, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0xD0, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x73, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCA, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x1D, 
-0xF3, 0xF9, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFD, 0xEB, 0x13, 0x00, 0x00, 0xB0, 0xFF, 
-0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xFF, 0x9F, 0x00, 0x48, 0xF7, 0xDE, 0x0B, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE3, 0xF7, 0x3C, 0x21, 0x38, 0x1D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x38, 0x16, 0x41, 0xFF, 0xD7, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF7, 0xF4, 0x1A, 0x00, 0xB0, 0xFF, 0x67, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x7E, 0x00, 0x00, 0x25, 0xFA, 0xE7, 0x0B, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2E, 0xFD, 0xE3, 0x0A, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xB8, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x11, 0xED, 0xF3, 0x16, 0x00, 0x00, 0x00, 0x42, 
-0xFF, 0xCA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x96, 0x00, 0x00, 0x01, 0xCD, 0xFF, 
-0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xD9, 0xFB, 0x26, 0x00, 0x5B, 0xFF, 0xA9, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xAD, 0x06, 0xDF, 0xF8, 0x20, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xA7, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFD, 0xFF, 0xE9, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x8C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 
-0xF8, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xCD, 0xFF, 
-0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF1, 0xFA, 0x2F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xD4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x16, 0xEC, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xAA, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 
-0xDB, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xE7, 0xFE, 0x3E, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xE1, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0C, 0xE1, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x95, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFE, 
-0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDA, 0xFF, 0x4F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFC, 0xFF, 0xD6, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 
-0xC8, 0xC8, 0xC8, 0x54, 0x3A, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-0xF8, 0x68, 0x0C, 0x28, 0x28, 0x28, 0x28, 0x23, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x50, 0xFF, 
-0xB1, 0x6C, 0x6C, 0x60, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 
-0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 
-0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 
-0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 
-0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x8F, 0x2C, 0x2C, 0x27, 
-0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x23, 0x70, 0x70, 0x70, 0x70, 0x63, 0x26, 0x38, 0x0C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xB8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF9, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x57, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEC, 0xF1, 
-0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 
-0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0xE4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 
-0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x71, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xD2, 0xFD, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x31, 0xF8, 0xAB, 0x17, 0x28, 0x28, 0x28, 0x28, 0x18, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 
-0x40, 0x6C, 0x6C, 0x83, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 
-0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 
-0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 
-0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 
-0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 
-0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 
-0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x9C, 0x1A, 0x2C, 0x2C, 0x4D, 
-0xFF, 0x9C, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x42, 0x70, 0x70, 0x70, 0x70, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x1B, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEA, 0xFF, 0x85, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xDA, 0xF8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFC, 
-0xA6, 0x2A, 0xFA, 0xB5, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xF2, 0x19, 0x00, 0x89, 0xFF, 0x4D, 0x00, 
-0x00, 0x5D, 0xFF, 0x72, 0x00, 0x00, 0x0B, 0xE2, 0xDD, 0x07, 0x0E, 0xE7, 0xD3, 0x04, 0x00, 0x00, 
-0x00, 0x52, 0xFF, 0x7D, 0x10, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x2B, 0x1C, 0x1C, 
-0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE0, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x81, 0x00, 
-0x29, 0x00, 0x00, 0x00, 0x96, 0xF8, 0x2D, 0x00, 0x00, 0x4C, 0xFA, 0xD4, 0x08, 0x00, 0x00, 0x53, 
-0xFC, 0x94, 0x00, 0x00, 0x00, 0x5A, 0xBF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xB6, 0xF1, 0xFF, 0xED, 0xAA, 0x2B, 0x00, 0x00, 0x00, 0x9A, 
-0xFF, 0xF6, 0xB5, 0xA3, 0xD2, 0xFF, 0xF5, 0x37, 0x00, 0x00, 0x56, 0xA6, 0x16, 0x00, 0x00, 0x00, 
-0x78, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD8, 0xFF, 0x12, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x01, 0x1C, 0x34, 
-0x3E, 0x40, 0xBB, 0xFF, 0x28, 0x00, 0x1E, 0x9A, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 
-0x24, 0xEB, 0xFF, 0xD6, 0x93, 0x73, 0x67, 0x64, 0xC7, 0xFF, 0x28, 0xA4, 0xFF, 0x79, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB1, 0xFF, 0x28, 0xD7, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE9, 0xFF, 
-0x28, 0xCC, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x05, 0xA2, 0xFF, 0xFF, 0x28, 0x75, 0xFF, 0xE5, 0x77, 
-0x57, 0x78, 0xD7, 0xD8, 0xB3, 0xFF, 0x28, 0x02, 0x87, 0xF8, 0xFF, 0xFF, 0xFD, 0xB0, 0x18, 0x9E, 
-0xF8, 0x26, 0x00, 0x00, 0x10, 0x39, 0x44, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x38, 0x1D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 
-0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x01, 0x64, 
-0xCE, 0xF8, 0xE9, 0xAC, 0x31, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x89, 0xA9, 0xFF, 0xE3, 0xCA, 0xEF, 
-0xFF, 0xF8, 0x53, 0x00, 0x00, 0x40, 0xFF, 0xEE, 0xF3, 0x53, 0x00, 0x00, 0x07, 0x7B, 0xFE, 0xF5, 
-0x20, 0x00, 0x40, 0xFF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x98, 0x00, 0x40, 
-0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF9, 0xEB, 0x00, 0x40, 0xFF, 0x91, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x13, 0x40, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAA, 0xFF, 0x25, 0x40, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xBA, 0xFF, 0x12, 0x40, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEC, 0xEC, 0x00, 
-0x40, 0xFF, 0xFA, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x9E, 0x00, 0x40, 0xFF, 0xFE, 
-0xCC, 0x13, 0x00, 0x00, 0x00, 0x36, 0xED, 0xFB, 0x2D, 0x00, 0x40, 0xFF, 0x99, 0xDE, 0xEC, 0x91, 
-0x7A, 0xAA, 0xFB, 0xFF, 0x78, 0x00, 0x00, 0x3E, 0xF8, 0x83, 0x1A, 0xB4, 0xFE, 0xFF, 0xFF, 0xE6, 
-0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3E, 0x2D, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x09, 0x6F, 0xCD, 0xF1, 0xF4, 0xC3, 0x58, 0x00, 0x00, 0x00, 0x16, 0xCA, 0xFF, 
-0xF0, 0xBC, 0xBF, 0xF7, 0xFF, 0xAE, 0x06, 0x00, 0xB7, 0xFF, 0xA1, 0x0D, 0x00, 0x00, 0x13, 0xAD, 
-0xFF, 0x74, 0x42, 0xFF, 0xC6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61, 0x02, 0x98, 0xFF, 0x4F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD9, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 
-0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x09, 
-0xDD, 0xFC, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x5B, 0x00, 0x3B, 0xF3, 0xFC, 0xA6, 0x66, 
-0x6B, 0xB8, 0xFF, 0xE9, 0x22, 0x00, 0x00, 0x2F, 0xC1, 0xFF, 0xFF, 0xFF, 0xFD, 0xB0, 0x1A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x21, 0x47, 0x48, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0B, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x34, 0xFF, 0x94, 0x00, 0x00, 0x12, 0x88, 0xDF, 0xFC, 0xE7, 0x90, 0x10, 0x34, 0xFF, 0x94, 0x00, 
-0x20, 0xDB, 0xFF, 0xF6, 0xC8, 0xCD, 0xFB, 0xDC, 0x4C, 0xFF, 0x94, 0x01, 0xC3, 0xFF, 0xAF, 0x15, 
-0x00, 0x00, 0x23, 0xCD, 0xEA, 0xFF, 0x94, 0x4B, 0xFF, 0xD0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 
-0xEE, 0xFF, 0x94, 0x9D, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x94, 0xC7, 
-0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x94, 0xDA, 0xFA, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x94, 0xC8, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3C, 0xFF, 0x94, 0xA4, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x94, 0x57, 
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2, 0xFF, 0x94, 0x06, 0xD8, 0xFF, 0x6F, 0x00, 
-0x00, 0x00, 0x01, 0x90, 0xFE, 0xFF, 0x94, 0x00, 0x39, 0xF3, 0xFF, 0xC8, 0x82, 0x82, 0xD0, 0xFD, 
-0x78, 0xFF, 0x94, 0x00, 0x00, 0x33, 0xC9, 0xFF, 0xFF, 0xFF, 0xE1, 0x4B, 0x32, 0xF8, 0x8F, 0x00, 
-0x00, 0x00, 0x00, 0x26, 0x47, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x83, 0xDA, 0xF9, 0xF9, 0xCE, 0x6C, 
-0x04, 0x00, 0x00, 0x00, 0x24, 0xDD, 0xFF, 0xDC, 0xA1, 0xAB, 0xED, 0xFF, 0xB6, 0x04, 0x00, 0x02, 
-0xCA, 0xFF, 0x83, 0x02, 0x00, 0x00, 0x0F, 0xBC, 0xFF, 0x7C, 0x00, 0x4F, 0xFF, 0xBD, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1C, 0xF5, 0xEB, 0x02, 0x9E, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB9, 0xFF, 0x29, 0xC5, 0xFF, 0x85, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xCA, 0xFF, 0x3E, 0xD9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xCC, 0xFE, 0x2D, 0x24, 0x24, 
-0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0xAD, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x62, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0D, 
-0xE3, 0xFE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x33, 0xEE, 0xA3, 0x00, 0x00, 0x42, 0xF5, 0xFD, 0xAA, 
-0x66, 0x64, 0x9E, 0xF9, 0xFB, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xC9, 
-0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x36, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3D, 0x7F, 0x83, 0x4E, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 
-0x00, 0x31, 0xFE, 0xE9, 0x4F, 0x1C, 0x30, 0x00, 0x00, 0x75, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x5C, 
-0xB4, 0xE1, 0xFF, 0xC3, 0xB4, 0xB4, 0x84, 0x81, 0xFC, 0xFE, 0xFF, 0xFC, 0xFC, 0xFC, 0xB9, 0x00, 
-0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x93, 0xF8, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x87, 0xDF, 0xFC, 0xE7, 0x90, 0x10, 0x22, 0xAC, 0x63, 0x00, 
-0x20, 0xDB, 0xFF, 0xF7, 0xC9, 0xCC, 0xFB, 0xDC, 0x4C, 0xFF, 0x94, 0x01, 0xC3, 0xFF, 0xB1, 0x16, 
-0x00, 0x00, 0x21, 0xCB, 0xEA, 0xFF, 0x94, 0x4B, 0xFF, 0xD1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x13, 
-0xEE, 0xFF, 0x94, 0x9D, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x94, 0xC7, 
-0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x94, 0xDA, 0xFA, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x94, 0xC8, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3C, 0xFF, 0x94, 0xA3, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x94, 0x54, 
-0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0x94, 0x05, 0xD5, 0xFF, 0x76, 0x00, 
-0x00, 0x00, 0x00, 0x89, 0xFE, 0xFF, 0x94, 0x00, 0x36, 0xF1, 0xFF, 0xCB, 0x83, 0x81, 0xCC, 0xFD, 
-0x78, 0xFF, 0x94, 0x00, 0x00, 0x31, 0xC7, 0xFF, 0xFF, 0xFF, 0xE1, 0x4B, 0x34, 0xFF, 0x93, 0x00, 
-0x00, 0x00, 0x00, 0x25, 0x47, 0x33, 0x03, 0x00, 0x3C, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x68, 0x00, 0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC1, 0xFF, 0x27, 0x2C, 0xFD, 0xE8, 0x4D, 0x00, 0x00, 0x00, 0x06, 0x8C, 0xFF, 0xB4, 0x00, 0x00, 
-0x6B, 0xF9, 0xFF, 0xDC, 0xAB, 0xAE, 0xE8, 0xFF, 0xD9, 0x19, 0x00, 0x00, 0x00, 0x2A, 0x98, 0xE0, 
-0xFB, 0xFA, 0xD6, 0x82, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0E, 0x38, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x04, 0x72, 
-0xD6, 0xFC, 0xF4, 0xB3, 0x2D, 0x00, 0x00, 0x40, 0xFF, 0x8C, 0xBB, 0xF1, 0xAF, 0xA0, 0xDC, 0xFF, 
-0xF4, 0x30, 0x00, 0x40, 0xFF, 0xF2, 0xBE, 0x12, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xC0, 0x00, 0x40, 
-0xFF, 0xF0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE9, 0xFE, 0x10, 0x40, 0xFF, 0xA5, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0x2F, 0x40, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x91, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x3E, 0xF8, 0x83, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x8B, 0xF8, 0x36, 0x04, 0x73, 0x57, 0x00, 0x4A, 0xFF, 0xFF, 0x19, 0x1E, 
-0xD8, 0xBC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB1, 0x8F, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 
-0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 
-0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 0xFC, 0xCC, 0x00, 0x00, 
-0xFC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFF, 
-0x1D, 0x00, 0x00, 0x00, 0x19, 0xD5, 0xC1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xAB, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 
-0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xC7, 0x00, 0x00, 0x00, 0x00, 
-0x62, 0xFF, 0xA4, 0x00, 0x4B, 0xA6, 0xB4, 0xFD, 0xFF, 0x41, 0x00, 0x52, 0xFA, 0xFF, 0xE2, 0x61, 
-0x00, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x38, 0x1D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 
-0x00, 0x00, 0x39, 0xB3, 0xAF, 0x24, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x3F, 0xF3, 0xF9, 0x51, 
-0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x45, 0xF6, 0xF6, 0x48, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 
-0x4C, 0xF8, 0xF3, 0x40, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x53, 0xFA, 0xF0, 0x39, 0x00, 0x00, 
-0x00, 0x00, 0x40, 0xFF, 0xCF, 0xFC, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 
-0xFB, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xDE, 0x28, 0xC5, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x18, 0xE4, 0xFC, 0x43, 0x00, 0x00, 0x00, 0x40, 0xFF, 
-0x88, 0x00, 0x00, 0x36, 0xF8, 0xEC, 0x21, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x5F, 
-0xFF, 0xD1, 0x0B, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAA, 0x00, 0x3E, 
-0xF8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBA, 0xF8, 0x73, 0x0E, 0x38, 0x1D, 0x00, 0x00, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 
-0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 
-0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 
-0x40, 0xFF, 0x88, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x3F, 0xFF, 0x8C, 0x00, 0x00, 0x2A, 
-0xFF, 0xE8, 0x81, 0x19, 0x00, 0xA4, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x15, 0x2B, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x2D, 0xB4, 0x5F, 0x0A, 0x8C, 0xEA, 0xF9, 0xC6, 0x3B, 0x00, 0x00, 0x26, 0xA7, 0xED, 0xFD, 
-0xD9, 0x6A, 0x00, 0x00, 0x40, 0xFF, 0x8F, 0xC6, 0xE4, 0xA3, 0xB1, 0xFA, 0xF6, 0x36, 0x35, 0xEF, 
-0xE1, 0xA2, 0xB1, 0xF9, 0xFF, 0x7E, 0x00, 0x40, 0xFF, 0xF6, 0xAC, 0x08, 0x00, 0x00, 0x3A, 0xFB, 
-0xC8, 0xD9, 0xA3, 0x05, 0x00, 0x00, 0x37, 0xFA, 0xF9, 0x17, 0x40, 0xFF, 0xEE, 0x12, 0x00, 0x00, 
-0x00, 0x00, 0x9F, 0xFF, 0xED, 0x10, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x5C, 0x40, 0xFF, 0xAD, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x7B, 
-0x40, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x45, 0xFF, 0x84, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x8C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x44, 0xFF, 0x84, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 
-0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x84, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x84, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x84, 0x40, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0xFF, 0x84, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x8C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x44, 0xFF, 0x84, 0x3E, 0xF8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xF8, 0x87, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2D, 0xB4, 0x5F, 0x04, 0x72, 0xD6, 0xFC, 0xF4, 0xB3, 0x2D, 0x00, 0x00, 
-0x40, 0xFF, 0x8C, 0xBB, 0xF1, 0xAF, 0xA0, 0xDC, 0xFF, 0xF4, 0x30, 0x00, 0x40, 0xFF, 0xF2, 0xBE, 
-0x12, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xC0, 0x00, 0x40, 0xFF, 0xF0, 0x12, 0x00, 0x00, 0x00, 0x00, 
-0x0C, 0xE9, 0xFE, 0x10, 0x40, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0x2F, 
-0x40, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 
-0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x38, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x90, 0xFF, 0x38, 0x3E, 0xF8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xF8, 0x36, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x80, 
-0xD8, 0xF9, 0xF3, 0xCA, 0x65, 0x03, 0x00, 0x00, 0x00, 0x21, 0xD9, 0xFF, 0xE6, 0xAE, 0xB6, 0xF3, 
-0xFF, 0xB5, 0x09, 0x00, 0x02, 0xC5, 0xFF, 0x8C, 0x05, 0x00, 0x00, 0x13, 0xBA, 0xFF, 0x8C, 0x00, 
-0x4B, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE5, 0xFB, 0x13, 0x9C, 0xFF, 0x45, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0xC5, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x44, 0xFF, 0x88, 0xD9, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x9D, 
-0xCC, 0xFE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0x8F, 0xAD, 0xFF, 0x30, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x71, 0x64, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xCA, 0xFF, 0x27, 0x0E, 0xE6, 0xFB, 0x48, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB8, 0x00, 
-0x00, 0x48, 0xF8, 0xFD, 0xA6, 0x69, 0x71, 0xC0, 0xFF, 0xE5, 0x20, 0x00, 0x00, 0x00, 0x3A, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFC, 0xAE, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x43, 0x3D, 0x16, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x2D, 0xB4, 0x5F, 0x01, 0x68, 0xD2, 0xFB, 0xED, 0xB0, 0x34, 0x00, 0x00, 0x00, 0x40, 0xFF, 
-0x89, 0xA9, 0xFF, 0xDD, 0xC2, 0xEA, 0xFF, 0xF9, 0x56, 0x00, 0x00, 0x40, 0xFF, 0xED, 0xF3, 0x4F, 
-0x00, 0x00, 0x05, 0x78, 0xFE, 0xF5, 0x20, 0x00, 0x40, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x85, 0xFF, 0x98, 0x00, 0x40, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF7, 
-0xEB, 0x00, 0x40, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x13, 0x40, 
-0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x25, 0x40, 0xFF, 0x87, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x12, 0x40, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0xE9, 0xEC, 0x00, 0x40, 0xFF, 0xFA, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 
-0xFF, 0x9E, 0x00, 0x40, 0xFF, 0xFE, 0xCB, 0x11, 0x00, 0x00, 0x00, 0x35, 0xED, 0xFB, 0x2D, 0x00, 
-0x40, 0xFF, 0x99, 0xE0, 0xEB, 0x91, 0x7A, 0xAA, 0xFB, 0xFF, 0x78, 0x00, 0x00, 0x40, 0xFF, 0x88, 
-0x1E, 0xBA, 0xFF, 0xFF, 0xFF, 0xE6, 0x62, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x1B, 
-0x3E, 0x2D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 
-0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x61, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x84, 0xDB, 0xFA, 0xE3, 0x8C, 
-0x0E, 0x24, 0xB4, 0x68, 0x00, 0x1E, 0xD8, 0xFF, 0xF9, 0xD0, 0xD5, 0xFD, 0xD9, 0x4A, 0xFF, 0x94, 
-0x01, 0xC1, 0xFF, 0xB5, 0x1A, 0x00, 0x00, 0x29, 0xD2, 0xE7, 0xFF, 0x94, 0x49, 0xFF, 0xD2, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x17, 0xEF, 0xFF, 0x94, 0x9C, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x89, 0xFF, 0x94, 0xC6, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0x94, 
-0xD9, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x94, 0xC9, 0xFF, 0x09, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x94, 0xA5, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x6D, 0xFF, 0x94, 0x58, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0x94, 
-0x07, 0xD9, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0x94, 0x00, 0x39, 0xF3, 0xFF, 
-0xC5, 0x7E, 0x7D, 0xCA, 0xFE, 0x7D, 0xFF, 0x94, 0x00, 0x00, 0x33, 0xC9, 0xFF, 0xFF, 0xFF, 0xE2, 
-0x4F, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x26, 0x47, 0x33, 0x03, 0x00, 0x34, 0xFF, 0x94, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x34, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x94, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xBC, 0x6C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x2D, 0xB4, 0x5F, 0x00, 0x26, 0x9E, 0xE7, 0xA7, 0x40, 0xFF, 0x88, 0x49, 
-0xF3, 0xFF, 0xFA, 0x97, 0x40, 0xFF, 0xB0, 0xF2, 0xA8, 0x37, 0x01, 0x00, 0x40, 0xFF, 0xFF, 0x73, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x91, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xA1, 0xE8, 0xFF, 0xF1, 0xBD, 0x50, 
-0x00, 0x00, 0x00, 0x24, 0xED, 0xFF, 0xCF, 0xA2, 0xB5, 0xF8, 0xFF, 0x95, 0x00, 0x00, 0xA3, 0xFF, 
-0x71, 0x00, 0x00, 0x00, 0x1C, 0xC9, 0xFF, 0x46, 0x00, 0xD8, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x14, 0x53, 0x00, 0x00, 0xC7, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-0xFE, 0xFE, 0xAB, 0x50, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xD4, 0xFF, 0xFF, 0xFA, 
-0xBC, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x7F, 0xC6, 0xFE, 0xFF, 0xA4, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xDD, 0xFF, 0x50, 0x00, 0x0C, 0x22, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x64, 0xFF, 0x7D, 0x0F, 0xE3, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x5C, 
-0x00, 0x7F, 0xFF, 0xF0, 0x8F, 0x5C, 0x61, 0xA5, 0xFF, 0xDF, 0x0B, 0x00, 0x00, 0x5D, 0xDC, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xBB, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x46, 0x45, 0x1B, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x59, 0xA8, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x5C, 0xB4, 0xDC, 0xFF, 0xC8, 0xB4, 0xB4, 0xA8, 0x81, 0xFC, 0xFE, 0xFF, 0xFD, 0xFC, 0xFC, 
-0xEC, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x49, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x68, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFC, 0xF2, 0x6C, 0x40, 
-0x41, 0x00, 0x00, 0x00, 0x75, 0xFC, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x24, 0x5B, 0x66, 
-0x2B, 0x43, 0xB4, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xB4, 0x10, 0x60, 0xFF, 0x68, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x18, 0x60, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB0, 0xFF, 0x18, 0x60, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 
-0x18, 0x60, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x18, 0x60, 0xFF, 0x68, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x18, 0x60, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB0, 0xFF, 0x18, 0x60, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 
-0x18, 0x5C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x18, 0x45, 0xFF, 0xA9, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF6, 0xFF, 0x18, 0x0F, 0xF7, 0xFC, 0x36, 0x00, 0x00, 0x00, 
-0x04, 0xA9, 0xFF, 0xFF, 0x18, 0x00, 0x8B, 0xFF, 0xF6, 0x8A, 0x59, 0x6E, 0xCD, 0xCE, 0xB9, 0xFF, 
-0x18, 0x00, 0x04, 0x90, 0xFB, 0xFF, 0xFF, 0xFC, 0xA7, 0x12, 0xAA, 0xF8, 0x17, 0x00, 0x00, 0x00, 
-0x12, 0x43, 0x43, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xB4, 0x28, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1F, 0xB4, 0x84, 0x66, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 
-0x68, 0x0E, 0xF5, 0xE5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xF5, 0x0E, 0x00, 0xA1, 0xFF, 
-0x47, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xA1, 0x00, 0x00, 0x3E, 0xFF, 0xA6, 0x00, 0x00, 0x00, 
-0x00, 0x9B, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0xDB, 0xF6, 0x0E, 0x00, 0x00, 0x08, 0xF0, 0xD9, 0x00, 
-0x00, 0x00, 0x00, 0x79, 0xFF, 0x63, 0x00, 0x00, 0x58, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x1A, 
-0xFC, 0xC2, 0x00, 0x00, 0xB7, 0xFB, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFE, 0x22, 0x19, 
-0xFC, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0x80, 0x75, 0xFF, 0x4C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0xE9, 0xDE, 0xD6, 0xE5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x8D, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xF7, 0xF7, 
-0x23, 0x00, 0x00, 0x00, 0x00, 0x85, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xB4, 0x59, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB4, 0x69, 0x76, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0xE7, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0x4D, 0x21, 0xFF, 0xC8, 0x00, 0x00, 
-0x00, 0x00, 0x37, 0xFF, 0xEF, 0xFC, 0x13, 0x00, 0x00, 0x00, 0x02, 0xEA, 0xF1, 0x07, 0x00, 0xCC, 
-0xFE, 0x17, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x65, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xA4, 
-0x00, 0x00, 0x77, 0xFF, 0x64, 0x00, 0x00, 0x00, 0xD1, 0xD1, 0x06, 0xF2, 0xAC, 0x00, 0x00, 0x00, 
-0x89, 0xFF, 0x50, 0x00, 0x00, 0x22, 0xFF, 0xB2, 0x00, 0x00, 0x1F, 0xFF, 0x84, 0x00, 0xAB, 0xF3, 
-0x07, 0x00, 0x00, 0xD7, 0xF3, 0x08, 0x00, 0x00, 0x00, 0xCD, 0xF6, 0x09, 0x00, 0x6C, 0xFF, 0x38, 
-0x00, 0x5E, 0xFF, 0x48, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x4E, 0x00, 
-0xBA, 0xE9, 0x02, 0x00, 0x13, 0xFC, 0x96, 0x00, 0x73, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x23, 
-0xFF, 0x9D, 0x0D, 0xF9, 0x9E, 0x00, 0x00, 0x00, 0xC3, 0xE4, 0x00, 0xC2, 0xF4, 0x09, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCF, 0xE9, 0x56, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x46, 0xFC, 0xA9, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xD8, 0xF8, 0x0C, 0x00, 0x00, 0x00, 0x28, 0xFF, 
-0xDB, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xDA, 0xFF, 0xF5, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xF8, 0x69, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xF8, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x28, 0xB3, 0xA1, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x1B, 0xB2, 0xA3, 0x06, 0x00, 0xA0, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 
-0xB1, 0xFF, 0x5C, 0x00, 0x00, 0x0D, 0xDE, 0xFA, 0x30, 0x00, 0x00, 0x57, 0xFF, 0xAC, 0x00, 0x00, 
-0x00, 0x00, 0x3C, 0xFC, 0xD1, 0x05, 0x12, 0xE9, 0xE8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 
-0xFF, 0x83, 0xA0, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCC, 0xFC, 0xFF, 0x9C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFB, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0xE7, 0xFB, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0xFF, 0x5A, 0xC6, 0xFE, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xAE, 0x00, 0x28, 0xF7, 
-0xE2, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xEC, 0x17, 0x00, 0x00, 0x76, 0xFF, 0xA4, 0x00, 0x00, 
-0x02, 0xC1, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x03, 0xC9, 0xFF, 0x56, 0x00, 0x6E, 0xF8, 0xAD, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2B, 0xF2, 0xE5, 0x17, 0x82, 0xB4, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x11, 0xB3, 0xA3, 0x64, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0x94, 
-0x0C, 0xF3, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x31, 0x00, 0x9C, 0xFF, 0x5C, 
-0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0xCE, 0x00, 0x00, 0x38, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 
-0x7F, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xD3, 0xFE, 0x1E, 0x00, 0x00, 0x00, 0xDB, 0xF7, 0x11, 0x00, 
-0x00, 0x00, 0x70, 0xFF, 0x7D, 0x00, 0x00, 0x39, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 
-0xDD, 0x01, 0x00, 0x96, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x3E, 0x06, 0xEC, 
-0xDE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x9F, 0x50, 0xFF, 0x7D, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0xDE, 0xF3, 0xBC, 0xFD, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7B, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFC, 0xFF, 0x54, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0xEB, 0x06, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xDB, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xC8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xAE, 0xBA, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB4, 0xB4, 0xB4, 
-0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x5F, 0x17, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 
-0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFE, 0xE3, 0x14, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1B, 0xEB, 0xFB, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xFF, 
-0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xB6, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x48, 0xFE, 0xE3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xEB, 0xFB, 0x3C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x88, 0xFF, 0xB7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFE, 0xE4, 0x14, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xEB, 0xFF, 0xB7, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x73, 
-0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x08, 0x2C, 0x2C, 0x2C, 0x2C, 
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x17, 0x00, 0x00, 
-0x00, 0x00, 0x2E, 0xC4, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x0C, 0xE8, 0xFF, 0xC0, 0x65, 0x00, 0x00, 
-0x00, 0x57, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x82, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0xE3, 0xE9, 0x03, 0x00, 0x00, 0x15, 0x52, 0xC4, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x68, 0xFF, 
-0xFC, 0x57, 0x00, 0x00, 0x00, 0x00, 0x37, 0xA7, 0xF6, 0xEA, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2A, 0xF8, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x89, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x65, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFB, 0xF2, 0x78, 0x32, 0x00, 0x00, 
-0x00, 0x00, 0x63, 0xF8, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x54, 0x4B, 0x0A, 0x28, 
-0x15, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 
-0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 
-0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 
-0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x88, 
-0x1C, 0x70, 0x3B, 0x0E, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xDF, 0x5D, 0x00, 
-0x00, 0x00, 0x00, 0x38, 0xA9, 0xFA, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xA2, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xCC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xCE, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 
-0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xF1, 0xE5, 0x67, 0x29, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0xDB, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFF, 0xBC, 0x64, 0x00, 0x00, 0x00, 0x80, 0xFF, 
-0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xF2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xD4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xCC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xAF, 
-0x00, 0x00, 0x00, 0x1B, 0x60, 0xD7, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xA4, 0x02, 
-0x00, 0x00, 0x00, 0x2C, 0x5F, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xAF, 0xC6, 0x7D, 
-0x11, 0x00, 0x00, 0x3D, 0x87, 0x0E, 0x27, 0xF0, 0xFA, 0xEB, 0xFF, 0xF2, 0x94, 0x7A, 0xEB, 0xE2, 
-0x09, 0x75, 0xEE, 0x24, 0x00, 0x3C, 0xBE, 0xFF, 0xFF, 0xDF, 0x2D, 0x00, 0x00, 0x18, 0x00, 0x00, 
-0x00, 0x00, 0x29, 0x3F, 0x08, 0x00, 0x00, 0x3D, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
-0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x61, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x0D, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0xFF, 0x94, 
-0x00, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x37, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xA7, 0xDF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x41, 0xFF, 0x84, 0x00, 0x00, 0x01, 0x6F, 0xF7, 0xFD, 0x8D, 0x07, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xCF, 0xFF, 
-0xD4, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x06, 0x8A, 0xFE, 0xFA, 0x7D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x6D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xE7, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 
-0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x91, 0x06, 0x00, 0x07, 0x5A, 
-0x8C, 0x00, 0x74, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x8A, 0xEB, 0xFF, 0xE8, 0x00, 0x7F, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0x55, 0xBC, 0xFE, 0xFF, 0xEA, 0x8A, 0x23, 0x00, 0x89, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x24, 0x89, 0xE9, 0xFF, 0xFF, 0xC0, 0x59, 0x06, 0x00, 0x00, 0x00, 0x93, 0xFF, 0x44, 0x00, 0x00, 
-0x06, 0x58, 0xBD, 0xFE, 0xFF, 0xEF, 0x90, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 
-0x39, 0x24, 0x8A, 0xEB, 0xFF, 0xFF, 0xC9, 0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA8, 0xFF, 0x2F, 0x96, 0xFF, 0xF4, 0x9B, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x22, 0x34, 0x6E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE4, 0xFD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xF0, 0xF0, 0xF0, 0xF4, 0xFF, 0xFF, 0xFF, 0x58, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xC4, 0xC4, 0xC4, 0xC3, 0xB7, 0x95, 
-0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xF6, 0x3A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAD, 0xF8, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xB3, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0xB6, 0x33, 0x5C, 0x5C, 0x5C, 0x5C, 
-0x5C, 0x5C, 0xD2, 0xFB, 0x61, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x3C, 0x00, 0x00, 0x00, 0x60, 0xFF, 
-0x5C, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xA8, 0x00, 0x00, 0x00, 0xC6, 0xF1, 0x09, 0x1D, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 
-0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x22, 0x00, 0x00, 0x2D, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0xFF, 0xA8, 0x00, 0x00, 0x1F, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-0x77, 0x00, 0x00, 0x00, 0x21, 0xFB, 0xFF, 0xA8, 0x00, 0x00, 0x2E, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 
-0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xAF, 0x00, 0x00, 0x00, 0xA3, 0xFE, 0xF9, 0xA8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0xFE, 0x99, 0xE4, 0xA8, 0x00, 0x00, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-0x08, 0x08, 0x06, 0x00, 0x00, 0xA4, 0xEB, 0x12, 0xE4, 0xA8, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x60, 0x60, 0x00, 0xE4, 0xA8, 
-0x00, 0x00, 0x16, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x56, 0x00, 
-0x00, 0x09, 0x01, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x0D, 0x68, 
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xE4, 0xA8, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x20, 0xFF, 0x80, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x10, 0x10, 0x10, 0xCB, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 
-0x20, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xD0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x20, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x20, 0xFF, 0xA6, 0x58, 
-0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0xDB, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 
-0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xE4, 0xA8, 0x00, 0x00, 0x20, 0xFF, 0x84, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0xCD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5E, 0x00, 0x00, 0x10, 0x84, 
-0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6B, 0x00, 0x00, 0x00, 0x9E, 0xB8, 
-0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 
-0xB8, 0xA6, 0x00, 0x00, 0xA5, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF3, 0xC0, 
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xEA, 
-0xED, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF9, 
-0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xF5, 0xF7, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xF8, 0xC0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xCC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xD4, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB4, 0xE3, 0x38, 0x38, 0x38, 0x38, 0x38, 0xD1, 0xD7, 0x38, 0x38, 0x38, 0x38, 0x38, 0xDD, 0xC0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x3C, 0x3C, 
-0x3C, 0x3C, 0x3C, 0xD2, 0xD8, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xDE, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD4, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 
-0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xC0, 0x00, 0x00, 0x00, 0x5E, 0xC4, 0xC4, 0xEE, 0xF7, 
-0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xF1, 0xF3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xF5, 0xF1, 0xC4, 0xC4, 
-0x5B, 0x60, 0xC8, 0xC8, 0xEF, 0xF8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 
-0xC8, 0xC8, 0xF6, 0xF2, 0xC8, 0xC8, 0x5D, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xC0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xE5, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x74, 0x74, 0x78, 0xAB, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE5, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x05, 0x2C, 0x2C, 0x2A, 0x1D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xB3, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xF0, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x84, 0x84, 0x84, 0x84, 0x84, 
-0x84, 0x84, 0x52, 0x00, 0x00, 0x00, 0xF6, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFD, 0xA2, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x18, 0x2A, 0xFF, 0x93, 0x18, 0x18, 0x0F, 0x45, 0x48, 0x49, 
-0xFF, 0xB9, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x13, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 
-0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x55, 0x58, 0x64, 0xFF, 0xB4, 0x58, 0x58, 0x58, 0x58, 
-0x9B, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 
-0x84, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x28, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0x2F, 0x00, 0x00, 0x00, 
-0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x7A, 
-0xFF, 0x27, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x56, 
-0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x67, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x14, 
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 
-0x0F, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xE6, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA0, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x99, 0x52, 0x90, 0xC8, 0x01, 
-0x1A, 0xFE, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFD, 0x00, 0x00, 0x27, 0x61, 0xA1, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE7, 0x13, 0x8F, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF3, 0x00, 
-0x8B, 0xFF, 0xFF, 0xFF, 0xD7, 0x9B, 0x60, 0x23, 0x00, 0x23, 0xF8, 0xD3, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC1, 0xE7, 0x00, 0x47, 0x8F, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x09, 0xCB, 0xFF, 
-0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0xAF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xB5, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0xFF, 0xC1, 0x06, 0x00, 0x02, 0xBA, 0xC0, 0xC3, 0xD4, 
-0xFC, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xCB, 0x0E, 0x00, 0x00, 
-0x00, 0xAF, 0xD8, 0xD7, 0xCF, 0xB6, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-0x8E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x7E, 
-0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x7E, 0xFF, 0x70, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x70, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x44, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0xFF, 0x78, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x78, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x24, 0x24, 0x24, 0x24, 
-0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x55, 0x86, 0xE8, 0xE8, 0xE8, 0xED, 0xFF, 
-0xF5, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0x91, 
-0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x3A, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xCC, 0xFF, 0x85, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x12, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 
-0xF4, 0xF4, 0xFD, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFD, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xEB, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0A, 0xFE, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x88, 0x88, 0x88, 0x88, 0x8C, 0xA3, 0xF0, 
-0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0C, 0x14, 0x14, 0x14, 0x14, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 
-0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEC, 0xC1, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3A, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0xFB, 
-0x63, 0x60, 0x60, 0x60, 0x60, 0x3C, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x3C, 0xFF, 0x60, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x58, 0x44, 0x44, 0x44, 0x57, 
-0xFF, 0x90, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 
-0xB8, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x59, 0x00, 0x3C, 0xFF, 0xA4, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x21, 0x00, 0x3C, 
-0xFF, 0xFF, 0xBD, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF7, 0xF4, 0x16, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xE6, 0x00, 0x00, 0x3C, 0xFF, 0xC9, 0xFF, 0xDB, 0x27, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0xFF, 0xFF, 0xE8, 0x47, 0x00, 0x00, 0x1F, 0xFE, 0x96, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x5D, 0xFA, 
-0xEF, 0x43, 0x00, 0x00, 0x3C, 0xFE, 0xB9, 0x5D, 0xF4, 0xFE, 0x8C, 0x06, 0x77, 0xFF, 0x40, 0x00, 
-0x00, 0x3C, 0xFF, 0x60, 0x00, 0x42, 0xF0, 0xFA, 0x60, 0x00, 0x74, 0xF6, 0x22, 0x00, 0x28, 0xD5, 
-0xFD, 0x39, 0xDD, 0xE4, 0x02, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x2D, 0xE5, 0xFF, 0x49, 
-0x00, 0x3E, 0x00, 0x00, 0x00, 0x0C, 0x5B, 0x64, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 
-0x00, 0x00, 0x00, 0x1F, 0xAD, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0xE7, 0x08, 
-0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xA2, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF7, 0xE8, 0x16, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3C, 0xF2, 0xF7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xF6, 0xF9, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFD, 0xF6, 0x4A, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0F, 0xDD, 0xEA, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x60, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x21, 0x90, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3E, 0x07, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x1D, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x91, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x97, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xED, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 
-0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFB, 
-0xF4, 0xF4, 0xF4, 0xF4, 0xFB, 0xFF, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xEC, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC5, 0xF4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xE3, 0xFF, 0xB8, 0xB4, 0xB4, 0xB4, 
-0xB4, 0xB4, 0xB4, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xA4, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFA, 
-0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x14, 0xCB, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB5, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xB8, 
-0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xEC, 0xFF, 0xB9, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 
-0xB8, 0xB8, 0xB8, 0x14, 0x25, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 
-0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xF0, 0xD9, 0x05, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 
-0xBE, 0x5E, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2A, 0xEC, 0xF5, 0x25, 0x01, 0xC0, 0xFC, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xE9, 0xFE, 0x52, 0x00, 0x00, 0x1C, 0xE6, 
-0xF7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6F, 0xF8, 0xFC, 
-0x5E, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xE9, 0xFE, 0x8C, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x39, 0xC7, 0xFF, 0xED, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xD0, 0xFF, 0xE1, 
-0x5F, 0x04, 0x00, 0x00, 0x00, 0x39, 0xB0, 0xFF, 0xFF, 0xB5, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x86, 0xFA, 0xFF, 0xDE, 0x77, 0x14, 0x11, 0xF0, 0xFF, 0xD6, 0x4E, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xA6, 0xFD, 0xFC, 0x29, 
-0x00, 0x58, 0x53, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x21, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x29, 
-0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 
-0xE0, 0x0B, 0x00, 0x00, 0x00, 0xCA, 0xEC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xA1, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x43, 0xFF, 0x8C, 0x00, 0x00, 
-0x00, 0x00, 0xA7, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFB, 0x30, 0x00, 
-0x00, 0x00, 0xB9, 0xF9, 0x22, 0x00, 0x00, 0x4F, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2A, 0xD7, 0x44, 0x00, 0x00, 0x00, 0x30, 0xB0, 0x2D, 0x00, 0x16, 0xE8, 0xDB, 0x0C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-0xCC, 0xCC, 0xE2, 0xFF, 0xE4, 0xCC, 0xCC, 0xCC, 0x7F, 0x00, 0x00, 0x98, 0xFF, 0xC5, 0xC4, 0xC4, 
-0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xFF, 0xA0, 0x00, 
-0x00, 0x98, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x98, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x79, 0xCC, 0x06, 
-0x63, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x5C, 0x06, 0xD0, 
-0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 
-0xE8, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xD6, 0xF7, 0x81, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xB1, 0xFF, 0xB4, 0x22, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xF8, 
-0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 
-0x3C, 0x3C, 0x3C, 0x3C, 0x9E, 0xFF, 0x60, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x16, 
-0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x1A, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-0xA6, 0xFF, 0x6A, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x2C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x87, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0E, 0x44, 0x44, 0x44, 0x54, 0xE0, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x4C, 0x50, 0x50, 0x4A, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x60, 0x1D, 0x00, 0x00, 
-0x3F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3A, 0xFF, 0x57, 0x00, 0x2F, 0xFE, 0xA7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0x69, 0x00, 0x00, 0x6D, 0xFE, 0xB4, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFF, 0x7D, 
-0x00, 0x00, 0x00, 0x66, 0xFE, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-0x4C, 0x4C, 0x4C, 0x4D, 0xFE, 0xB1, 0x4C, 0x4C, 0x4C, 0x4C, 0x7A, 0x4C, 0x4C, 0x14, 0x00, 0x00, 
-0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x74, 0xFF, 0x63, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
-0xDB, 0xD7, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x15, 0x00, 0x00, 0x74, 0xFF, 0x1C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x74, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xF8, 0x00, 0x00, 
-0x00, 0x00, 0x95, 0x68, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x76, 0xFF, 0x1B, 0x00, 0x00, 0x17, 0xFB, 0x92, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x00, 0x4F, 0xFF, 0x41, 0x00, 0x00, 0x78, 0xFF, 0x32, 
-0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xA2, 0x98, 0x98, 0x98, 0xCE, 0xFF, 0x10, 0x00, 0x26, 0xFF, 
-0x6C, 0x00, 0x04, 0xE2, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x15, 0x00, 0x00, 0x00, 
-0x8C, 0xFF, 0x05, 0x00, 0x03, 0xF5, 0x9E, 0x00, 0x6C, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x83, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x96, 0xFA, 0x00, 0x00, 0x00, 0xC2, 0xD7, 0x11, 0xEC, 0xD3, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xEE, 0x00, 0x00, 
-0x00, 0x88, 0xFF, 0xA9, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xE7, 0x00, 0x00, 
-0x00, 0x00, 0xA9, 0xE2, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x21, 0x03, 
-0x00, 0x00, 0xCE, 0xCA, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xD1, 0x00, 0x00, 0x00, 0x23, 0xFF, 0xF2, 
-0x15, 0x00, 0x00, 0x00, 0xC4, 0xAD, 0x00, 0x07, 0xF7, 0xA1, 0x00, 0x00, 0x00, 0x16, 0xEE, 0xB0, 
-0x00, 0x00, 0x1A, 0xDB, 0xFF, 0xFE, 0x2A, 0x00, 0x00, 0x00, 0xEE, 0x88, 0x00, 0x44, 0xFF, 0x62, 
-0x66, 0xDC, 0xE0, 0xFA, 0xFF, 0x63, 0x00, 0x19, 0xD6, 0xFE, 0x85, 0xFC, 0xAB, 0x00, 0x00, 0x1E, 
-0xFF, 0x55, 0x00, 0xA1, 0xFF, 0x1B, 0x3E, 0xC8, 0xC5, 0xB3, 0x68, 0x01, 0x30, 0xE3, 0xFF, 0x67, 
-0x00, 0x9B, 0xFF, 0x53, 0x00, 0x66, 0xFF, 0x1D, 0x17, 0xF6, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3A, 0xF3, 0xFA, 0x60, 0x00, 0x00, 0x0E, 0xDD, 0xF9, 0x9F, 0xEB, 0xCE, 0x00, 0x87, 0xFF, 
-0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xC1, 0x43, 0x00, 0x00, 0x00, 0x00, 0x25, 0xDA, 
-0xFF, 0xEF, 0x3E, 0x00, 0x08, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x31, 0xF4, 
-0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
-0xFF, 0x00, 0x00, 0x00, 0x23, 0xFD, 0xE4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFD, 0xD6, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x5A, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x91, 0xFF, 0x4D, 0x00, 0x00, 0x2A, 0xC4, 0xC4, 0xE2, 0xFF, 0xC4, 0xC4, 0x65, 
-0x00, 0x03, 0xB9, 0xF8, 0x49, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x2C, 0xCC, 
-0xCC, 0xE6, 0xFF, 0xCC, 0xCC, 0x69, 0x00, 0x00, 0x0E, 0xC6, 0xFD, 0x7C, 0x0A, 0x97, 0xFF, 0xA5, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
-0xA8, 0xFF, 0xF1, 0xFE, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0D, 0x6B, 0xD6, 0xFF, 0xFB, 0xFF, 0xC5, 0x63, 0x13, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x03, 0x16, 0x67, 0xB3, 0xF6, 0xFF, 0xC6, 0x53, 0x0D, 0x72, 
-0xD8, 0xFF, 0xFD, 0xC7, 0x86, 0x2E, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x71, 0xE1, 0x60, 0xFF, 0xDF, 
-0x8A, 0x2D, 0x00, 0x34, 0x78, 0x0D, 0x00, 0x35, 0x86, 0xCE, 0xFD, 0x4C, 0x00, 0x00, 0x20, 0xBA, 
-0xFF, 0xFF, 0xCF, 0x25, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x11, 0x04, 0x32, 0xAE, 0xFC, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x72, 
-0xFF, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x01, 0x00, 0x68, 0xF7, 0x9A, 0xA4, 0xFF, 0x00, 0x00, 0x00, 
-0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x14, 0x15, 
-0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x52, 0x6C, 0x6C, 0x6C, 0x6C, 0xAC, 0xFF, 0x7C, 0x6C, 0x6C, 
-0x6C, 0x6C, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x70, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x9C, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDC, 0xFF, 0xC7, 
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x5A, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x00, 0x00, 0x92, 0xB4, 0xB4, 
-0xB4, 0xB4, 0xB4, 0xD5, 0xFF, 0xBC, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x54, 0x00, 0x00, 0x00, 0x8C, 
-0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3F, 0x8C, 0x95, 0xF1, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xF4, 0xF2, 0xDD, 0x64, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x88, 0x0E, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x1C, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xE5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0x55, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x54, 
-0x54, 0x54, 0x54, 0x71, 0xFF, 0xC6, 0x54, 0x54, 0x54, 0x54, 0x48, 0x00, 0x00, 0x00, 0x00, 0x88, 
-0xFF, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDC, 0x00, 0x25, 0xB8, 0xB8, 0xDE, 0xFF, 0xB8, 0xB8, 0x45, 0xC4, 0xCA, 0x28, 0x28, 0x28, 0x28, 
-0x28, 0x28, 0x28, 0x28, 0x28, 0xBF, 0xDC, 0x00, 0x2C, 0xDC, 0xDC, 0xEF, 0xFF, 0xDC, 0xDC, 0x52, 
-0xC4, 0xC0, 0x00, 0x00, 0x5D, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xDC, 0x00, 0x00, 0x00, 
-0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0xAE, 0xAB, 0x00, 0x15, 0xFD, 0xAC, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xA0, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x4D, 0xB5, 0x36, 0xBC, 0xBC, 0xBC, 0xFA, 0xEF, 0xBC, 0xBC, 0xBC, 
-0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x58, 0x00, 0x00, 0x16, 0xB2, 0xFF, 0xFF, 0xEE, 0x4A, 0xC8, 0xC8, 
-0xE8, 0xFF, 0xCC, 0xC8, 0xC8, 0xC8, 0xC8, 0xF3, 0xF8, 0xC8, 0xC8, 0x5D, 0x37, 0xA9, 0xFA, 0xFF, 
-0xFF, 0x63, 0x0A, 0x00, 0x00, 0x01, 0xD8, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xB3, 0x00, 
-0x00, 0x00, 0x80, 0xF6, 0x9E, 0xAD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x63, 0x00, 0x00, 
-0x00, 0x00, 0x4A, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x19, 0x12, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xBF, 0xED, 0x07, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFA, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0xE3, 0xFF, 0xBC, 0x34, 0x00, 0x00, 0x46, 0xFF, 0xA1, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x7E, 0xF4, 
-0xFE, 0xA5, 0x3A, 0xE6, 0xF2, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x9D, 0xFD, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0xF1, 0xFF, 0xFF, 
-0xE1, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x55, 0xD0, 0xFF, 0xE2, 0x3F, 0x68, 0xF1, 0xFF, 0xB6, 0x21, 0x00, 0x00, 0x26, 0x64, 0x71, 0xE4, 
-0xF1, 0x00, 0x00, 0x2F, 0x85, 0xE5, 0xFF, 0xF6, 0x85, 0x0D, 0x00, 0x00, 0x1B, 0xB2, 0xFF, 0xF5, 
-0x74, 0x03, 0x40, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x4C, 0xFF, 0xFF, 0xE4, 0x7C, 0x15, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x57, 0xE9, 0xE7, 0x10, 0x06, 0x34, 0x32, 0x1C, 0x00, 0x00, 0x04, 0x96, 
-0x47, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x37, 0x00, 0x00, 0x00, 
-0x00, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x37, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xD6, 0xEE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xCE, 0xFF, 0xEB, 
-0xC4, 0xC4, 0xC4, 0xC4, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 0xA8, 0xA8, 
-0xE6, 0xEF, 0xA8, 0xA8, 0xA8, 0xA8, 0xB2, 0xFF, 0xCC, 0xA8, 0x85, 0x00, 0x3D, 0xB4, 0xB4, 0xE8, 
-0xF8, 0xB4, 0xB4, 0x32, 0x00, 0x00, 0x88, 0xF6, 0x06, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x3C, 0x00, 
-0x00, 0x00, 0x47, 0xD0, 0xD0, 0xF1, 0xFB, 0xD0, 0xD0, 0x3A, 0x00, 0x00, 0x4B, 0xFF, 0x3D, 0x00, 
-0x00, 0x00, 0x8B, 0xF1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0F, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0xD3, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xB0, 0xE8, 0x00, 0x00, 0x62, 0x7C, 0x7C, 0x7C, 0xEC, 0xD4, 0x7C, 0x7C, 0x81, 0xFF, 0xB9, 
-0x7C, 0x7C, 0x7C, 0x36, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0xC2, 0xF4, 0xF4, 0xF4, 0xF4, 
-0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0x6A, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x22, 
-0x89, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x5D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0xC1, 0xFD, 0xFE, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x2D, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x95, 0xEE, 0xFF, 0xF8, 0x7A, 0x1C, 0x0C, 0x0C, 0x0C, 
-0x10, 0xE9, 0xC1, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0xC1, 0xF5, 0xA1, 0xCE, 
-0xE8, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x84, 0x30, 0x0C, 0x00, 0xB0, 0xE8, 0x00, 0x0E, 0x54, 0x54, 0x5A, 0xF6, 0xC9, 0x54, 0x54, 
-0x54, 0x54, 0x5D, 0xFB, 0xBC, 0x54, 0x54, 0x2B, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 
-0x00, 0x74, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 0x13, 0xEF, 0xF1, 0x60, 0x08, 0x00, 0x00, 0x17, 0xEA, 0xB6, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 0x00, 0x00, 0x05, 0x54, 0xB9, 0xFE, 
-0xEC, 0x89, 0x30, 0xC8, 0xE6, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xE8, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x90, 0xFB, 0xFF, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB5, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x69, 0xD1, 0xFF, 0xD3, 0xE8, 
-0xFF, 0xC0, 0x44, 0x00, 0x00, 0x00, 0x45, 0x70, 0x82, 0xF6, 0xD3, 0x00, 0x10, 0x49, 0x83, 0xC7, 
-0xFC, 0xFF, 0xD0, 0x5F, 0x02, 0x0A, 0x73, 0xE9, 0xFF, 0xC8, 0x4B, 0x00, 0x7D, 0xFF, 0xFF, 0xF6, 
-0x62, 0x00, 0x75, 0xFF, 0xFF, 0xD8, 0x89, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x75, 0xEA, 
-0xF7, 0x19, 0x0C, 0x20, 0x1B, 0x05, 0x00, 0x00, 0x1C, 0x5F, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x18, 
-0x00, 0x00, 0x00, 0x00, 0x33, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xEA, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x00, 0x1C, 
-0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00, 
-0xF0, 0x9C, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x01, 0xDB, 0xFB, 0x56, 0x50, 0x50, 
-0x50, 0x50, 0x50, 0x50, 0x50, 0x23, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 
-0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x94, 0xF4, 0x00, 
-0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0xC1, 0xFA, 0x6A, 0x64, 0x64, 0x64, 0x64, 0x99, 0xFF, 0x8A, 
-0x64, 0x2B, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x44, 0xFF, 0xF3, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x79, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 
-0x04, 0xD1, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x94, 
-0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x79, 0xFF, 0x94, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0xD4, 
-0xC4, 0x00, 0x00, 0x00, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0xCA, 0xCB, 0x04, 0xD9, 
-0xB2, 0x00, 0x00, 0x00, 0x15, 0xFE, 0x84, 0x00, 0x00, 0x00, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 
-0xF0, 0x9C, 0x1D, 0x22, 0x00, 0x8B, 0xF7, 0x11, 0x00, 0x00, 0x5C, 0xFF, 0x42, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x79, 0x00, 0x00, 
-0xBC, 0xEA, 0x06, 0x00, 0x00, 0x00, 0x00, 0x94, 0xF4, 0x00, 0x00, 0x01, 0xF1, 0x9C, 0x00, 0x00, 
-0x00, 0x00, 0xC1, 0xE8, 0x0E, 0x2A, 0xFE, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xF4, 0x05, 
-0x60, 0xD6, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x95, 0xB7, 0xF9, 0x22, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAB, 0xFB, 0xE3, 0xFF, 0xE7, 0xFB, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 
-0xFE, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF7, 0xFF, 0xD7, 0x64, 0x07, 0xF0, 0x9C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x4F, 0x01, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x26, 0xE7, 0xF6, 0xFC, 0xE9, 0x2C, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x00, 0x00, 0x00, 0x38, 
-0xEB, 0xFA, 0x49, 0x5F, 0xFE, 0xF0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xF0, 0x9C, 0x00, 0x00, 0x6A, 0xF8, 0xF4, 0x48, 0x00, 0x00, 0x60, 0xFB, 0xFC, 0x78, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0x1A, 0xB2, 0xFF, 0xDF, 0x32, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0xEE, 0xFF, 0xBF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9C, 0xBF, 0xFF, 
-0xB0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xCA, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x7B, 0x50, 0x35, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5D, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 
-0xF8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFA, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFB, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFA, 0xAD, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x5C, 0x00, 
-0x00, 0x00, 0x00, 0x7D, 0xFF, 0x8D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x39, 0x00, 
-0x00, 0x00, 0x10, 0xEB, 0xE7, 0x0F, 0x00, 0x00, 0x06, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0x8E, 0x00, 0x00, 0x6C, 0xFF, 
-0x82, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6B, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0xD4, 0xCC, 0x04, 0x0A, 0xE7, 0xDC, 0x04, 0x00, 0x3A, 0x60, 0x02, 0x00, 0x00, 0x00, 0x9D, 0xFB, 
-0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x02, 0x00, 0x87, 0xFF, 0x5D, 0x00, 0x00, 0x9E, 0xFF, 
-0x04, 0x00, 0x00, 0x1F, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFB, 
-0xC6, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0x01, 0x00, 0x00, 0x97, 0xFD, 0x27, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x22, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x07, 0x00, 0x06, 0xE1, 
-0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC6, 0xFF, 0x2E, 0x00, 0x00, 0x0A, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0xA5, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE9, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x76, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xB9, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xED, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x85, 0xFF, 0xBB, 0xFE, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 
-0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF2, 0xD6, 0x15, 0xF5, 0xAB, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0x54, 0x00, 
-0x8D, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xE4, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x78, 0xFF, 0xB1, 0x00, 0x00, 0x0A, 0xD7, 0xF3, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFE, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x31, 0xF7, 0xEB, 
-0x30, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x32, 0x00, 0x00, 0x0B, 0x9F, 0xFF, 0xDC, 0x1C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x47, 0xF7, 0xF3, 0x51, 0x00, 0x00, 0x0B, 0xF3, 0xD8, 0x00, 0x00, 0x3F, 
-0xDA, 0xFF, 0xC5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xF5, 0xFE, 0x99, 0x0E, 
-0x07, 0x65, 0x61, 0x00, 0x15, 0xF4, 0xFD, 0x8A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2A, 0xD2, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x37, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x75, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x79, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2A, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xDE, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 
-0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFD, 0x13, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7C, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x90, 0x90, 0xF2, 
-0xF1, 0x90, 0x90, 0x90, 0x5E, 0x00, 0x01, 0xDA, 0xFA, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x4E, 
-0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x9C, 0x74, 0xFF, 0x2A, 0x18, 0x18, 0x18, 0x18, 0xEA, 0xA8, 0x00, 0xC0, 0xF2, 
-0x2E, 0x24, 0x24, 0x24, 0x24, 0x26, 0xFF, 0x95, 0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 
-0xA8, 0x4A, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x8E, 0x74, 0xFF, 0x14, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0xA8, 0xD1, 0xF0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0x86, 
-0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA8, 0x27, 0x5C, 0x12, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x19, 0xFF, 0x7D, 0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA8, 0x00, 0x14, 0xDF, 
-0x8B, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x75, 0x74, 0xFF, 0x40, 0x30, 0x30, 0x30, 0x30, 0xEC, 
-0xA8, 0x00, 0x00, 0xA6, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x6D, 0x74, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x0D, 0xDB, 0xF3, 0x25, 0x00, 0x00, 0x31, 0xFF, 0x65, 
-0x74, 0xFF, 0x82, 0x78, 0x78, 0x78, 0x78, 0xF3, 0xA8, 0x00, 0x00, 0x00, 0x34, 0xFA, 0xCD, 0x06, 
-0x00, 0x3A, 0xFF, 0x5C, 0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA8, 0x00, 0x00, 0x00, 
-0x00, 0x7B, 0xFF, 0x5B, 0x00, 0x43, 0xFF, 0x53, 0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 
-0xA8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x48, 0x00, 0x00, 0x4D, 0xFF, 0x4A, 0x74, 0xFF, 0x14, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0x42, 
-0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5D, 0xFF, 0x39, 0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x30, 0x74, 0xFF, 0xDB, 0xD8, 0xD8, 0xD8, 0xD8, 0xFC, 
-0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0x1C, 0x74, 0xFF, 0xD3, 0xD0, 
-0xD0, 0xD0, 0xD0, 0xD0, 0x88, 0x00, 0x00, 0x00, 0x64, 0xB4, 0xB4, 0xB7, 0xD9, 0xFF, 0xDE, 0x01, 
-0x74, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFC, 0xFC, 0xFB, 
-0xEF, 0xC1, 0x34, 0x00, 0x32, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x27, 0xFC, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xF5, 0x1A, 0x00, 0x00, 0x10, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFE, 0x82, 
-0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
-0x00, 0x00, 0x01, 0xCB, 0xE9, 0x0D, 0x00, 0x00, 0x00, 0x68, 0x94, 0x94, 0x94, 0x94, 0xEB, 0xED, 
-0x94, 0x94, 0x94, 0x94, 0x6F, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x60, 0x00, 0x00, 0x74, 0x65, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xF3, 0xC2, 
-0x01, 0x00, 0x20, 0xF7, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0xCD, 0xF6, 0x3D, 0x33, 0x4D, 0xBD, 0xFC, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8A, 
-0x70, 0x55, 0x50, 0xF4, 0xDE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBA, 0xFE, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x8B, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x49, 0xFC, 0xC9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF3, 0xE7, 0x2C, 0x33, 0x55, 0x78, 0x26, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFC, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x94, 0xD0, 0xAE, 0x8B, 0x69, 0x46, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x35, 0x60, 0x8C, 0xB7, 0xE3, 0x6F, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFC, 0xD9, 0x89, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xE7, 0xE9, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x34, 
-0x67, 0xDC, 0xB0, 0x85, 0x5A, 0x2F, 0x07, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0D, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xE7, 0xD7, 0x08, 0x00, 0x00, 0x3D, 
-0x44, 0x44, 0x44, 0x44, 0x44, 0xE5, 0xCB, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x00, 
-0x51, 0xFF, 0x8F, 0x00, 0x00, 0xE4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 
-0xFC, 0xFC, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xAB, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xDC, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEF, 0xC9, 
-0x00, 0x0C, 0x58, 0x58, 0x58, 0x58, 0x58, 0xE8, 0xD0, 0x58, 0x58, 0x58, 0x58, 0x58, 0x26, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x46, 0x17, 0x00, 0x1E, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xFA, 0xF5, 0xDC, 
-0xDC, 0xDC, 0xDC, 0xDC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDC, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x5C, 0x5C, 0x5C, 
-0x25, 0x00, 0x41, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xEA, 0xD4, 0x64, 0x64, 0x64, 0x64, 0x64, 
-0x64, 0x46, 0x7C, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x8D, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 
-0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x97, 0x19, 0x34, 0x50, 0xFF, 0x68, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x24, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x6A, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 
-0x74, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x68, 0x00, 0x00, 0x00, 0xEC, 0xF0, 0xD8, 0xD8, 
-0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xF6, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x68, 0x00, 
-0x00, 0x00, 0xEC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xD0, 0x00, 0x00, 
-0x00, 0x00, 0x24, 0xFF, 0x68, 0x00, 0x00, 0x00, 0xEC, 0xC9, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 
-0x74, 0x74, 0xDD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x68, 0x00, 0x00, 0x00, 0xEC, 0xEB, 
-0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 
-0x68, 0x00, 0x0B, 0x00, 0xEC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xD0, 
-0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x68, 0x42, 0xB9, 0x00, 0xEC, 0xD1, 0x88, 0x88, 0x88, 0x88, 
-0x88, 0x88, 0x88, 0x88, 0xE2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xB1, 0xF8, 0xC8, 0x00, 
-0xEC, 0xE7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xD0, 0x00, 0x00, 0x00, 0x00, 
-0x30, 0xFF, 0xFF, 0xBC, 0x0E, 0x00, 0xEC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC0, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xA6, 0x06, 0x00, 0x00, 0xEC, 0x9C, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x14, 0x14, 0x26, 0xE3, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x01, 0x00, 
-0x00, 0x00, 0xEC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0xF5, 0x54, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x30, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2C, 
-0x2C, 0x25, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x16, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x51, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x5F, 0x00, 0x00, 0x00, 0xD1, 
-0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFE, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 
-0xFB, 0x88, 0x00, 0x00, 0x1F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x88, 0x00, 0x00, 0x7F, 0xFF, 0x6C, 0x44, 0x44, 0x44, 
-0x44, 0x44, 0x44, 0x1C, 0x00, 0x74, 0xF4, 0x00, 0x12, 0x80, 0x20, 0x00, 0xE0, 0x88, 0x00, 0x02, 
-0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x74, 0xF4, 0x00, 0x24, 0xFF, 
-0x40, 0x00, 0xE0, 0x88, 0x00, 0x57, 0xFF, 0x87, 0x48, 0x48, 0x48, 0x48, 0xF2, 0xB3, 0x48, 0x1E, 
-0x00, 0x74, 0xF4, 0x00, 0x24, 0xFF, 0x40, 0x00, 0xE0, 0x88, 0x01, 0xD3, 0xFF, 0x1B, 0x00, 0x00, 
-0x00, 0x0E, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 0x24, 0xFF, 0x40, 0x00, 0xE0, 0x88, 
-0x61, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x33, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 
-0x24, 0xFF, 0x40, 0x00, 0xE0, 0xA1, 0xEF, 0xDF, 0xF7, 0x6F, 0x00, 0x00, 0x00, 0x66, 0xFF, 0x1F, 
-0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 0x24, 0xFF, 0x40, 0x00, 0xE0, 0xBB, 0xF8, 0x47, 0xC5, 0xB0, 
-0x00, 0x00, 0x00, 0xA2, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 0x24, 0xFF, 0x40, 0x00, 
-0xE0, 0x88, 0x2F, 0x00, 0x85, 0xF0, 0x06, 0x00, 0x02, 0xE5, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0xF4, 0x00, 0x24, 0xFF, 0x3F, 0x00, 0xE0, 0x88, 0x00, 0x00, 0x34, 0xFF, 0x55, 0x00, 0x40, 0xFF, 
-0x52, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 0x2E, 0xFF, 0x37, 0x00, 0xE0, 0x88, 0x00, 0x00, 
-0x00, 0xD6, 0xBF, 0x00, 0xA5, 0xED, 0x06, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF4, 0x00, 0x40, 0xFF, 
-0x28, 0x00, 0xE0, 0x88, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x6A, 0xFD, 0x8B, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x74, 0xF4, 0x00, 0x6C, 0xFF, 0x0E, 0x00, 0xD5, 0x81, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFF, 
-0xF1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0xBE, 0xFF, 0xB2, 0x06, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 
-0xFF, 0x9D, 0xF6, 0xB3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFC, 0xF3, 0xFF, 0x5F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x15, 0xDE, 0xDB, 0x06, 0x49, 0xFA, 0xAA, 0x02, 0x00, 0x00, 0x4B, 0xF8, 
-0xD8, 0x1B, 0xC8, 0xFC, 0x59, 0x00, 0x00, 0x00, 0x00, 0x12, 0xCF, 0xF8, 0x34, 0x00, 0x00, 0x58, 
-0xFE, 0x84, 0x00, 0x6A, 0xFB, 0xDB, 0x1D, 0x00, 0x15, 0xD4, 0xFD, 0x70, 0x00, 0x00, 0x2D, 0xDD, 
-0xF9, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x58, 0x24, 0xA0, 0xFF, 0xCD, 0x19, 0x00, 0x00, 0x00, 0x16, 
-0xCD, 0xFF, 0x9D, 0x09, 0x92, 0xEF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xA9, 
-0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xB1, 0xFF, 0x8E, 0x05, 0x22, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x15, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x3C, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-0x1B, 0x00, 0x00, 0xB4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x4A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xB7, 0x00, 0x00, 0xB4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0E, 0xD9, 0xEF, 0x24, 0x00, 0x00, 0x00, 0x35, 0xFF, 0x6C, 0x00, 0x00, 0xB4, 
-0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xF5, 0xD0, 0x09, 0x00, 0x00, 
-0x85, 0xFF, 0x8B, 0x70, 0x70, 0xD5, 0xE2, 0x70, 0x70, 0x70, 0x70, 0x70, 0x28, 0x00, 0x00, 0x00, 
-0x00, 0x5E, 0xFF, 0x95, 0x00, 0x05, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x30, 0x00, 0x62, 0xFF, 0x62, 0x0C, 0x0C, 
-0x0C, 0xB7, 0xCE, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0xD7, 0xE6, 0x06, 0x00, 0x00, 0x00, 0xB4, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x70, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xCC, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xE8, 0xE8, 0xE8, 0xB1, 0x00, 0x27, 0x40, 0x40, 0x40, 
-0x40, 0x40, 0x40, 0xC7, 0xD9, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x0E, 0x46, 0xA0, 0xA0, 0xEB, 
-0xC4, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x38, 0x00, 0x00, 0x00, 0xC8, 0xC4, 0x00, 0x27, 0x40, 0x40, 0x40, 0xA7, 0xFF, 0x41, 0x40, 
-0x67, 0xFF, 0x70, 0x40, 0x40, 0x40, 0x40, 0x0E, 0x00, 0x00, 0x00, 0xC8, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x95, 0xF3, 0x00, 0x00, 0x34, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC8, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xD7, 0x00, 0x00, 0x34, 0xFF, 0x40, 0x00, 
-0x00, 0x2D, 0x93, 0x11, 0x00, 0x00, 0x00, 0xC8, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEF, 0x9E, 
-0x00, 0x00, 0x34, 0xFF, 0x40, 0x00, 0x00, 0x47, 0xFF, 0x23, 0x00, 0x00, 0x00, 0xC8, 0xC4, 0x00, 
-0x00, 0x00, 0x00, 0x8A, 0xFE, 0x37, 0x00, 0x00, 0x33, 0xFF, 0x41, 0x00, 0x00, 0x52, 0xFF, 0x1E, 
-0x00, 0x00, 0x00, 0xC8, 0xC4, 0x00, 0x00, 0x02, 0x84, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x25, 0xFF, 
-0x85, 0x16, 0x18, 0x97, 0xFF, 0x0F, 0x00, 0x00, 0x14, 0xE7, 0xEA, 0x17, 0x0E, 0xBF, 0xFF, 0x98, 
-0x01, 0x00, 0x00, 0x00, 0x04, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x06, 0xC2, 0xFA, 
-0xFC, 0xC6, 0x0E, 0x9C, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x64, 0x63, 0x50, 
-0x0C, 0x00, 0x00, 0x9D, 0xFF, 0x69, 0x67, 0xFF, 0xD7, 0x4F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x9B, 0x00, 0x00, 0x5D, 0xF0, 0xFF, 
-0xF7, 0xD4, 0xC4, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x57, 0x36, 0xC5, 
-0x06, 0x00, 0x00, 0x00, 0x11, 0x67, 0x9D, 0xB7, 0xC1, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 
-0xC4, 0xC4, 0xC4, 0x3A, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x49, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x67, 0xF6, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xB2, 0x00, 0x00, 0x00, 0x7F, 0x88, 0x88, 
-0x88, 0x2A, 0x19, 0x20, 0x20, 0xDD, 0x90, 0x20, 0x20, 0x20, 0x07, 0x00, 0x00, 0x11, 0xF9, 0x75, 
-0x18, 0x18, 0x0A, 0xD5, 0xE4, 0xE9, 0xFF, 0x4F, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x38, 0x00, 0x00, 0x67, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x7E, 0xED, 0x10, 0x19, 0x20, 
-0x20, 0xDD, 0x90, 0x20, 0x31, 0xFF, 0x38, 0x00, 0x00, 0xCF, 0xB7, 0x4C, 0x4C, 0x4C, 0x21, 0x00, 
-0x18, 0xF3, 0x73, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x80, 0x00, 0x14, 0xFF, 0x38, 0x00, 0x40, 0xFF, 
-0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xE1, 0x07, 0x64, 0xC8, 0xC8, 0xC8, 0xF7, 0xE4, 0xC8, 
-0xCC, 0xFF, 0xD4, 0x6A, 0xB6, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFC, 0x5F, 0x00, 0x3E, 
-0x7C, 0x7C, 0x7C, 0xEB, 0xBE, 0x7C, 0x86, 0xFF, 0x98, 0x41, 0x54, 0xE6, 0xF4, 0xF4, 0xF4, 0xD9, 
-0x00, 0xB4, 0xD2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x80, 0x00, 0x14, 0xFF, 0x38, 0x00, 
-0x00, 0x4A, 0xAC, 0xEF, 0x68, 0x5C, 0x18, 0xFF, 0xE2, 0xC4, 0xC4, 0x2A, 0x56, 0x6C, 0x6C, 0xE8, 
-0xB6, 0x6C, 0x77, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x74, 0xE4, 0x00, 0x00, 0x11, 0xA0, 0xA0, 0xB1, 
-0xFF, 0x36, 0xA2, 0xCC, 0xCC, 0xF7, 0xE6, 0xCC, 0xCC, 0xCC, 0x2C, 0x00, 0x00, 0x00, 0x74, 0xE4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0xD8, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2B, 0x48, 0x9B, 0xEB, 0x48, 0x48, 0x26, 0x5E, 0x00, 0x65, 0xF6, 0x01, 0x26, 0x28, 
-0x28, 0xDE, 0x94, 0x28, 0x28, 0x28, 0x17, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xFD, 
-0x12, 0x8A, 0xCA, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x11, 0x1C, 
-0x83, 0xE7, 0x1C, 0x1C, 0x09, 0xEC, 0x5B, 0xC9, 0x97, 0x00, 0x17, 0x18, 0x18, 0xDB, 0x8C, 0x18, 
-0x18, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x74, 0xE4, 0x00, 0x00, 0x00, 0xA2, 0xC4, 0xFC, 0x4E, 0x00, 
-0x00, 0x00, 0x00, 0xD8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xE4, 0x00, 0x00, 
-0x00, 0x3E, 0xFF, 0xF8, 0x0B, 0xA7, 0xE4, 0xE4, 0xE4, 0xFB, 0xF2, 0xE4, 0xE4, 0xE4, 0xE4, 0x31, 
-0x00, 0x00, 0x74, 0xE4, 0x00, 0x09, 0x22, 0x01, 0xED, 0xDE, 0x05, 0x43, 0x5C, 0x5C, 0x5C, 0xE6, 
-0xAE, 0x5C, 0x5C, 0x5C, 0x5C, 0x14, 0x00, 0x00, 0x74, 0xE4, 0x20, 0xCF, 0x82, 0x5A, 0xFF, 0xFE, 
-0xA2, 0x05, 0x00, 0x00, 0x00, 0xD8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xF4, 
-0xEC, 0xD5, 0x39, 0xE2, 0xB9, 0x62, 0xFE, 0xCB, 0x4C, 0x04, 0x00, 0x87, 0x50, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xA1, 0x0B, 0xAB, 0xFA, 0x2B, 0x00, 0x4E, 0xE1, 0xFF, 0xF8, 
-0xDE, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x65, 0x00, 0x00, 0x7C, 0x63, 0x00, 0x32, 0xFD, 0x79, 
-0x00, 0x00, 0x00, 0x04, 0x40, 0x77, 0x8E, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x37, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 
-0x00, 0x00, 0x09, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCE, 0xBB, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x0C, 0x0C, 0x0C, 0x09, 0x00, 0x00, 0x00, 0x2E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
-0xDC, 0xCE, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x2A, 0x00, 0x00, 0x94, 0xFF, 0xF8, 
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFE, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 
-0x88, 0x00, 0x00, 0x94, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xB8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x88, 0x00, 0x00, 0x94, 0xE4, 0x00, 0xA0, 0xB4, 0xB4, 0xB4, 
-0x92, 0x00, 0xCC, 0xB8, 0x00, 0x9A, 0xB4, 0xB4, 0xB4, 0x92, 0x00, 0xF4, 0x88, 0x00, 0x00, 0x94, 
-0xE4, 0x00, 0x40, 0x48, 0x48, 0x48, 0x3A, 0x00, 0xCC, 0xB8, 0x00, 0x3D, 0x48, 0x48, 0x48, 0x3A, 
-0x00, 0xF4, 0x88, 0x00, 0x00, 0x1B, 0x2A, 0x00, 0x60, 0x6C, 0x6C, 0x6C, 0x57, 0x00, 0xCC, 0xB8, 
-0x00, 0x5C, 0x6C, 0x6C, 0x6C, 0x57, 0x00, 0x2D, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x84, 
-0x84, 0x84, 0x6B, 0x00, 0xB2, 0xA1, 0x00, 0x71, 0x84, 0x84, 0x84, 0x6B, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x08, 0x40, 0x40, 0x40, 
-0x40, 0x40, 0x40, 0x40, 0x40, 0x6C, 0xFF, 0x8F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFD, 0x1C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 
-0xB0, 0xEA, 0xF5, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x4F, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xFF, 0x9F, 0x94, 0x94, 0xAD, 0xFF, 0xA4, 0x94, 0x94, 0xAB, 0xFF, 0xA8, 0x94, 0x94, 0xA8, 
-0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1C, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0x00, 
-0x38, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1C, 0x00, 
-0x00, 0x3C, 0xFF, 0x28, 0x00, 0x00, 0x38, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x74, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0xFF, 0x1C, 0x00, 0x00, 0x3C, 0xFF, 0x28, 0x00, 0x00, 0x38, 0xFF, 0x30, 0x00, 
-0x00, 0x30, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1C, 0x00, 0x00, 0x3C, 0xFF, 0x28, 
-0x00, 0x00, 0x38, 0xFF, 0x30, 0x1D, 0x25, 0x76, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 
-0x1C, 0x00, 0x00, 0x2B, 0xB8, 0x1C, 0x00, 0x00, 0x27, 0xB4, 0x21, 0xB9, 0xFF, 0xFF, 0xF2, 0x25, 
-0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x28, 0x42, 0x39, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x4D, 0x69, 0x53, 0x61, 0x6E, 0x73, 
-0x20, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x00, 0x0D, 0x4D, 0x69, 0x53, 0x61, 0x6E, 0x73, 0x2D, 
-0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x01
-};
-#endif
\ No newline at end of file
@@ -0,0 +1,797 @@
+/*
+ * Generated by tools/font_subset.py from MiSans-Normal24.vlw, do not edit.
+ * Size: 24 px, bpp: 4, compressed
+ * Glyphs: 116, printable ASCII and 习信再功号外失学成择按接收次的红请败选键需
+ */
+
+#include <lvgl.h>
+
+#if !LV_USE_FONT_COMPRESSED
+#error "font_ui24 is compressed, enable LV_USE_FONT_COMPRESSED in lv_conf.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    0x03, 0x30, 0x86, 0xe1, 0x00, 0x71, 0x80, 0x80, 0x70, 0x80, 0x71, 0x80, 0x73, 0x80, 0x80, 0x7f,
+    0x08, 0x80, 0x3d, 0x8c, 0x00, 0x68, 0x00, 0xf2, 0xa8, 0x82, 0xa8, 0xc0, 0x18, 0x00, 0x11, 0x00,
+    0x04, 0x2b, 0x95, 0x5d, 0x62, 0x02, 0x20, 0x13, 0x07, 0x70, 0x18, 0x80, 0x88, 0x07, 0xc0, 0xcc,
+    0x1e, 0x20, 0x22, 0x01, 0x6f, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xe2, 0x30, 0x0c, 0x64, 0x01, 0xf4,
+    0xe8, 0x04, 0x39, 0x00, 0x1f, 0x2a, 0x80, 0x25, 0x0c, 0x00, 0xf1, 0x09, 0x80, 0x46, 0x0a, 0x01,
+    0xe7, 0x0d, 0x00, 0xb4, 0x08, 0x03, 0xda, 0x0e, 0x01, 0x39, 0x88, 0x00, 0xff, 0xe7, 0x0d, 0xff,
+    0x88, 0xff, 0xce, 0x2c, 0xd0, 0x13, 0x34, 0x80, 0x8c, 0xc3, 0x29, 0x95, 0x02, 0xcc, 0xd8, 0x11,
+    0x32, 0x40, 0x09, 0x43, 0x40, 0x2d, 0x03, 0x00, 0xf7, 0x83, 0x80, 0x48, 0x60, 0x1f, 0x29, 0x10,
+    0x00, 0x42, 0xa0, 0x1b, 0x76, 0x32, 0xdd, 0xbc, 0x1f, 0x75, 0x20, 0xcc, 0x10, 0x26, 0x68, 0x00,
+    0xac, 0xce, 0x0b, 0xb5, 0x04, 0xdd, 0xcc, 0x37, 0x73, 0x80, 0x5e, 0x0a, 0x01, 0x29, 0x00, 0x7c,
+    0xa4, 0x20, 0x02, 0x15, 0x00, 0xf8, 0xdc, 0x02, 0x70, 0xc0, 0x0f, 0x18, 0x68, 0x05, 0xa0, 0xe0,
+    0x1c, 0x00, 0x00, 0xf1, 0xa0, 0x07, 0xfe, 0xfb, 0x10, 0x0f, 0xfe, 0x52, 0x5f, 0x98, 0x76, 0x28,
+    0x07, 0x3d, 0xa1, 0x08, 0x11, 0xd4, 0x80, 0x49, 0x03, 0x7a, 0x41, 0x96, 0x4c, 0xe0, 0x0e, 0x0b,
+    0x40, 0x0c, 0x98, 0xaa, 0x00, 0x38, 0x20, 0x07, 0x86, 0x88, 0x00, 0x20, 0x40, 0x1f, 0xf2, 0x07,
+    0x88, 0x07, 0xfa, 0x4c, 0xdf, 0x02, 0x01, 0xf8, 0x75, 0xc1, 0xc8, 0x21, 0x00, 0x3c, 0x31, 0xf4,
+    0x20, 0xd7, 0xa8, 0x01, 0xe1, 0x52, 0x0a, 0x42, 0xb3, 0x00, 0xfe, 0x4b, 0x70, 0x80, 0x0f, 0xfa,
+    0x01, 0x40, 0x3f, 0xf0, 0x88, 0x06, 0xa8, 0x01, 0xf2, 0x09, 0x80, 0x89, 0x70, 0xc0, 0x32, 0xd0,
+    0x48, 0x02, 0x94, 0xf3, 0x48, 0x3e, 0x85, 0xd4, 0x00, 0x35, 0x6a, 0x62, 0x06, 0xb9, 0x00, 0x1c,
+    0x95, 0xc6, 0x19, 0x46, 0x01, 0xfc, 0xc6, 0x01, 0xe0, 0x00, 0x00, 0x84, 0xc8, 0x03, 0xf8, 0xcc,
+    0x20, 0x10, 0xd7, 0x66, 0xd9, 0x00, 0x79, 0x72, 0x04, 0x02, 0xd5, 0x6a, 0x85, 0xf1, 0x00, 0xc3,
+    0x63, 0x20, 0x12, 0x1c, 0x4a, 0xbd, 0x13, 0x00, 0x6a, 0x18, 0x20, 0x08, 0xc1, 0x40, 0x24, 0x1d,
+    0x00, 0x99, 0x15, 0x80, 0x3f, 0xe1, 0x30, 0x01, 0x41, 0x58, 0x07, 0x20, 0x58, 0x04, 0xc1, 0x80,
+    0x0e, 0x19, 0x10, 0x0e, 0x36, 0x66, 0x45, 0x4a, 0x28, 0x41, 0xba, 0x00, 0x7d, 0x32, 0x06, 0x77,
+    0x58, 0x23, 0x9c, 0x00, 0x7f, 0x36, 0x76, 0xc0, 0x0c, 0x87, 0x80, 0x7f, 0xf1, 0x2c, 0xa0, 0xc0,
+    0x04, 0x40, 0x0f, 0xf9, 0x54, 0x8e, 0x0b, 0xbb, 0x73, 0x80, 0x7e, 0x2b, 0x19, 0x04, 0xa0, 0x9a,
+    0x58, 0x70, 0x0f, 0xa4, 0x6c, 0x82, 0x07, 0x19, 0x6d, 0x24, 0x03, 0xce, 0x8c, 0xa0, 0x03, 0x41,
+    0x00, 0xb4, 0x4c, 0x03, 0x1c, 0x14, 0x00, 0x42, 0x01, 0xc2, 0x02, 0x01, 0xbc, 0x38, 0x40, 0x25,
+    0x42, 0x00, 0x0d, 0x11, 0x00, 0x28, 0x37, 0x30, 0x0d, 0x01, 0x93, 0x18, 0x50, 0x01, 0x23, 0x1c,
+    0x00, 0x71, 0xe2, 0x3b, 0x32, 0xd4, 0x00, 0x00, 0x00, 0xe4, 0x78, 0x50, 0x0f, 0xf1, 0x65, 0xc3,
+    0xd6, 0x90, 0x07, 0xc3, 0xe6, 0xd9, 0x85, 0x2e, 0x00, 0xf9, 0x09, 0x64, 0xcd, 0x46, 0x70, 0x07,
+    0xb4, 0x3c, 0x03, 0x20, 0x30, 0x07, 0xff, 0x04, 0x80, 0x40, 0x3d, 0xa1, 0xe0, 0x12, 0x28, 0xa0,
+    0x07, 0x94, 0xd5, 0x43, 0x16, 0x14, 0x01, 0xfb, 0xc2, 0xfd, 0xca, 0xd0, 0x03, 0xe1, 0xa0, 0x11,
+    0x3e, 0xa0, 0x07, 0xc7, 0xec, 0x6c, 0x0a, 0x20, 0x10, 0xa8, 0x81, 0x68, 0xc6, 0x4b, 0x16, 0x88,
+    0x01, 0xa9, 0x82, 0xc5, 0xdc, 0x00, 0x94, 0x3a, 0x00, 0x50, 0x30, 0x28, 0x50, 0x06, 0xa3, 0x49,
+    0x62, 0x51, 0x01, 0x03, 0x00, 0xc3, 0xa4, 0xd2, 0x30, 0x00, 0x60, 0x50, 0x0e, 0x19, 0x00, 0x39,
+    0x00, 0x38, 0x24, 0x40, 0x31, 0xc8, 0x01, 0x90, 0x00, 0xaa, 0x2f, 0x86, 0x7b, 0xc2, 0x8a, 0x0a,
+    0x30, 0x05, 0x38, 0x3c, 0xc2, 0x2e, 0x3a, 0xc0, 0xf1, 0x00, 0x23, 0xb2, 0xf3, 0xa8, 0xc0, 0x0f,
+    0xfa, 0x40, 0x00, 0x00, 0xaf, 0xd4, 0x40, 0x4c, 0x18, 0x40, 0xfc, 0x04, 0x60, 0x6e, 0x00, 0x00,
+    0x00, 0x84, 0x84, 0x02, 0xbd, 0x20, 0x01, 0x2a, 0x8c, 0x01, 0x61, 0x20, 0x13, 0x91, 0x80, 0x10,
+    0x54, 0x02, 0xc0, 0xc0, 0x08, 0xc1, 0x40, 0x25, 0x21, 0x00, 0x08, 0x98, 0x02, 0x30, 0x10, 0x08,
+    0x40, 0xc0, 0x21, 0x03, 0x00, 0x8c, 0x04, 0x02, 0x10, 0x70, 0x0c, 0x66, 0x00, 0xca, 0x06, 0x01,
+    0x60, 0x20, 0x04, 0x81, 0x60, 0x10, 0xa9, 0x90, 0x05, 0xc1, 0x40, 0x12, 0x1b, 0x08, 0x05, 0xf2,
+    0x60, 0x00, 0x02, 0x10, 0x0d, 0xf8, 0x01, 0xa8, 0x98, 0x02, 0x61, 0xb0, 0x08, 0x50, 0x8c, 0x02,
+    0xf0, 0xb0, 0x09, 0x01, 0x00, 0x21, 0x33, 0x00, 0x65, 0x03, 0x00, 0xb8, 0x18, 0x02, 0x10, 0x30,
+    0x08, 0xc0, 0x38, 0xc0, 0x38, 0x40, 0xc0, 0x2f, 0x06, 0x00, 0x8c, 0x08, 0x02, 0x52, 0x10, 0x01,
+    0x8a, 0x00, 0x56, 0x1a, 0x01, 0x28, 0xa0, 0x01, 0x09, 0x80, 0x28, 0x19, 0x00, 0x0d, 0xd0, 0x80,
+    0x00, 0x00, 0x00, 0x84, 0xc0, 0x3c, 0xf8, 0x01, 0xad, 0xcc, 0x4a, 0xd4, 0x4e, 0x6c, 0x71, 0x84,
+    0x51, 0x01, 0x03, 0xf4, 0x1c, 0x93, 0x11, 0x6b, 0x8d, 0xe5, 0x06, 0x42, 0x03, 0x98, 0x04, 0xe6,
+    0x00, 0x00, 0xe6, 0x91, 0x00, 0xfe, 0xc6, 0x30, 0x0f, 0xfe, 0x88, 0x8e, 0x00, 0x08, 0xf1, 0xf7,
+    0x65, 0x0c, 0xee, 0xac, 0x59, 0xb1, 0x02, 0xb3, 0x58, 0x53, 0x39, 0xc2, 0x26, 0x66, 0x00, 0xff,
+    0xee, 0xc6, 0x10, 0x06, 0x00, 0x05, 0x51, 0x05, 0x51, 0xc0, 0x3b, 0xcc, 0x40, 0xc9, 0x4b, 0x6c,
+    0x4b, 0x14, 0x00, 0x00, 0x33, 0xf8, 0x73, 0x3e, 0x78, 0x8f, 0x94, 0x00, 0x15, 0x50, 0x2d, 0x50,
+    0x40, 0x30, 0x00, 0x00, 0xf0, 0x98, 0x80, 0x7a, 0xf0, 0x80, 0x3c, 0x82, 0x60, 0x1c, 0x82, 0xe0,
+    0x1e, 0xd0, 0xd0, 0x0f, 0x20, 0xa0, 0x07, 0x19, 0x20, 0x07, 0xac, 0x3c, 0x03, 0xca, 0x08, 0x01,
+    0xc4, 0x44, 0x10, 0x0e, 0x50, 0xd0, 0x0f, 0x58, 0x20, 0x07, 0x09, 0x98, 0x80, 0x39, 0xc2, 0xc0,
+    0x3d, 0xa0, 0x80, 0x1c, 0x28, 0x46, 0x01, 0xc8, 0x0a, 0x01, 0xef, 0x0c, 0x00, 0xf2, 0x12, 0x00,
+    0x70, 0x00, 0x00, 0xc4, 0xd0, 0xc4, 0x01, 0xf4, 0xec, 0xbc, 0xec, 0x80, 0x74, 0xb1, 0x56, 0x51,
+    0x35, 0x00, 0x48, 0xc5, 0x8a, 0x6b, 0x84, 0xa8, 0x00, 0xf0, 0x81, 0x00, 0x86, 0x03, 0xc0, 0x50,
+    0x54, 0x03, 0x94, 0x50, 0x48, 0x14, 0x03, 0xe4, 0x05, 0x50, 0x18, 0x07, 0xc4, 0x04, 0x21, 0xe0,
+    0x1f, 0x70, 0x08, 0x00, 0x40, 0x3f, 0xbc, 0x03, 0xff, 0x86, 0x20, 0x1f, 0xde, 0x41, 0xc0, 0x1f,
+    0x70, 0x0b, 0x01, 0x00, 0x7c, 0x60, 0xa6, 0x28, 0x20, 0x1c, 0x2a, 0x26, 0x0e, 0x0c, 0x01, 0xce,
+    0x28, 0x00, 0xb0, 0x93, 0x00, 0x8e, 0x02, 0x40, 0x05, 0x03, 0x92, 0xf3, 0xa3, 0x06, 0x01, 0x3c,
+    0x8b, 0x43, 0x04, 0xb8, 0x07, 0x37, 0x65, 0xe7, 0x30, 0x04, 0x00, 0x00, 0xc6, 0x40, 0x05, 0xdc,
+    0xb4, 0xca, 0x20, 0x04, 0x9b, 0x48, 0x01, 0x76, 0x48, 0x01, 0x04, 0x01, 0xff, 0xff, 0x00, 0xf8,
+    0x00, 0x00, 0x89, 0xa1, 0xd0, 0x03, 0x86, 0xb6, 0x5e, 0x2f, 0x0c, 0x02, 0xd5, 0x3a, 0xca, 0x43,
+    0xd1, 0x07, 0x34, 0xc5, 0x35, 0xb5, 0x19, 0x01, 0x2a, 0x00, 0xe9, 0x04, 0x06, 0xd1, 0x00, 0xe1,
+    0x00, 0xff, 0x98, 0x18, 0x03, 0xfb, 0x83, 0xc0, 0x3f, 0x22, 0x92, 0x80, 0x7c, 0x32, 0x12, 0x01,
+    0xfa, 0x89, 0xd0, 0x03, 0xe9, 0x44, 0x40, 0x07, 0xce, 0xc7, 0x40, 0x1f, 0x34, 0x17, 0x08, 0x07,
+    0x92, 0x47, 0x88, 0x03, 0xc7, 0x41, 0x46, 0x01, 0xe2, 0xe1, 0xa4, 0x00, 0xfa, 0x48, 0x7a, 0xef,
+    0xe2, 0x70, 0x14, 0x4f, 0xc2, 0x00, 0x13, 0x3f, 0xf0, 0x2e, 0x67, 0xf7, 0x03, 0x44, 0x7c, 0x20,
+    0xe0, 0x4e, 0xfe, 0x01, 0x3b, 0x00, 0xf9, 0x60, 0xf4, 0x40, 0x3c, 0x74, 0x5c, 0x20, 0x1e, 0x2d,
+    0x1f, 0x20, 0x0f, 0x0f, 0x86, 0x90, 0x07, 0xd4, 0x47, 0x14, 0xa0, 0x1f, 0xce, 0xb5, 0x84, 0x01,
+    0xab, 0x75, 0x9c, 0xc7, 0xe2, 0x01, 0x09, 0x00, 0x06, 0x54, 0x9c, 0x03, 0xfb, 0x83, 0x40, 0x3f,
+    0x98, 0x1c, 0x04, 0x03, 0xf9, 0xdb, 0x98, 0x03, 0xca, 0x06, 0x83, 0x08, 0x01, 0x8e, 0x42, 0xca,
+    0x86, 0xed, 0x0f, 0x58, 0x30, 0x60, 0x98, 0x68, 0xf0, 0xa5, 0x4e, 0x01, 0x1e, 0x6d, 0xdb, 0x74,
+    0xa0, 0x00, 0x00, 0x00, 0xfc, 0x67, 0x00, 0x7f, 0x8f, 0x31, 0xa0, 0x1f, 0xef, 0x00, 0xff, 0xcc,
+    0x6a, 0x20, 0x1f, 0xc3, 0x03, 0x00, 0x1f, 0xe8, 0x19, 0x20, 0x0f, 0xe3, 0x62, 0x70, 0x0f, 0xf7,
+    0x84, 0x80, 0x7f, 0x98, 0xd5, 0x00, 0x3f, 0x86, 0x06, 0x00, 0x3f, 0xd0, 0x32, 0x40, 0x1f, 0xc6,
+    0xc4, 0xe0, 0x1f, 0xef, 0x09, 0x00, 0xff, 0x21, 0x84, 0xee, 0xf0, 0x8b, 0x74, 0x40, 0x66, 0x11,
+    0xf0, 0x00, 0x44, 0x09, 0x99, 0xf8, 0x45, 0x98, 0x20, 0x0f, 0xfe, 0xd1, 0x80, 0x40, 0x00, 0x01,
+    0x33, 0xfe, 0x00, 0x2e, 0x67, 0xef, 0x00, 0x08, 0x24, 0x47, 0xa8, 0x00, 0x61, 0xae, 0xfe, 0x60,
+    0x07, 0x01, 0x80, 0x7f, 0x08, 0x30, 0x07, 0xf1, 0x80, 0x80, 0x7f, 0x08, 0x18, 0x00, 0x40, 0x3c,
+    0xe0, 0xb9, 0xfd, 0xf4, 0x60, 0x10, 0x85, 0x92, 0x29, 0x2e, 0x28, 0x00, 0xc1, 0xfa, 0xeb, 0x64,
+    0x2c, 0x83, 0xf2, 0x00, 0x33, 0x38, 0xd0, 0x09, 0x80, 0x7a, 0xc0, 0xc0, 0x3f, 0x88, 0x1c, 0x04,
+    0x03, 0xe3, 0x07, 0x6e, 0x60, 0x0f, 0x28, 0x1a, 0x04, 0x20, 0x06, 0x39, 0x0a, 0x2a, 0x1b, 0xb3,
+    0xba, 0xb0, 0x64, 0x81, 0x6c, 0xd2, 0x20, 0xa5, 0x4c, 0x01, 0x26, 0x6d, 0xdb, 0x74, 0xa0, 0x00,
+    0x00, 0x00, 0xf1, 0x98, 0x03, 0xfc, 0xd9, 0x00, 0x1f, 0xc3, 0x01, 0x00, 0x1f, 0xd2, 0x2c, 0x60,
+    0x1f, 0x89, 0xc6, 0x00, 0x3f, 0xa4, 0x20, 0x40, 0x3f, 0x2a, 0x1b, 0x00, 0x7f, 0x40, 0x41, 0xaa,
+    0x08, 0x07, 0x31, 0x12, 0x72, 0xaf, 0xe4, 0x03, 0x50, 0x10, 0xc4, 0xb8, 0x35, 0x80, 0x0c, 0xc1,
+    0x18, 0xed, 0x1e, 0x68, 0xe0, 0x80, 0xae, 0x01, 0x87, 0xc2, 0x83, 0x83, 0xc0, 0x3c, 0x64, 0x41,
+    0x30, 0x10, 0x0f, 0x84, 0x0c, 0xc0, 0x40, 0x1f, 0x08, 0x1e, 0x06, 0x80, 0x79, 0x08, 0xc5, 0x49,
+    0x20, 0x03, 0x14, 0x84, 0x80, 0x38, 0x5f, 0x21, 0xe7, 0x09, 0x94, 0x00, 0x78, 0x86, 0xf0, 0xc7,
+    0x32, 0x00, 0xc5, 0x7d, 0x97, 0xba, 0x60, 0x08, 0x00, 0x13, 0x3f, 0xf0, 0xae, 0x67, 0xf9, 0x1a,
+    0x23, 0xf0, 0x83, 0x13, 0xbf, 0xc8, 0x26, 0x60, 0x0f, 0xd4, 0x14, 0x01, 0xf8, 0x58, 0x5c, 0x03,
+    0xf3, 0x03, 0x08, 0x07, 0xea, 0x0a, 0x00, 0xfc, 0x84, 0x84, 0x01, 0xfb, 0xc3, 0x80, 0x3f, 0x12,
+    0x12, 0x80, 0x7e, 0xa0, 0xa0, 0x0f, 0xc2, 0xc0, 0xc0, 0x1f, 0x9c, 0x54, 0x40, 0x3f, 0x50, 0x48,
+    0x07, 0xe3, 0x3c, 0x01, 0xfa, 0x42, 0x80, 0x3f, 0x0a, 0x8b, 0x80, 0x7e, 0x60, 0x61, 0x00, 0xf0,
+    0x00, 0x00, 0xc6, 0xf0, 0xe6, 0x01, 0xe2, 0xbc, 0x87, 0x8c, 0xb2, 0x00, 0x87, 0xd1, 0x15, 0x94,
+    0x69, 0xe2, 0x00, 0x62, 0x5b, 0x53, 0x5c, 0x42, 0x60, 0x06, 0x04, 0x80, 0x77, 0x86, 0x00, 0x1c,
+    0x08, 0x03, 0x98, 0x03, 0x28, 0x20, 0x07, 0x38, 0x18, 0x02, 0xc6, 0x0c, 0x02, 0x3b, 0x1a, 0x00,
+    0x15, 0x1e, 0x5c, 0xde, 0x05, 0x10, 0x04, 0xb2, 0x08, 0xc8, 0x12, 0x80, 0x10, 0xec, 0x2d, 0xe5,
+    0x2c, 0x58, 0x80, 0x28, 0xea, 0x88, 0x6b, 0x52, 0x96, 0x06, 0x8a, 0xa0, 0x0e, 0x64, 0x53, 0x40,
+    0xd0, 0x0f, 0x8c, 0x14, 0x03, 0xff, 0x82, 0x61, 0x60, 0x1f, 0x20, 0x12, 0x11, 0xc0, 0x07, 0x49,
+    0x99, 0x03, 0x85, 0xf6, 0x1e, 0x35, 0x87, 0x80, 0x07, 0x8a, 0x4f, 0x0e, 0x6d, 0xe4, 0x01, 0x15,
+    0x76, 0x5e, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x85, 0x5d, 0xca, 0x20, 0x1c, 0xff, 0x51, 0x0a, 0xf7,
+    0x00, 0xa2, 0x01, 0x19, 0x88, 0x08, 0x90, 0x37, 0x1c, 0x73, 0x33, 0xe0, 0xb2, 0x50, 0x41, 0x00,
+    0x62, 0x80, 0xd5, 0x04, 0x00, 0xf3, 0x82, 0x88, 0x18, 0x07, 0x84, 0x05, 0x80, 0x80, 0x3c, 0x60,
+    0x26, 0x14, 0x01, 0xea, 0x06, 0xa1, 0x66, 0x00, 0x67, 0x60, 0xf2, 0xb0, 0x9d, 0xaa, 0x74, 0x00,
+    0xa0, 0x2e, 0x29, 0x2a, 0xc8, 0x0c, 0x20, 0x03, 0xaf, 0xef, 0x94, 0x19, 0x00, 0xf0, 0x84, 0x04,
+    0x08, 0x07, 0xc8, 0xa6, 0xc0, 0x1f, 0xa4, 0x20, 0x03, 0xf3, 0x92, 0xa0, 0x07, 0xc3, 0x21, 0x00,
+    0x1f, 0xa0, 0x5c, 0x80, 0x30, 0x00, 0x3c, 0xc0, 0xb9, 0x98, 0x19, 0xdc, 0x25, 0x10, 0x00, 0xff,
+    0xe6, 0x8a, 0xa8, 0x16, 0xa8, 0x20, 0x18, 0x00, 0x0c, 0xc2, 0x01, 0x98, 0x41, 0xde, 0x08, 0x81,
+    0x00, 0x7f, 0xf3, 0x55, 0x44, 0x15, 0x47, 0x00, 0xef, 0x31, 0x03, 0x25, 0x2d, 0xb1, 0x2c, 0x50,
+    0x00, 0x00, 0xff, 0x1a, 0x80, 0x7e, 0x29, 0xcc, 0x00, 0x78, 0x63, 0x58, 0xe8, 0x03, 0x0b, 0xfb,
+    0x9d, 0xe1, 0x80, 0x4d, 0xf0, 0x75, 0x88, 0x01, 0x2e, 0xc9, 0xd6, 0xa8, 0x06, 0x2a, 0x29, 0xd5,
+    0x00, 0xf1, 0x90, 0x52, 0x80, 0x7c, 0x39, 0x05, 0x58, 0x80, 0x1e, 0x17, 0xf7, 0x2b, 0xb1, 0x80,
+    0x78, 0x63, 0xd9, 0x32, 0xcc, 0x03, 0xc3, 0x3a, 0xa9, 0x8e, 0x01, 0xf1, 0x56, 0x27, 0x00, 0x7f,
+    0x1d, 0xc0, 0x00, 0x2b, 0xbf, 0xf4, 0x0a, 0xaf, 0xf8, 0x4f, 0xbb, 0xfd, 0x20, 0x1f, 0xfc, 0xc1,
+    0x55, 0xff, 0x19, 0x55, 0x7f, 0xa4, 0xaa, 0xbf, 0xd2, 0x00, 0x16, 0x00, 0xff, 0x1c, 0xea, 0x80,
+    0x7e, 0x27, 0x3a, 0xc4, 0x00, 0xfa, 0x3d, 0x8e, 0xec, 0x60, 0x1e, 0x19, 0xd6, 0x4c, 0xa2, 0x00,
+    0xf1, 0x4e, 0xaa, 0xb6, 0x48, 0x03, 0xc5, 0x58, 0x8d, 0x60, 0x1f, 0x15, 0x20, 0x70, 0x07, 0x0c,
+    0x6b, 0x26, 0x38, 0x04, 0x31, 0xee, 0x77, 0x63, 0x00, 0x0b, 0xfb, 0x9d, 0x62, 0x00, 0x43, 0xf0,
+    0x73, 0xaa, 0x01, 0xc6, 0x11, 0xac, 0x01, 0xf1, 0x7b, 0x80, 0x7f, 0x00, 0x00, 0x85, 0x5d, 0xc8,
+    0x01, 0xcd, 0xf5, 0x10, 0xbd, 0x30, 0x03, 0x48, 0x46, 0x5a, 0x97, 0x09, 0x40, 0xeb, 0x9a, 0x52,
+    0x93, 0x95, 0xd8, 0xc0, 0x37, 0x87, 0x02, 0xa8, 0x03, 0x8c, 0x3c, 0x03, 0xf5, 0x02, 0x00, 0x7d,
+    0x06, 0x86, 0x01, 0xe7, 0x71, 0xd0, 0x07, 0x96, 0x0f, 0x44, 0x03, 0xd0, 0x3a, 0x20, 0x1e, 0x12,
+    0x71, 0x00, 0xfe, 0x10, 0x0f, 0xe6, 0xd0, 0x0f, 0xc3, 0x2a, 0x01, 0xff, 0xc7, 0x25, 0x50, 0x07,
+    0xe4, 0xa8, 0x00, 0xff, 0xe1, 0x80, 0x00, 0x00, 0xf8, 0x9a, 0x20, 0xe8, 0x01, 0xff, 0x2e, 0x6c,
+    0xb3, 0x22, 0xfa, 0x00, 0x3f, 0x45, 0x0c, 0xf7, 0x6b, 0x47, 0xc2, 0x00, 0xea, 0x76, 0xd6, 0x10,
+    0x00, 0xa5, 0x59, 0x78, 0x80, 0x4c, 0xaf, 0x20, 0x1f, 0x93, 0x4a, 0xc0, 0x03, 0x07, 0x00, 0x01,
+    0x69, 0x72, 0x04, 0x23, 0x75, 0x30, 0x71, 0x80, 0x01, 0x64, 0xbc, 0x6a, 0xd2, 0x05, 0x05, 0x86,
+    0x92, 0x00, 0x3c, 0xeb, 0xbe, 0x6c, 0x40, 0x04, 0x68, 0x0c, 0xe0, 0x04, 0x29, 0x50, 0x03, 0x38,
+    0x06, 0x61, 0x02, 0x30, 0x01, 0x82, 0x00, 0x6c, 0x00, 0xc6, 0x60, 0x00, 0x80, 0x04, 0x1c, 0x03,
+    0xf8, 0xc8, 0x04, 0x80, 0x0a, 0x1c, 0x01, 0xb8, 0x04, 0x00, 0x8a, 0x0a, 0xe0, 0x03, 0x55, 0x52,
+    0xaa, 0xd9, 0x65, 0x68, 0x68, 0x30, 0x8c, 0x01, 0x4c, 0xb5, 0x47, 0xfb, 0x2a, 0x4a, 0x30, 0x61,
+    0x80, 0x0a, 0x7b, 0x37, 0x08, 0x73, 0xb8, 0xa0, 0x01, 0x84, 0x80, 0x08, 0x4c, 0x80, 0x30, 0x80,
+    0x73, 0x31, 0xe8, 0x40, 0x3e, 0x30, 0x0f, 0xa6, 0x17, 0xe5, 0x4c, 0x91, 0xf7, 0x08, 0x03, 0xe7,
+    0xc7, 0x75, 0x66, 0xdc, 0x35, 0x10, 0x07, 0xe3, 0x9e, 0xdb, 0xb6, 0x7d, 0xa8, 0x06, 0x00, 0x00,
+    0xf8, 0xcc, 0x01, 0xff, 0xc1, 0x5c, 0xc1, 0x00, 0x7f, 0xee, 0x00, 0x28, 0x07, 0xfc, 0x28, 0x41,
+    0x40, 0x1f, 0xf3, 0x05, 0x29, 0x18, 0x07, 0xfa, 0xc1, 0x7c, 0x28, 0x03, 0xf8, 0x8d, 0x09, 0x45,
+    0xc0, 0x3f, 0xa8, 0x34, 0x00, 0xe2, 0x80, 0x1f, 0x94, 0x1c, 0x01, 0xa1, 0xc0, 0x1f, 0x21, 0x28,
+    0x80, 0x10, 0x90, 0x40, 0x3d, 0xa1, 0xe0, 0x19, 0x45, 0xc0, 0x3c, 0xe1, 0x5f, 0xf9, 0xc3, 0x40,
+    0x39, 0x44, 0x8c, 0xfc, 0x28, 0x40, 0x1b, 0xc2, 0x73, 0x3d, 0x20, 0xa0, 0x10, 0xa9, 0x20, 0x07,
+    0x94, 0x2c, 0x02, 0x70, 0x50, 0x0f, 0x89, 0x0c, 0xc0, 0x0a, 0x0b, 0x00, 0xfd, 0xa1, 0x60, 0x46,
+    0x70, 0x07, 0xe7, 0x06, 0x05, 0x0b, 0x00, 0xfe, 0x15, 0x14, 0x00, 0x03, 0x3f, 0x10, 0x07, 0x87,
+    0x33, 0xdb, 0xf6, 0x80, 0x1c, 0x4e, 0xf9, 0x49, 0x2d, 0xc0, 0x30, 0xc4, 0x6a, 0xd9, 0x08, 0x20,
+    0x0f, 0xf3, 0x38, 0x28, 0x07, 0xfd, 0xc1, 0xe0, 0x1f, 0xf7, 0x87, 0x00, 0x7f, 0x95, 0x89, 0xc0,
+    0x21, 0x77, 0xd3, 0xb4, 0x7e, 0x20, 0x11, 0x44, 0x66, 0x24, 0xf2, 0x00, 0xc5, 0x55, 0xa5, 0x99,
+    0x96, 0x40, 0x10, 0xaa, 0xe6, 0x9d, 0x84, 0xe0, 0x0f, 0xf9, 0xd0, 0xd4, 0x03, 0xfe, 0xc0, 0x20,
+    0x0f, 0xfb, 0x80, 0x40, 0x3f, 0xc4, 0xe0, 0xa0, 0x1f, 0x85, 0xb0, 0x54, 0xc0, 0x05, 0x99, 0xb7,
+    0xa4, 0x56, 0xc0, 0x21, 0x33, 0x88, 0xcc, 0xd9, 0x42, 0x00, 0x00, 0x00, 0xe1, 0x47, 0x87, 0x40,
+    0x0f, 0xcf, 0xf7, 0x0f, 0x17, 0xcc, 0x01, 0x86, 0xe0, 0x1a, 0xae, 0x98, 0x66, 0x80, 0x2b, 0x43,
+    0xf9, 0x54, 0x59, 0xd3, 0x55, 0x02, 0xa8, 0xb4, 0x40, 0x38, 0xb6, 0xd4, 0x20, 0x24, 0x40, 0x3e,
+    0x14, 0x03, 0x22, 0x20, 0x07, 0xfc, 0xa0, 0xa0, 0x1f, 0xfb, 0x83, 0x80, 0x3f, 0xf0, 0x81, 0x80,
+    0x7f, 0xf3, 0xc4, 0x08, 0x03, 0xff, 0x68, 0x68, 0x07, 0xfe, 0x40, 0x40, 0x0f, 0xfc, 0x28, 0x2e,
+    0x01, 0xff, 0xa0, 0x24, 0xc0, 0x3e, 0x48, 0x00, 0x1c, 0x0e, 0xa8, 0x07, 0x35, 0x3a, 0x80, 0x1e,
+    0x06, 0xb2, 0x5e, 0x36, 0x46, 0x14, 0x02, 0x7b, 0x43, 0x68, 0x72, 0x4c, 0x70, 0x0e, 0x4b, 0xeb,
+    0xb6, 0x75, 0x98, 0x00, 0x00, 0x03, 0x3f, 0x10, 0x80, 0x7c, 0x39, 0x9e, 0xde, 0xd8, 0x10, 0x0f,
+    0x13, 0xbe, 0x63, 0x27, 0xf4, 0x00, 0xe1, 0x88, 0xd3, 0x9c, 0xc3, 0x6a, 0x01, 0xff, 0x0c, 0xd0,
+    0x58, 0x80, 0x7f, 0xe5, 0x61, 0x80, 0x0f, 0xfe, 0x0d, 0x83, 0x80, 0x7f, 0xf0, 0x48, 0xc4, 0xc0,
+    0x3f, 0xf8, 0x2a, 0x0c, 0x01, 0xff, 0xc1, 0x10, 0x30, 0x0f, 0xfe, 0x89, 0x01, 0x80, 0x7f, 0xf0,
+    0x5c, 0x1c, 0x03, 0xff, 0x19, 0x14, 0x01, 0xff, 0xa0, 0x28, 0x03, 0xff, 0x4a, 0x1b, 0x80, 0x7f,
+    0x0a, 0xe3, 0x17, 0x00, 0x62, 0xcc, 0xdb, 0xd4, 0x6b, 0x84, 0x01, 0x84, 0xce, 0x23, 0x47, 0xca,
+    0x10, 0x08, 0x00, 0x03, 0x3f, 0xf8, 0x07, 0x33, 0xfd, 0xe0, 0x11, 0x3b, 0xfe, 0xa0, 0x08, 0x62,
+    0x3f, 0x30, 0x07, 0xff, 0xac, 0x59, 0xbf, 0x08, 0x04, 0x53, 0x3f, 0x94, 0x02, 0x29, 0x9f, 0xcc,
+    0x01, 0x0b, 0x37, 0xe2, 0x00, 0xff, 0xfc, 0x16, 0x67, 0xf0, 0x80, 0x04, 0xcf, 0xfc, 0x00, 0x03,
+    0x3f, 0xf1, 0x0e, 0x67, 0xfa, 0xc0, 0x04, 0xef, 0xfb, 0x00, 0x03, 0x11, 0xf9, 0x40, 0x3f, 0xfe,
+    0x47, 0xff, 0xf7, 0x00, 0x42, 0x89, 0xf8, 0x02, 0x2b, 0xbf, 0xa8, 0x03, 0xff, 0xfe, 0xe0, 0x1f,
+    0xc0, 0x00, 0x00, 0xe1, 0x57, 0x87, 0x40, 0x0f, 0xd1, 0xf5, 0x0f, 0x17, 0xac, 0x01, 0x87, 0x1c,
+    0x1a, 0xae, 0x94, 0xa6, 0x40, 0x15, 0x19, 0xbe, 0x55, 0x16, 0xb0, 0x99, 0x41, 0x90, 0xb4, 0x40,
+    0x38, 0xfe, 0x94, 0x2c, 0x24, 0x40, 0x3e, 0x25, 0x02, 0x29, 0x00, 0x3f, 0xe4, 0x05, 0x00, 0xff,
+    0xdc, 0x1c, 0x01, 0xff, 0x84, 0x0c, 0x03, 0x8a, 0x23, 0xc0, 0x1f, 0x99, 0xdf, 0x9b, 0x80, 0xc0,
+    0x39, 0x73, 0x30, 0x80, 0x87, 0x80, 0x70, 0x99, 0xe0, 0x02, 0x02, 0x00, 0x7f, 0xe2, 0x32, 0x50,
+    0x0f, 0xfd, 0x01, 0x64, 0x01, 0xf1, 0x88, 0x01, 0x14, 0x7c, 0xc0, 0x39, 0x74, 0x20, 0x01, 0x4c,
+    0x59, 0x88, 0x78, 0xda, 0x09, 0x60, 0x0a, 0x64, 0x66, 0x78, 0x73, 0x5c, 0x60, 0x0e, 0x6c, 0xdb,
+    0xb6, 0x7d, 0x10, 0x00, 0x00, 0x03, 0x20, 0x0f, 0xe2, 0x31, 0x16, 0x70, 0x07, 0xf4, 0x61, 0x00,
+    0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0xa2, 0x89, 0xfc, 0x20, 0x18, 0xae, 0xff, 0x90, 0x03, 0x14, 0x47,
+    0xf1, 0x80, 0x61, 0x77, 0xfe, 0x60, 0x0f, 0xff, 0xf8, 0x07, 0xff, 0x1d, 0xc0, 0x3f, 0xf0, 0x00,
+    0x03, 0x21, 0xce, 0x00, 0xff, 0xf3, 0x38, 0x00, 0x00, 0xf8, 0x8c, 0x40, 0x3e, 0xac, 0x40, 0x0f,
+    0xff, 0xf8, 0x07, 0xff, 0xa0, 0x40, 0x02, 0xec, 0x01, 0x88, 0x19, 0x62, 0xc4, 0x00, 0x68, 0x26,
+    0x8a, 0x59, 0x13, 0xa1, 0x20, 0x0a, 0x62, 0x76, 0x17, 0x70, 0x05, 0x3d, 0x76, 0xe8, 0x00, 0x00,
+    0x03, 0x20, 0x0f, 0x84, 0xcc, 0x22, 0xce, 0x00, 0xf0, 0xee, 0x50, 0x80, 0x7e, 0x1d, 0x36, 0x90,
+    0x0f, 0xc3, 0xa6, 0xd2, 0x01, 0xf8, 0x74, 0xda, 0x40, 0x3f, 0x0e, 0x9b, 0xc8, 0x07, 0xe1, 0xd3,
+    0x78, 0x00, 0xfc, 0x38, 0x6f, 0x00, 0x1f, 0x87, 0x09, 0xe0, 0x03, 0xf8, 0x88, 0x08, 0x01, 0xff,
+    0x42, 0x1d, 0x00, 0x7f, 0x1b, 0xd1, 0x2c, 0x00, 0x7f, 0x87, 0xc5, 0xd8, 0x03, 0xfc, 0x5a, 0x32,
+    0x80, 0x1f, 0xe3, 0xa0, 0xa3, 0x00, 0xff, 0x24, 0x8e, 0x90, 0x07, 0xf9, 0x9c, 0x7c, 0x40, 0x3f,
+    0xd0, 0xa5, 0x40, 0x13, 0x80, 0x7d, 0x48, 0x89, 0x00, 0x03, 0x20, 0x0f, 0xe1, 0xce, 0x00, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfb, 0xa5, 0x99, 0xfa, 0xc0, 0x02, 0x67, 0xf9, 0x40, 0x00,
+    0x03, 0x30, 0x07, 0xff, 0x04, 0xcc, 0x03, 0x98, 0x40, 0x0f, 0xf9, 0x73, 0x00, 0x1a, 0x00, 0x3f,
+    0xe8, 0x00, 0xf1, 0xb0, 0x07, 0xf3, 0x90, 0x07, 0x10, 0xc0, 0x80, 0x7c, 0x32, 0x22, 0x00, 0xc3,
+    0x23, 0x20, 0x1f, 0x40, 0xc1, 0x80, 0x73, 0x13, 0x90, 0x07, 0x1b, 0x1b, 0x00, 0x78, 0x60, 0x20,
+    0x03, 0xa0, 0x20, 0x03, 0xf2, 0x9a, 0xa0, 0x04, 0xa8, 0xa8, 0x01, 0xfd, 0xe1, 0x00, 0x14, 0x04,
+    0x00, 0x7f, 0x8d, 0x4d, 0x81, 0xc9, 0xc8, 0x03, 0xfe, 0x81, 0x82, 0x91, 0x90, 0x0f, 0xfc, 0x4c,
+    0x38, 0x30, 0x20, 0x1f, 0xfc, 0x19, 0x21, 0x26, 0x00, 0xff, 0xe1, 0x0c, 0x04, 0x80, 0x7f, 0xf1,
+    0x17, 0xd0, 0x03, 0xff, 0xea, 0x00, 0x00, 0x03, 0x30, 0x07, 0xf0, 0x99, 0x0e, 0x61, 0x40, 0x3f,
+    0x2e, 0x58, 0x05, 0x62, 0x01, 0xff, 0xc1, 0x18, 0x00, 0xff, 0xc6, 0x66, 0x40, 0x0f, 0xfd, 0xe1,
+    0x22, 0x01, 0xff, 0x1b, 0x94, 0x00, 0x7f, 0xe8, 0x26, 0x40, 0x0f, 0xfd, 0xc1, 0x22, 0x01, 0xff,
+    0x1b, 0x94, 0x00, 0x7f, 0xe9, 0x26, 0x30, 0x0f, 0xf8, 0x64, 0x38, 0x03, 0xff, 0x23, 0x14, 0x00,
+    0x7f, 0xe8, 0x27, 0x30, 0x0f, 0xf8, 0x64, 0x3c, 0x03, 0xff, 0x23, 0x1c, 0x00, 0x7f, 0xe8, 0x13,
+    0x00, 0xff, 0xc3, 0x60, 0x1c, 0xe0, 0x1f, 0x95, 0x40, 0x20, 0x00, 0x00, 0xe1, 0x57, 0x87, 0x40,
+    0x0f, 0xe1, 0x9e, 0xa8, 0x78, 0xbe, 0x60, 0x0f, 0x0e, 0xb0, 0xbd, 0x5d, 0x28, 0xcc, 0x80, 0x3a,
+    0x8d, 0x3e, 0x15, 0x16, 0xb0, 0x59, 0xc0, 0x26, 0x43, 0xb1, 0x00, 0xe3, 0xc0, 0x82, 0x00, 0x50,
+    0x40, 0x07, 0xe2, 0x70, 0xb0, 0x23, 0x24, 0x00, 0xfe, 0xa0, 0x40, 0x40, 0x50, 0x0f, 0xf1, 0x19,
+    0x13, 0x83, 0x80, 0x3f, 0xe6, 0x06, 0x10, 0x30, 0x0f, 0xf8, 0xc0, 0x40, 0x3f, 0xf8, 0xbc, 0x06,
+    0x01, 0xff, 0x18, 0x31, 0x07, 0x80, 0x7f, 0xce, 0x02, 0x80, 0xe0, 0x1f, 0xe3, 0x23, 0x21, 0x41,
+    0x60, 0x0f, 0xe9, 0x04, 0x00, 0x78, 0x41, 0x00, 0x7c, 0xaa, 0x19, 0x00, 0x23, 0x0f, 0x98, 0x07,
+    0x35, 0x05, 0x88, 0x05, 0x2c, 0x59, 0x88, 0x79, 0xd9, 0x0a, 0x50, 0x0e, 0x9a, 0x33, 0x3c, 0x31,
+    0x26, 0x28, 0x07, 0xcb, 0x9b, 0x76, 0xce, 0xb3, 0x00, 0xc0, 0x00, 0x03, 0x3f, 0x10, 0x07, 0x87,
+    0x33, 0xdb, 0xf6, 0x80, 0x1c, 0x4e, 0xf9, 0x49, 0x2e, 0x40, 0x30, 0xc4, 0x6a, 0xda, 0x16, 0x60,
+    0x07, 0xf9, 0x6c, 0x28, 0x03, 0xfe, 0x51, 0x30, 0x0f, 0xfc, 0x60, 0x20, 0x1f, 0xe1, 0x21, 0x10,
+    0x07, 0xfa, 0x01, 0x00, 0x3f, 0x92, 0x98, 0x24, 0x02, 0x3e, 0xed, 0xf6, 0xa3, 0x66, 0x01, 0x09,
+    0x16, 0x35, 0x9f, 0x40, 0x0c, 0x59, 0x9d, 0x4c, 0x20, 0x1f, 0xff, 0xf7, 0x00, 0xff, 0x80, 0x00,
+    0x00, 0xe1, 0x57, 0x87, 0x40, 0x0f, 0xe1, 0x8e, 0xa8, 0x78, 0xbd, 0x60, 0x0f, 0x0e, 0xb8, 0xbd,
+    0x5c, 0xa9, 0x4c, 0x80, 0x3a, 0x8d, 0x3e, 0x15, 0x1a, 0xb0, 0x59, 0xc0, 0x26, 0x43, 0xa1, 0x00,
+    0xe3, 0xc0, 0x82, 0x00, 0x58, 0x40, 0x80, 0x7c, 0x4e, 0x16, 0x04, 0x52, 0x00, 0x7f, 0x50, 0x20,
+    0x20, 0x28, 0x07, 0xf8, 0x8c, 0x89, 0xc1, 0xc0, 0x1f, 0xf3, 0x03, 0x08, 0x18, 0x07, 0xfc, 0x60,
+    0x20, 0x1f, 0xfc, 0x5e, 0x03, 0x00, 0xff, 0x8c, 0x04, 0x83, 0xc0, 0x3f, 0xe7, 0x05, 0x40, 0x40,
+    0x0f, 0x8c, 0x40, 0x8a, 0x11, 0x19, 0x28, 0x07, 0x26, 0x50, 0x58, 0x50, 0x02, 0x02, 0xc8, 0x03,
+    0x29, 0xa5, 0xb0, 0xb0, 0x01, 0x14, 0x7c, 0xc0, 0x21, 0xe1, 0x40, 0xb1, 0x00, 0xa9, 0x4b, 0x31,
+    0x0f, 0x3e, 0x20, 0x1f, 0xaa, 0x48, 0xde, 0x18, 0x92, 0x02, 0xcc, 0x03, 0x9b, 0x75, 0x75, 0x7d,
+    0x6f, 0x23, 0xc2, 0x01, 0xe2, 0x45, 0x41, 0x00, 0x33, 0xd0, 0x80, 0x00, 0x03, 0x3f, 0x10, 0x07,
+    0x87, 0x33, 0xdb, 0xd4, 0x60, 0x1c, 0x4e, 0xf9, 0x41, 0x71, 0x80, 0x30, 0xc4, 0x6a, 0xe9, 0x09,
+    0x30, 0x0f, 0xf3, 0x40, 0x50, 0x07, 0xfc, 0xa0, 0xa0, 0x1f, 0xfc, 0xd5, 0x06, 0x00, 0xff, 0x34,
+    0x07, 0x00, 0x45, 0x33, 0xaf, 0xa4, 0x25, 0x00, 0x21, 0x66, 0xc8, 0x2b, 0x8c, 0x01, 0x8f, 0x33,
+    0x08, 0xac, 0xc0, 0x3c, 0x67, 0xa4, 0x6c, 0x03, 0xfe, 0x73, 0x54, 0x00, 0xff, 0xa0, 0x24, 0x03,
+    0xfe, 0x45, 0x27, 0x00, 0xff, 0xa0, 0x64, 0x80, 0x3f, 0xc5, 0x23, 0x00, 0x13, 0x80, 0x7c, 0xe4,
+    0xa8, 0x00, 0x00, 0xc2, 0xaf, 0x0c, 0x60, 0x1e, 0x18, 0xea, 0x87, 0x9c, 0xc1, 0x80, 0x6a, 0x71,
+    0x8b, 0xb4, 0x99, 0xb1, 0x00, 0x0c, 0x87, 0xee, 0x88, 0x6c, 0x90, 0x90, 0x06, 0x87, 0x88, 0x07,
+    0x35, 0x60, 0x01, 0xc0, 0x80, 0x3e, 0x51, 0x00, 0x38, 0x20, 0x07, 0xfd, 0xa1, 0x06, 0x01, 0xfe,
+    0x65, 0x2c, 0xa5, 0x10, 0x0f, 0xd5, 0x24, 0xb5, 0xd6, 0xc0, 0x1f, 0x36, 0xdb, 0x92, 0x4f, 0x28,
+    0x07, 0xc9, 0x1b, 0x8a, 0x34, 0xc0, 0x1f, 0xc7, 0x54, 0x08, 0x10, 0x0f, 0xf2, 0xa8, 0x54, 0x03,
+    0xfe, 0x30, 0x11, 0x56, 0x00, 0x7e, 0x50, 0x61, 0x11, 0xd9, 0x00, 0x74, 0x99, 0xc1, 0x48, 0x8d,
+    0xa8, 0x79, 0xd6, 0x1f, 0x00, 0x0d, 0xc9, 0xab, 0xc3, 0x1a, 0xe1, 0x80, 0x66, 0xcd, 0xbb, 0x67,
+    0x51, 0x00, 0x00, 0x00, 0x23, 0x3f, 0xfe, 0x0a, 0xe6, 0x7f, 0xee, 0x37, 0x7e, 0x20, 0x67, 0x7d,
+    0x49, 0x11, 0xcc, 0x17, 0x11, 0x9c, 0x03, 0xff, 0xfe, 0x01, 0xff, 0xff, 0x00, 0xff, 0xf8, 0x00,
+    0x00, 0x03, 0x20, 0x0f, 0xe3, 0x30, 0xe7, 0x00, 0x7f, 0x67, 0x00, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x18, 0x40, 0x40, 0x3f, 0x10, 0x30, 0x11, 0x40, 0x1f, 0x38, 0x10, 0x28, 0x58, 0x07, 0xd2,
+    0x1a, 0x12, 0x2c, 0xe0, 0x1d, 0x26, 0x64, 0x01, 0xa1, 0x8c, 0x87, 0x9d, 0x62, 0xe0, 0x09, 0x35,
+    0x0d, 0xe1, 0x8d, 0xb0, 0x80, 0x31, 0xdf, 0x65, 0xe7, 0xc8, 0x80, 0x00, 0x00, 0x23, 0x10, 0x0f,
+    0xf1, 0x18, 0xa6, 0x40, 0x07, 0xfb, 0xb0, 0x9c, 0x1c, 0x03, 0xf8, 0x8c, 0xe1, 0x51, 0x40, 0x0f,
+    0xca, 0x16, 0x00, 0xf0, 0xe0, 0x0f, 0xd4, 0x0a, 0x00, 0x51, 0x41, 0x00, 0xf1, 0x92, 0x10, 0x04,
+    0xe2, 0x80, 0x1e, 0xb0, 0xd0, 0x0d, 0xa1, 0xc0, 0x1e, 0x61, 0x70, 0x0c, 0x84, 0x82, 0x01, 0x90,
+    0x50, 0x40, 0x39, 0x41, 0xc0, 0x36, 0x87, 0x00, 0x7a, 0x82, 0x80, 0x21, 0x71, 0x40, 0x0f, 0x11,
+    0x98, 0x80, 0x08, 0x2c, 0x01, 0xfa, 0x81, 0x40, 0x1e, 0x16, 0x01, 0xf9, 0xc2, 0x80, 0x54, 0x8c,
+    0x03, 0xf0, 0xa1, 0x1b, 0x85, 0x00, 0x7f, 0xb8, 0x2f, 0x41, 0x40, 0x3f, 0xc8, 0x2c, 0x88, 0x20,
+    0x0f, 0xf0, 0xb8, 0x86, 0x80, 0x7f, 0xed, 0x01, 0x70, 0x0f, 0x00, 0x23, 0x10, 0x0f, 0x88, 0xc8,
+    0x03, 0xe1, 0x32, 0x5c, 0x60, 0x0f, 0xa3, 0x20, 0x03, 0xe9, 0xc5, 0x40, 0xc0, 0x0f, 0x90, 0x10,
+    0x03, 0xe4, 0x04, 0x31, 0x41, 0x00, 0xe4, 0x10, 0x14, 0x00, 0xe1, 0x31, 0x30, 0x40, 0x50, 0x0e,
+    0xc0, 0x60, 0xc0, 0x0e, 0x40, 0x40, 0x06, 0x06, 0x00, 0x72, 0x0c, 0x02, 0x00, 0x76, 0x06, 0x00,
+    0x10, 0x10, 0x03, 0x09, 0xa8, 0xa1, 0x88, 0x06, 0x40, 0x40, 0x01, 0x10, 0xc4, 0x02, 0x40, 0xc0,
+    0xc0, 0x40, 0x08, 0x8b, 0x00, 0x48, 0x08, 0x01, 0x60, 0x28, 0x28, 0x60, 0x04, 0x80, 0x80, 0x1b,
+    0x03, 0x00, 0x27, 0x22, 0x01, 0x11, 0xc0, 0x2c, 0x0c, 0x00, 0xc8, 0x08, 0x00, 0x31, 0x40, 0x09,
+    0x04, 0xc0, 0x08, 0x08, 0x01, 0x84, 0xc8, 0x80, 0x81, 0x80, 0x16, 0x02, 0x01, 0x89, 0x88, 0x07,
+    0x58, 0x20, 0x60, 0x20, 0x04, 0x81, 0x80, 0x81, 0x60, 0x1e, 0x40, 0xd1, 0x44, 0x08, 0x04, 0x28,
+    0x81, 0xc0, 0x40, 0x0f, 0x18, 0xaa, 0x06, 0x00, 0x76, 0x02, 0x28, 0x98, 0x07, 0xc8, 0x32, 0x08,
+    0x01, 0xc8, 0x12, 0x28, 0x01, 0xfb, 0x00, 0xc8, 0xc0, 0x38, 0xc4, 0xc3, 0x00, 0x3f, 0x20, 0x01,
+    0x00, 0x3e, 0x70, 0x02, 0x00, 0x7e, 0x22, 0x06, 0x00, 0x7d, 0x80, 0x44, 0x00, 0xc0, 0x00, 0x03,
+    0x30, 0x07, 0xf1, 0x98, 0x01, 0x18, 0xe0, 0x1f, 0x46, 0x48, 0x02, 0x46, 0x08, 0x03, 0x89, 0xc6,
+    0xc0, 0x05, 0x01, 0xc0, 0x1d, 0x21, 0x02, 0x01, 0x32, 0x1b, 0x00, 0x4a, 0x88, 0x60, 0x0e, 0x91,
+    0x82, 0x01, 0xb1, 0x90, 0x0f, 0x14, 0x8c, 0x84, 0x0c, 0x10, 0x07, 0xce, 0x69, 0x0c, 0x6c, 0x01,
+    0xfd, 0xc0, 0xe1, 0xc0, 0x1f, 0xe2, 0x30, 0x42, 0x00, 0xff, 0x29, 0x82, 0x20, 0x03, 0xf8, 0x6c,
+    0x68, 0x24, 0x03, 0xfa, 0x06, 0x55, 0x89, 0xc0, 0x3e, 0x36, 0x27, 0x08, 0x18, 0x20, 0x0f, 0x78,
+    0x40, 0x00, 0x60, 0x24, 0x03, 0x9c, 0xd1, 0x40, 0x26, 0x34, 0x60, 0x08, 0xa4, 0x24, 0x03, 0xbc,
+    0x20, 0x40, 0x10, 0x2e, 0x40, 0x1c, 0x6c, 0x30, 0x08, 0xa5, 0x20, 0x1f, 0x41, 0x32, 0x00, 0x00,
+    0x23, 0x20, 0x0f, 0xe2, 0x31, 0x6c, 0xf0, 0x0f, 0xc5, 0xba, 0x34, 0x52, 0x60, 0x0f, 0xac, 0x24,
+    0x82, 0x02, 0x04, 0x03, 0x8d, 0x89, 0x80, 0x04, 0xe2, 0xc0, 0x1d, 0x01, 0x02, 0x01, 0x48, 0xc8,
+    0x80, 0x48, 0x83, 0x50, 0x0c, 0x32, 0x30, 0x01, 0x40, 0x78, 0x07, 0x9c, 0x98, 0x81, 0x4d, 0x4c,
+    0x03, 0xe8, 0x08, 0x08, 0x08, 0x00, 0xfc, 0xa8, 0xb4, 0x4e, 0x40, 0x1f, 0xd0, 0x0a, 0x32, 0x01,
+    0xfe, 0x35, 0x09, 0x10, 0x0f, 0xf8, 0x80, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x90, 0x00, 0x03,
+    0x3f, 0xfc, 0x00, 0xcc, 0xff, 0xc0, 0x07, 0x7f, 0xe3, 0x03, 0x00, 0x44, 0x7e, 0xa2, 0x0f, 0x00,
+    0xff, 0x48, 0xb9, 0x80, 0x7f, 0x2a, 0x1c, 0x00, 0x7f, 0x0d, 0x87, 0x80, 0x7f, 0xac, 0x5c, 0xc0,
+    0x3f, 0x95, 0x45, 0x20, 0x1f, 0xc3, 0x61, 0x22, 0x01, 0xfd, 0x02, 0xc8, 0x01, 0xfc, 0x8c, 0x50,
+    0x01, 0xfc, 0x32, 0x12, 0x20, 0x1f, 0xd0, 0x4c, 0x80, 0x1f, 0xc8, 0xc3, 0x00, 0x1f, 0xc3, 0x21,
+    0x62, 0x01, 0xfd, 0x24, 0xaa, 0x00, 0xfe, 0x27, 0x07, 0xcc, 0xfe, 0x51, 0x00, 0x11, 0x9f, 0xf8,
+    0x00, 0x12, 0x2e, 0x4d, 0xdd, 0xe0, 0x05, 0x99, 0x58, 0x03, 0x59, 0xa0, 0x0f, 0xff, 0xf8, 0x07,
+    0xff, 0x2f, 0xcc, 0xc4, 0x00, 0x7c, 0xc7, 0xbc, 0x46, 0xb0, 0x00, 0x23, 0x10, 0x0e, 0x5c, 0x70,
+    0x0e, 0x40, 0xd0, 0x0e, 0x32, 0x41, 0x00, 0xe5, 0x04, 0x00, 0xec, 0x0f, 0x00, 0xe4, 0x14, 0x00,
+    0xf3, 0x8a, 0x00, 0x76, 0x06, 0x80, 0x72, 0x0a, 0x00, 0x70, 0xa1, 0x18, 0x07, 0x60, 0x58, 0x07,
+    0x38, 0x20, 0x07, 0x0a, 0x19, 0x00, 0x76, 0x02, 0x80, 0x72, 0x86, 0x00, 0x71, 0x1a, 0x08, 0x07,
+    0x20, 0x38, 0x07, 0x58, 0x60, 0x00, 0x12, 0x2c, 0x31, 0xbb, 0xa3, 0x66, 0x4e, 0x00, 0x46, 0x65,
+    0x00, 0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0x64, 0x66, 0x70, 0x05, 0xe6, 0x28, 0x01, 0xb1, 0x1b, 0x40,
+    0x00, 0x00, 0xc4, 0x60, 0x1f, 0x0e, 0x62, 0x00, 0x3d, 0x02, 0x4e, 0x40, 0x18, 0xd9, 0x7c, 0x24,
+    0x03, 0x40, 0xd9, 0x3a, 0x28, 0x01, 0x52, 0x44, 0x24, 0xa0, 0x06, 0xcd, 0xc0, 0x03, 0x04, 0xe1,
+    0xba, 0x00, 0xcb, 0x88, 0x00, 0x22, 0xff, 0x0e, 0xef, 0xfb, 0x19, 0xbf, 0xca, 0x00, 0x02, 0x00,
+    0xa7, 0x4c, 0x01, 0xa1, 0xe0, 0x04, 0xa3, 0x90, 0x02, 0xd1, 0x00, 0x00, 0x00, 0xff, 0xe0, 0xa5,
+    0xf7, 0xf5, 0x18, 0x05, 0x36, 0xab, 0x12, 0xe9, 0x80, 0x31, 0x7e, 0xeb, 0x20, 0x7c, 0x00, 0xb4,
+    0x20, 0x13, 0x91, 0x88, 0x07, 0xe7, 0x03, 0x00, 0xc4, 0x68, 0x81, 0x00, 0x8a, 0x7b, 0x72, 0xec,
+    0x80, 0x02, 0xc6, 0x36, 0x89, 0x91, 0x80, 0x20, 0x63, 0x65, 0xd9, 0xa0, 0x03, 0x83, 0x80, 0x61,
+    0x40, 0x00, 0x81, 0x80, 0x6b, 0x10, 0x05, 0x87, 0x3a, 0xbe, 0xba, 0x00, 0x1d, 0xc5, 0x15, 0x0f,
+    0x84, 0x01, 0x47, 0x65, 0xed, 0x0c, 0xf9, 0x00, 0x00, 0x13, 0x20, 0x0f, 0xf2, 0xe5, 0x00, 0x7f,
+    0xfd, 0x9b, 0x3f, 0xa8, 0xc0, 0x3d, 0x52, 0x26, 0x0b, 0x8a, 0x01, 0x99, 0x2b, 0x73, 0xa0, 0x2c,
+    0x80, 0x21, 0xb5, 0x00, 0x9d, 0xc3, 0x60, 0x11, 0xa8, 0x07, 0x48, 0x38, 0x04, 0xa0, 0x1e, 0x14,
+    0x11, 0x00, 0x38, 0x03, 0xe1, 0x03, 0x00, 0x78, 0x07, 0xc2, 0x06, 0x00, 0x30, 0x0f, 0x94, 0x44,
+    0x00, 0x42, 0x00, 0xe6, 0x17, 0x00, 0xdc, 0x20, 0x11, 0xc0, 0x50, 0x04, 0xc3, 0xf2, 0xf5, 0x83,
+    0x06, 0x01, 0x0f, 0xab, 0x42, 0x8c, 0xb8, 0x01, 0x3e, 0x0a, 0xfa, 0xf3, 0x98, 0x02, 0x00, 0x00,
+    0x0b, 0xe7, 0x72, 0xd4, 0x02, 0x1d, 0x82, 0x55, 0x25, 0x50, 0x01, 0x46, 0xdf, 0x76, 0xe5, 0x53,
+    0xa2, 0x0e, 0x44, 0x00, 0x35, 0x2f, 0xa1, 0x20, 0x1e, 0x60, 0x50, 0x40, 0x0f, 0xc2, 0x02, 0x01,
+    0xf8, 0x40, 0x3f, 0xcc, 0x06, 0x01, 0xfb, 0xc2, 0x80, 0x3c, 0x20, 0x84, 0xca, 0x01, 0x9b, 0x94,
+    0x78, 0x6a, 0x8c, 0xcb, 0x91, 0x70, 0x3d, 0x45, 0x99, 0x22, 0xe1, 0x00, 0x0e, 0xf6, 0xed, 0xb4,
+    0x40, 0x00, 0x00, 0xfe, 0x13, 0x20, 0x0f, 0xe2, 0xcb, 0x00, 0xff, 0xf3, 0x0c, 0x6f, 0xf4, 0x08,
+    0x06, 0x2c, 0x73, 0x31, 0x3e, 0x38, 0x05, 0x24, 0xbf, 0x98, 0xd1, 0xa0, 0x02, 0x20, 0xe8, 0x40,
+    0x05, 0xa0, 0x16, 0x84, 0x80, 0x70, 0xb0, 0x01, 0x41, 0x00, 0x3d, 0x80, 0x01, 0x01, 0x00, 0xf3,
+    0x80, 0x04, 0x04, 0x03, 0xce, 0x00, 0x60, 0x50, 0x0f, 0x18, 0x03, 0xc3, 0x80, 0x3d, 0x60, 0x05,
+    0x25, 0x70, 0x0d, 0x06, 0x01, 0x70, 0xc6, 0x44, 0x31, 0xe0, 0x02, 0x3d, 0x33, 0x3b, 0x86, 0xd0,
+    0x04, 0x00, 0x79, 0xb7, 0x9a, 0x87, 0xf0, 0x00, 0x00, 0xff, 0xe1, 0x0c, 0x6f, 0xfb, 0x18, 0x03,
+    0x16, 0x38, 0x32, 0x94, 0xd8, 0x05, 0xc4, 0xfb, 0x35, 0xe8, 0x87, 0x05, 0x34, 0x80, 0x08, 0x64,
+    0x64, 0x30, 0x38, 0x03, 0x89, 0x44, 0x94, 0x35, 0xdf, 0xe0, 0x61, 0x07, 0x88, 0xf1, 0x83, 0x88,
+    0x66, 0xef, 0xe3, 0x60, 0x01, 0x17, 0xe0, 0xc0, 0xa0, 0x0f, 0x10, 0x01, 0xc9, 0x94, 0x03, 0x1e,
+    0x50, 0x0c, 0x8d, 0x51, 0x99, 0x38, 0x3e, 0x00, 0x4d, 0x45, 0x99, 0x31, 0xe2, 0x80, 0x47, 0x7d,
+    0x97, 0xb8, 0x60, 0x00, 0x00, 0x00, 0xc8, 0xf0, 0xa0, 0x14, 0x5c, 0x3c, 0x80, 0x0d, 0xc6, 0xb7,
+    0xc0, 0x08, 0x10, 0xa4, 0x60, 0x0e, 0x05, 0x00, 0xff, 0x96, 0xd0, 0x22, 0xed, 0x1a, 0x84, 0x08,
+    0x91, 0xc7, 0xb0, 0x67, 0xfa, 0xc0, 0x3f, 0xff, 0xe0, 0x1c, 0x00, 0x00, 0xff, 0xe1, 0x0c, 0x6f,
+    0xf4, 0x09, 0x53, 0x01, 0x63, 0x91, 0x93, 0xe3, 0x2f, 0x84, 0x92, 0xf6, 0x63, 0x46, 0x80, 0x08,
+    0x83, 0xa1, 0x00, 0x16, 0x80, 0x5a, 0x12, 0x01, 0xc2, 0xc0, 0x05, 0x04, 0x00, 0xf6, 0x00, 0x04,
+    0x04, 0x03, 0xce, 0x00, 0x10, 0x10, 0x0f, 0x38, 0x01, 0x81, 0x40, 0x3c, 0x40, 0x0f, 0x0e, 0x00,
+    0xf5, 0x00, 0x14, 0x95, 0xc0, 0x34, 0x18, 0x05, 0xc3, 0x19, 0x10, 0xc7, 0x80, 0x08, 0xf4, 0xcc,
+    0xee, 0x1b, 0x40, 0x0c, 0x79, 0xb7, 0x9a, 0x8e, 0x02, 0x01, 0x89, 0x0c, 0x00, 0x41, 0xc0, 0x86,
+    0x01, 0xed, 0x04, 0x3b, 0xd5, 0x00, 0xd0, 0x88, 0x23, 0x91, 0xad, 0xaa, 0x73, 0x95, 0x00, 0x1b,
+    0x58, 0x15, 0x46, 0xf8, 0x20, 0x11, 0x4e, 0xff, 0xb6, 0x04, 0x00, 0x00, 0x13, 0x20, 0x0f, 0xe5,
+    0xca, 0x00, 0xff, 0xf8, 0xbe, 0xff, 0x59, 0x80, 0x75, 0xcb, 0xb1, 0xa6, 0x98, 0x04, 0xc1, 0xf5,
+    0x3a, 0xc3, 0x00, 0x1a, 0x84, 0x02, 0x81, 0x41, 0x00, 0x20, 0x80, 0x61, 0x40, 0x20, 0x01, 0x00,
+    0x78, 0xc0, 0x3f, 0xe1, 0x00, 0xff, 0xff, 0x00, 0x00, 0x07, 0x50, 0x48, 0xa1, 0x62, 0x41, 0x2d,
+    0xb0, 0x0f, 0xf5, 0x40, 0x01, 0x50, 0x03, 0xff, 0xc2, 0x00, 0x00, 0x00, 0xce, 0xa0, 0x19, 0x22,
+    0x88, 0x02, 0x52, 0x42, 0x00, 0x87, 0x6c, 0x03, 0xff, 0x8f, 0x52, 0x01, 0xc8, 0xa0, 0x1f, 0xff,
+    0xf0, 0x0f, 0xfe, 0x48, 0x80, 0x73, 0x03, 0x02, 0x55, 0xc8, 0x70, 0x0a, 0xa1, 0x4a, 0x02, 0xff,
+    0x6b, 0x00, 0x00, 0x00, 0x13, 0x20, 0x0f, 0xcb, 0x94, 0x01, 0xff, 0xef, 0x3b, 0xa2, 0x00, 0xf2,
+    0x6a, 0x79, 0x00, 0x72, 0x50, 0x5a, 0x80, 0x72, 0x58, 0x52, 0x00, 0x72, 0xd8, 0xea, 0x00, 0x72,
+    0x50, 0x69, 0x80, 0x78, 0xc0, 0x12, 0x01, 0xf1, 0x69, 0xab, 0x80, 0x79, 0x4b, 0x4a, 0x10, 0x03,
+    0xe1, 0xe0, 0xa2, 0x00, 0xf8, 0xe4, 0x78, 0x40, 0x3e, 0x67, 0x3b, 0x00, 0xfd, 0x08, 0xae, 0x00,
+    0x13, 0x20, 0x02, 0xe5, 0x00, 0x7f, 0xff, 0xc0, 0x0c, 0x0d, 0x02, 0x4a, 0x2e, 0x41, 0x5d, 0x86,
+    0x00, 0x00, 0xff, 0xe3, 0x9d, 0xb0, 0xc7, 0x7e, 0x18, 0x00, 0xab, 0xbf, 0x58, 0x00, 0xe9, 0xda,
+    0xa8, 0xa7, 0xa6, 0x6c, 0x74, 0x52, 0x97, 0x00, 0x99, 0x9b, 0x54, 0xc1, 0xfe, 0x4d, 0xaa, 0x60,
+    0x40, 0x80, 0x56, 0x01, 0x1b, 0x19, 0xac, 0x02, 0x36, 0x04, 0x00, 0x20, 0x80, 0x6f, 0x04, 0x10,
+    0x0d, 0xe0, 0x40, 0x02, 0x00, 0xe2, 0x02, 0x00, 0xe2, 0x0f, 0x00, 0xff, 0xff, 0x80, 0x7f, 0xfb,
+    0x7c, 0x00, 0x00, 0xff, 0xc7, 0x6c, 0x0f, 0xbf, 0xd6, 0x60, 0x07, 0x4e, 0xb9, 0x76, 0x34, 0xd3,
+    0x00, 0x98, 0x3e, 0xa7, 0x58, 0x60, 0x03, 0x50, 0x80, 0x50, 0x28, 0x20, 0x04, 0x10, 0x0c, 0x28,
+    0x04, 0x00, 0x20, 0x0f, 0x18, 0x07, 0xfc, 0x20, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xe1, 0x0c,
+    0x6f, 0xf6, 0x30, 0x06, 0x2c, 0x73, 0x55, 0x14, 0xd8, 0x80, 0x38, 0x9f, 0xaa, 0xfd, 0x11, 0x20,
+    0x86, 0x90, 0x01, 0x0d, 0x13, 0x8e, 0x87, 0x80, 0x70, 0xd0, 0x3a, 0x82, 0x80, 0x78, 0xc3, 0x84,
+    0x04, 0x03, 0xce, 0x02, 0x20, 0x0f, 0xf0, 0xb0, 0x18, 0x07, 0x94, 0x3f, 0x02, 0xc0, 0x3d, 0x40,
+    0xae, 0x2e, 0x80, 0x19, 0xcd, 0x08, 0x68, 0x2e, 0x99, 0xee, 0x0a, 0x40, 0x09, 0x86, 0xb3, 0x08,
+    0xbe, 0x40, 0x11, 0xe6, 0xdd, 0xba, 0x88, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x9d, 0xb0, 0x36, 0x7f,
+    0x51, 0x80, 0x4e, 0x9d, 0x52, 0x28, 0x0b, 0x8a, 0x01, 0x99, 0x2b, 0x6f, 0xa0, 0x2c, 0x80, 0x21,
+    0xb5, 0x00, 0x9d, 0xc3, 0x60, 0x11, 0xa8, 0x07, 0x48, 0x38, 0x04, 0xa0, 0x1e, 0x14, 0x11, 0x00,
+    0x38, 0x03, 0xe1, 0x03, 0x00, 0x78, 0x07, 0xc2, 0x06, 0x00, 0x30, 0x0f, 0x94, 0x44, 0x00, 0x42,
+    0x00, 0xe5, 0x17, 0x00, 0xdc, 0x20, 0x11, 0xd8, 0x50, 0x04, 0xc3, 0xf2, 0xf5, 0x83, 0x06, 0x01,
+    0x0f, 0xab, 0x42, 0x8c, 0xb8, 0x07, 0x15, 0xed, 0xe7, 0x30, 0x07, 0xe2, 0x43, 0x00, 0xff, 0xf0,
+    0x3a, 0x70, 0x07, 0xf8, 0x00, 0x00, 0x0c, 0x6f, 0xec, 0x09, 0x5b, 0x01, 0x63, 0x91, 0x83, 0xe3,
+    0x27, 0x84, 0x92, 0x6e, 0x6e, 0x86, 0x80, 0x08, 0x83, 0xb2, 0x00, 0x16, 0x80, 0x5a, 0x12, 0x01,
+    0xc2, 0xc0, 0x05, 0x04, 0x00, 0xf6, 0x00, 0x04, 0x04, 0x03, 0xce, 0x00, 0x10, 0x10, 0x0f, 0x38,
+    0x01, 0x81, 0x40, 0x3c, 0x40, 0x0f, 0x0e, 0x00, 0xf5, 0x00, 0x14, 0x95, 0xc0, 0x34, 0x18, 0x05,
+    0xc3, 0x18, 0xee, 0xc7, 0x80, 0x08, 0xf4, 0xcd, 0x10, 0x1a, 0x40, 0x0c, 0x79, 0xb7, 0x9a, 0xa0,
+    0x1f, 0x12, 0x18, 0x07, 0xff, 0x98, 0x53, 0xc0, 0x00, 0x00, 0xfc, 0x76, 0xc0, 0x53, 0xd4, 0xe9,
+    0xc9, 0x8c, 0x26, 0x00, 0x2a, 0x4c, 0xf9, 0x00, 0x2c, 0xd1, 0x80, 0x63, 0x70, 0x0f, 0x28, 0x07,
+    0xc2, 0x01, 0xff, 0xe9, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x94, 0xf7, 0xf5, 0xa8, 0x04, 0x58, 0xc4,
+    0xaa, 0x4a, 0x90, 0x04, 0x0c, 0x65, 0x5e, 0x9b, 0x20, 0x38, 0x38, 0x04, 0x5b, 0x48, 0x02, 0x0a,
+    0x01, 0x85, 0x40, 0x12, 0x15, 0x45, 0x10, 0x0e, 0x5b, 0x35, 0xae, 0xb5, 0x00, 0xc9, 0x98, 0x83,
+    0x4a, 0xa0, 0x07, 0x1b, 0xe6, 0x09, 0x54, 0x02, 0x40, 0x18, 0xec, 0x08, 0x73, 0xc8, 0x03, 0x70,
+    0x10, 0xd1, 0x64, 0x2b, 0x53, 0x92, 0x03, 0xd1, 0xbd, 0x4a, 0xa7, 0x88, 0x01, 0x77, 0x57, 0x6d,
+    0xb2, 0x00, 0x00, 0x00, 0x2d, 0x18, 0x07, 0x6a, 0xb8, 0x07, 0xff, 0x1d, 0x6d, 0x42, 0x2e, 0xd5,
+    0xa8, 0x40, 0x68, 0x94, 0x7b, 0x85, 0xff, 0xb8, 0x03, 0xff, 0xdd, 0xc0, 0x60, 0x1c, 0x81, 0x2c,
+    0x88, 0x00, 0x14, 0x0c, 0xdf, 0x00, 0x4f, 0xb5, 0x32, 0x00, 0x4b, 0x40, 0x0f, 0x3d, 0x89, 0x21,
+    0x00, 0x7b, 0x50, 0x03, 0xff, 0xfa, 0x60, 0x20, 0x1e, 0x10, 0x00, 0x86, 0x80, 0x70, 0xa8, 0x01,
+    0x41, 0x4c, 0x03, 0x58, 0x80, 0x05, 0xc3, 0x61, 0x5b, 0x19, 0x00, 0x28, 0x71, 0x7a, 0x96, 0xd1,
+    0x00, 0xd1, 0xd7, 0x6e, 0xa1, 0xaf, 0x10, 0x00, 0x8b, 0x20, 0x0f, 0x15, 0xc7, 0x25, 0x00, 0x79,
+    0x53, 0x9c, 0x54, 0x03, 0xd4, 0x2e, 0x2e, 0x48, 0x01, 0x90, 0x9c, 0x43, 0x43, 0x80, 0x36, 0x86,
+    0x80, 0x10, 0x90, 0x40, 0x27, 0x24, 0x00, 0xa8, 0x5c, 0x00, 0xa3, 0x40, 0x19, 0x43, 0x40, 0x1c,
+    0x0c, 0x01, 0x89, 0x10, 0x42, 0x8a, 0x20, 0x1d, 0xc1, 0x4c, 0x1c, 0x01, 0xe5, 0x15, 0xa2, 0x40,
+    0x0f, 0x98, 0x88, 0xa0, 0x1f, 0xa8, 0x01, 0x40, 0x18, 0x00, 0x8b, 0x20, 0x0e, 0x7b, 0x50, 0x0e,
+    0x4b, 0x6f, 0x45, 0x00, 0xe9, 0x4e, 0x00, 0xed, 0x43, 0x50, 0xb0, 0x0c, 0x62, 0x24, 0x10, 0x0c,
+    0xe2, 0xa4, 0x66, 0x10, 0x0a, 0xc2, 0x01, 0xc0, 0x23, 0x14, 0x00, 0x58, 0x38, 0x04, 0x86, 0xc3,
+    0x80, 0x15, 0x87, 0x80, 0x14, 0x30, 0x00, 0x46, 0x80, 0x88, 0x00, 0x94, 0x54, 0x00, 0x46, 0x82,
+    0x08, 0x16, 0x18, 0x28, 0x04, 0x44, 0x00, 0xd6, 0x28, 0x1a, 0x26, 0x0e, 0x1a, 0x0a, 0x1e, 0x01,
+    0x94, 0x30, 0x51, 0xc0, 0x02, 0x88, 0x0c, 0x14, 0x00, 0xc4, 0x6e, 0x81, 0x80, 0x16, 0x12, 0x24,
+    0x20, 0x1d, 0x63, 0x00, 0x80, 0x12, 0x84, 0x87, 0x80, 0x79, 0x40, 0x90, 0x40, 0x22, 0x28, 0x50,
+    0x03, 0xc4, 0x61, 0xa0, 0x1c, 0xa0, 0x82, 0x01, 0x00, 0x2b, 0x90, 0x0e, 0x2a, 0xa0, 0x11, 0x19,
+    0xc0, 0x34, 0x2f, 0x80, 0x20, 0xa0, 0xc0, 0x0a, 0xb8, 0x00, 0x32, 0x1e, 0x03, 0x63, 0x60, 0x19,
+    0x1c, 0xe2, 0x03, 0x42, 0x01, 0xd0, 0x6e, 0xcc, 0x40, 0x0f, 0xa8, 0x01, 0x00, 0x1f, 0x0c, 0x00,
+    0x24, 0x03, 0xeb, 0x1a, 0x37, 0x40, 0x0e, 0x65, 0x5b, 0x82, 0x44, 0x02, 0x28, 0x1b, 0x02, 0x82,
+    0xb0, 0x0a, 0x46, 0xc4, 0x00, 0xe6, 0xaa, 0x06, 0x45, 0x50, 0x06, 0xf1, 0x81, 0x00, 0x8b, 0x30,
+    0x0f, 0x0d, 0xd7, 0x25, 0x00, 0x79, 0xd0, 0xdc, 0x5c, 0x40, 0x3a, 0x82, 0x85, 0xc5, 0x00, 0x31,
+    0x19, 0xc1, 0x41, 0xc0, 0x19, 0x42, 0x80, 0x06, 0x64, 0x20, 0x0a, 0x81, 0xc0, 0x2b, 0x05, 0x00,
+    0x19, 0x28, 0x80, 0x4c, 0x14, 0x00, 0xa0, 0xe0, 0x0c, 0x2a, 0x48, 0x0e, 0x48, 0x01, 0xdc, 0x1a,
+    0xa3, 0x40, 0x1e, 0x42, 0x7e, 0x05, 0x00, 0xfa, 0x85, 0x10, 0x40, 0x1f, 0x28, 0x03, 0x80, 0x3f,
+    0xc2, 0xa0, 0x1f, 0x94, 0x18, 0x03, 0xfa, 0x82, 0xc0, 0x3f, 0x21, 0x19, 0x80, 0x3f, 0x68, 0x50,
+    0x07, 0xf1, 0xa3, 0x80, 0x78, 0x00, 0x1b, 0xbf, 0xe6, 0x04, 0x4f, 0xee, 0x1f, 0xff, 0x58, 0x14,
+    0x80, 0x78, 0xa8, 0x24, 0x40, 0x3d, 0x23, 0x08, 0x01, 0xe8, 0x44, 0x38, 0x07, 0x91, 0xca, 0x80,
+    0x3c, 0x54, 0x12, 0x20, 0x1e, 0x91, 0x84, 0x00, 0xf4, 0x22, 0x1c, 0x03, 0xc8, 0xe5, 0x40, 0x1e,
+    0x1a, 0x06, 0x98, 0x8e, 0x72, 0x10, 0x47, 0x7f, 0x51, 0xe6, 0x7f, 0x78, 0x00, 0x00, 0xf0, 0x88,
+    0x03, 0x1e, 0x75, 0x00, 0x43, 0xa6, 0x9a, 0x01, 0x20, 0xb5, 0xb0, 0x04, 0x41, 0xa0, 0x1d, 0xe0,
+    0xe0, 0x1f, 0xfc, 0x91, 0x01, 0x00, 0xe4, 0x12, 0x00, 0x0a, 0xe1, 0x40, 0x04, 0xf4, 0x74, 0xc0,
+    0x12, 0xa8, 0x6c, 0xc0, 0x23, 0xac, 0x1f, 0x00, 0xe2, 0x53, 0x10, 0x0e, 0x20, 0x20, 0x0f, 0xfe,
+    0x4f, 0x80, 0x7c, 0x20, 0x80, 0x1c, 0x81, 0x2e, 0x60, 0x11, 0x48, 0xc4, 0x00, 0x33, 0x75, 0x78,
+    0x00, 0x12, 0x15, 0xd9, 0x00, 0xff, 0xf8, 0x34, 0x58, 0x00, 0x11, 0x00, 0x79, 0xfb, 0x54, 0x03,
+    0x2a, 0x8a, 0x90, 0x02, 0x3a, 0xb0, 0xe0, 0x0e, 0x41, 0x60, 0x0f, 0x18, 0x07, 0xff, 0x2c, 0x48,
+    0x03, 0xca, 0x26, 0x01, 0xd6, 0x3c, 0xc4, 0x01, 0x16, 0x04, 0xc8, 0x02, 0x19, 0x24, 0xd0, 0x0a,
+    0x52, 0x6d, 0x80, 0x24, 0x16, 0x00, 0xe1, 0x20, 0x0f, 0xfe, 0x51, 0x80, 0x78, 0x85, 0x80, 0x22,
+    0x6f, 0x0c, 0x00, 0x92, 0x49, 0x58, 0x02, 0x59, 0xda, 0x00, 0xc0, 0x00, 0x03, 0xac, 0x71, 0x00,
+    0x24, 0x09, 0x6a, 0x94, 0x7c, 0xbd, 0x28, 0x28, 0x6f, 0x5a, 0xb4, 0x1f, 0x0b, 0xf9, 0x02, 0x5e,
+    0xde, 0x98, 0x00, 0x00, 0x49, 0x9f, 0xfe, 0x2b, 0x13, 0x37, 0xff, 0x17, 0xdf, 0x77, 0xff, 0x87,
+    0x60, 0x01, 0x22, 0x19, 0x88, 0xbf, 0xe7, 0x01, 0x00, 0xaf, 0x10, 0x03, 0xfc, 0xe0, 0x1d, 0xa5,
+    0x70, 0x01, 0xff, 0x78, 0x04, 0xfa, 0x6f, 0x86, 0x01, 0xf0, 0x80, 0x78, 0xb1, 0xcf, 0x1c, 0x03,
+    0xc6, 0x02, 0x01, 0xe8, 0xb1, 0x86, 0x00, 0xff, 0xe1, 0xa7, 0xb3, 0x00, 0x0b, 0x00, 0x20, 0x60,
+    0x1f, 0x86, 0x4a, 0x3a, 0x98, 0x03, 0xff, 0x2d, 0xeb, 0x83, 0xe0, 0x78, 0x07, 0xc5, 0x1d, 0x48,
+    0x8a, 0xe8, 0x20, 0x10, 0x10, 0x09, 0x6f, 0x5c, 0x1f, 0x6d, 0x40, 0x3c, 0xe5, 0x1d, 0x48, 0x73,
+    0xf0, 0x40, 0x1e, 0x30, 0x05, 0xb8, 0x36, 0x61, 0x84, 0x03, 0xf0, 0x80, 0xd4, 0xfc, 0x98, 0x07,
+    0xfc, 0xc0, 0x46, 0xc2, 0x01, 0xff, 0x0c, 0x11, 0x80, 0x7f, 0xab, 0xbb, 0x9c, 0x24, 0x03, 0xfd,
+    0x84, 0x52, 0xa3, 0x5a, 0x80, 0x00, 0x00, 0xe1, 0x00, 0xf8, 0xc0, 0x3f, 0xf2, 0xf9, 0x80, 0x73,
+    0xe2, 0x80, 0x7f, 0xde, 0x24, 0x01, 0xcc, 0x1c, 0x01, 0xfe, 0x14, 0x41, 0x2a, 0xf2, 0x1a, 0x32,
+    0xaf, 0x20, 0x04, 0xe3, 0xd7, 0x55, 0xe3, 0x09, 0xaa, 0xee, 0x00, 0xa8, 0x52, 0xb3, 0x3f, 0xf8,
+    0x50, 0x00, 0x33, 0x20, 0x91, 0x9f, 0xff, 0x08, 0x80, 0x14, 0x01, 0x8a, 0x23, 0xfe, 0x70, 0x08,
+    0x98, 0x03, 0x0a, 0x27, 0xfd, 0xa0, 0x14, 0x00, 0x71, 0xe6, 0x7f, 0xd4, 0x00, 0x35, 0x62, 0x00,
+    0xff, 0xe3, 0x48, 0xc0, 0x06, 0x3f, 0xff, 0xfb, 0x00, 0x19, 0x02, 0x01, 0x8a, 0x67, 0xff, 0x00,
+    0x1d, 0x80, 0x38, 0x59, 0xbf, 0xe5, 0x00, 0x08, 0x07, 0x85, 0x9b, 0xfe, 0x50, 0x0f, 0xe3, 0x99,
+    0xff, 0xc0, 0x1f, 0xf3, 0xf7, 0x7e, 0x30, 0x0f, 0xfd, 0xe2, 0x3f, 0x80, 0x3f, 0xfa, 0xfa, 0xab,
+    0xf8, 0x40, 0x3f, 0xf2, 0xd5, 0x7e, 0x20, 0x0f, 0xfc, 0xfd, 0xdf, 0x8c, 0x03, 0xcb, 0x80, 0x03,
+    0x7c, 0x11, 0xfd, 0x54, 0x00, 0x00, 0x09, 0xbb, 0xff, 0xe3, 0x50, 0x00, 0xc0, 0x3f, 0x2a, 0x80,
+    0x3f, 0xea, 0xbb, 0xfc, 0x44, 0xbb, 0xfd, 0x40, 0x1f, 0xfc, 0xe7, 0xaa, 0xf1, 0x12, 0xab, 0xce,
+    0x01, 0xec, 0x56, 0x6e, 0x01, 0x66, 0xe5, 0xc0, 0x0f, 0x8b, 0x33, 0x88, 0xf3, 0x38, 0xc0, 0x3f,
+    0xfa, 0x66, 0x7c, 0x02, 0x67, 0xc2, 0x01, 0xf8, 0xb3, 0x38, 0xcb, 0x33, 0x88, 0x03, 0xf1, 0x5d,
+    0xf1, 0x95, 0xdf, 0x10, 0x07, 0xf2, 0x27, 0x00, 0xa2, 0x70, 0x80, 0x7f, 0xf3, 0x9b, 0x30, 0xa5,
+    0x99, 0xc4, 0x4c, 0xce, 0x25, 0xcc, 0x28, 0x07, 0xf8, 0x88, 0x01, 0xfe, 0x6c, 0xc2, 0x96, 0x67,
+    0xfe, 0x25, 0xcc, 0x28, 0x07, 0xff, 0x6c, 0x40, 0x3f, 0xf8, 0x84, 0xef, 0x51, 0x10, 0x03, 0xff,
+    0x86, 0x31, 0x12, 0x95, 0x00, 0x7b, 0xe0, 0x03, 0xe3, 0xcc, 0x6e, 0xc6, 0x01, 0x00, 0x00, 0xff,
+    0xc8, 0x80, 0x0f, 0xfe, 0x3d, 0x78, 0x07, 0xff, 0x20, 0x40, 0x3e, 0x28, 0x8f, 0x94, 0x03, 0xff,
+    0x33, 0xbf, 0xd8, 0x01, 0x08, 0x07, 0xe4, 0xee, 0x68, 0x37, 0x72, 0x11, 0x20, 0x14, 0x4f, 0x08,
+    0x08, 0x8c, 0x04, 0x75, 0xdc, 0x09, 0x77, 0xe5, 0x00, 0xfe, 0xaa, 0x48, 0x25, 0x56, 0x60, 0x0f,
+    0xf9, 0x54, 0x80, 0x6a, 0xbb, 0xc1, 0xc0, 0x3f, 0xf8, 0x3e, 0x01, 0x84, 0x03, 0xff, 0x82, 0x20,
+    0x20, 0x1e, 0x10, 0x0f, 0xf9, 0xc0, 0xc0, 0x37, 0x80, 0x7f, 0xf0, 0x48, 0x18, 0x03, 0xc6, 0x01,
+    0xff, 0x70, 0x10, 0x06, 0x10, 0x0f, 0xfe, 0x0a, 0x08, 0x80, 0x3c, 0x20, 0x1c, 0x2b, 0x18, 0x04,
+    0x6e, 0x01, 0xc6, 0x01, 0x13, 0x40, 0x35, 0x39, 0x0d, 0x06, 0x00, 0x70, 0x88, 0x23, 0x65, 0x89,
+    0xa7, 0x78, 0xdc, 0xd4, 0x03, 0xf6, 0x3d, 0x76, 0xcb, 0x10, 0xf0, 0x48, 0x07, 0x98, 0xc1, 0x21,
+    0x44, 0x03, 0x59, 0xb2, 0x80, 0x71, 0x93, 0x00, 0x7e, 0xa5, 0x49, 0x00, 0x5d, 0xd9, 0x80, 0xd0,
+    0x0f, 0xa1, 0x4e, 0x80, 0x21, 0x66, 0x02, 0x4b, 0x00, 0x7d, 0x2f, 0xa2, 0x01, 0x56, 0xeb, 0x2d,
+    0x80, 0x00, 0x00, 0x00, 0x84, 0x8b, 0xff, 0x84, 0x20, 0x1e, 0x6d, 0xdf, 0xfe, 0x13, 0x00, 0x7e,
+    0x8a, 0xaf, 0xf4, 0x00, 0x7f, 0x8d, 0x57, 0xfc, 0x60, 0x1f, 0xfd, 0x43, 0x44, 0xff, 0x18, 0x07,
+    0xfa, 0x2e, 0xff, 0xd0, 0x01, 0xf9, 0xb7, 0x7f, 0xf8, 0x4c, 0x01, 0xe1, 0x22, 0xff, 0xe1, 0x08,
+    0x04, 0xb1, 0x1f, 0xfc, 0x85, 0xd6, 0x6c, 0xec, 0xdf, 0xfc, 0x3c, 0x8e, 0xea, 0xc2, 0x7b, 0xbf,
+    0xf8, 0x52, 0x01, 0xb0, 0x10, 0x03, 0xff, 0x8e, 0xa1, 0x6e, 0xff, 0xf0, 0x80, 0x7c, 0x42, 0xd3,
+    0x3f, 0xd1, 0x00, 0x0f, 0xdd, 0xdf, 0xf8, 0xc0, 0x40, 0x3f, 0xf8, 0xe4, 0x20, 0x1f, 0xfc, 0x71,
+    0x11, 0x00, 0x7f, 0xf1, 0xd4, 0x18, 0x03, 0xff, 0x3c, 0x47, 0x55, 0x03, 0xc0, 0x3f, 0xf6, 0x3b,
+    0xf2, 0x9b, 0xa8, 0x07, 0xfe, 0xae, 0xee, 0xfd, 0x80, 0x0e, 0x00, 0x00, 0xe2, 0x00, 0xf8, 0x4c,
+    0x40, 0x3f, 0xec, 0xb0, 0x0f, 0x2e, 0x38, 0x07, 0xf8, 0xc4, 0xc0, 0x3f, 0xf8, 0xf6, 0x18, 0x01,
+    0xff, 0xc7, 0x50, 0x26, 0x6c, 0x80, 0x1f, 0xfc, 0x14, 0x20, 0x99, 0xed, 0x00, 0xff, 0xe0, 0xf0,
+    0x55, 0xdd, 0x40, 0x20, 0x1f, 0xf8, 0x95, 0x15, 0x12, 0x00, 0x68, 0x05, 0x80, 0x1f, 0xac, 0x3c,
+    0x03, 0x68, 0x38, 0x04, 0xb6, 0x20, 0x1c, 0x2c, 0x2a, 0x01, 0x90, 0x48, 0x02, 0x34, 0xc2, 0x00,
+    0xd0, 0x03, 0xe8, 0x00, 0x23, 0x70, 0x0d, 0x54, 0x2c, 0x40, 0x02, 0x32, 0x50, 0x5c, 0x02, 0x86,
+    0x80, 0x72, 0xd8, 0x5b, 0x01, 0x8c, 0xae, 0x13, 0x9d, 0x12, 0x00, 0x79, 0x34, 0xa5, 0x1e, 0x88,
+    0x0b, 0x29, 0x4a, 0xc0, 0x3f, 0x1f, 0xaa, 0x02, 0x00, 0x42, 0x96, 0x2c, 0x01, 0xfc, 0x54, 0x01,
+    0xf5, 0x94, 0x00, 0x7f, 0xf1, 0x95, 0x66, 0x00, 0xff, 0xe2, 0xa5, 0x0d, 0x80, 0x7f, 0xf1, 0x52,
+    0x83, 0x44, 0x03, 0xff, 0x88, 0xb4, 0x36, 0x60, 0x1f, 0xfc, 0x47, 0xa0, 0xb4, 0x00, 0xff, 0xe2,
+    0x0d, 0x0e, 0xa0, 0x07, 0xff, 0x14, 0x7f, 0x0c, 0x03, 0xf9, 0x9d, 0x40, 0x3c, 0x00, 0x00, 0xff,
+    0x12, 0x00, 0x7f, 0xf0, 0xd0, 0x03, 0x55, 0x90, 0x07, 0xff, 0x05, 0x2d, 0x80, 0x21, 0x00, 0xff,
+    0xe1, 0xe8, 0x20, 0x07, 0x18, 0x07, 0xff, 0x05, 0xcc, 0x80, 0x3f, 0xf8, 0xca, 0x27, 0xdd, 0x98,
+    0x3f, 0xbb, 0xe0, 0x0e, 0x91, 0x45, 0x5c, 0x40, 0xab, 0xf2, 0x00, 0x63, 0x33, 0x5d, 0xf3, 0x85,
+    0x5d, 0xfa, 0x80, 0x37, 0x85, 0x00, 0x7f, 0xf1, 0x84, 0x18, 0x80, 0x3e, 0x10, 0x0f, 0xf0, 0xe4,
+    0x00, 0x78, 0x40, 0x3f, 0xe2, 0xbb, 0x55, 0xdf, 0x94, 0x2e, 0xff, 0x84, 0x15, 0x7f, 0x84, 0x15,
+    0x7f, 0x8c, 0xbb, 0xbf, 0x68, 0x02, 0x3b, 0xbf, 0x10, 0x07, 0xf4, 0x80, 0xd8, 0x07, 0xff, 0x15,
+    0x15, 0x20, 0x9c, 0x03, 0xff, 0x86, 0x54, 0x32, 0xc9, 0x08, 0x01, 0xff, 0xc1, 0x3c, 0x1b, 0x20,
+    0x91, 0xb5, 0x00, 0xff, 0x9f, 0x06, 0x54, 0x00, 0x5a, 0x35, 0x02, 0x01, 0xf1, 0xe4, 0x0d, 0xb0,
+    0x06, 0x3c, 0x37, 0xc6, 0x00, 0xc7, 0x58, 0x69, 0x88, 0x01, 0xe2, 0xc7, 0x29, 0xd7, 0x11, 0x6a,
+    0x95, 0x59, 0x00, 0x7f, 0x46, 0xa9, 0x41, 0x8d, 0xd6, 0xa8, 0x07, 0xfe, 0x2a, 0xda, 0x20, 0x00,
+    0x00, 0xc4, 0x01, 0x89, 0x00, 0x3c, 0x40, 0x1f, 0x57, 0x88, 0x05, 0xd4, 0x20, 0x18, 0x72, 0x40,
+    0x3d, 0xe5, 0x20, 0x14, 0x0c, 0x80, 0x6b, 0x1d, 0x00, 0xf2, 0xa3, 0x98, 0x01, 0x10, 0xe4, 0x00,
+    0x55, 0x32, 0x00, 0x7d, 0x24, 0xe0, 0x14, 0x28, 0x80, 0xd9, 0x40, 0x07, 0x3e, 0x63, 0x86, 0x33,
+    0x2f, 0x6f, 0xcc, 0x08, 0x6e, 0x61, 0xc0, 0x1c, 0x60, 0x1f, 0xf0, 0x98, 0x80, 0x0f, 0x80, 0x36,
+    0x67, 0xff, 0x10, 0x03, 0xff, 0x9d, 0xc6, 0x0d, 0x33, 0xff, 0x94, 0x0c, 0x40, 0x0f, 0x81, 0xe8,
+    0x9f, 0xce, 0xcc, 0xc0, 0xc8, 0x00, 0xe9, 0xdd, 0xfd, 0x26, 0x0f, 0x20, 0x1f, 0xfc, 0x32, 0xab,
+    0x6d, 0x80, 0x0f, 0xfe, 0x1a, 0xeb, 0xd5, 0x90, 0x07, 0x85, 0x13, 0xfb, 0x02, 0xc5, 0x13, 0xe1,
+    0x4b, 0xbf, 0xe6, 0x09, 0xbb, 0xfc, 0xee, 0xbb, 0xfe, 0x50, 0x9b, 0xbf, 0xc8, 0x48, 0x9f, 0xc4,
+    0x0a, 0x89, 0xf8, 0x80, 0x3f, 0xfa, 0xc2, 0x01, 0xff, 0xc2, 0x14, 0x49, 0x54, 0x06, 0x01, 0xff,
+    0xc3, 0xbb, 0xa8, 0x90, 0x40, 0x3f, 0xf8, 0x43, 0x75, 0x4b, 0xcb, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x89, 0x88, 0x00, 0x80, 0x1f, 0xfc, 0x41, 0x97, 0x03, 0xba, 0x00, 0xff, 0xe1, 0x88, 0x18, 0x1c,
+    0xad, 0x80, 0x7f, 0xf0, 0x8c, 0x04, 0x00, 0xd2, 0x8a, 0x01, 0x89, 0x13, 0xf8, 0x35, 0x12, 0x28,
+    0x14, 0x10, 0x02, 0xdd, 0xfe, 0xa0, 0x5b, 0xbd, 0x17, 0x65, 0x00, 0xd3, 0x55, 0xf1, 0x12, 0xab,
+    0xe5, 0x00, 0xc8, 0xab, 0xf3, 0x82, 0xaf, 0xc2, 0x01, 0xff, 0x8c, 0x80, 0x34, 0xb0, 0x07, 0xff,
+    0x0b, 0x80, 0x80, 0x02, 0xde, 0x01, 0xed, 0xff, 0xe1, 0x02, 0x06, 0x00, 0x30, 0x50, 0x07, 0x95,
+    0x9a, 0x30, 0x09, 0xc0, 0x80, 0x14, 0x66, 0x00, 0xf5, 0xcc, 0xc8, 0x02, 0x04, 0x3e, 0x0c, 0x52,
+    0x01, 0xde, 0x01, 0xc2, 0x01, 0x95, 0x06, 0x0d, 0x40, 0x38, 0x40, 0x40, 0x30, 0x80, 0x46, 0x56,
+    0x30, 0x01, 0xe3, 0x10, 0x0c, 0x66, 0x00, 0xb0, 0x15, 0x48, 0x00, 0x20, 0x09, 0x88, 0x03, 0x08,
+    0x80, 0x26, 0x01, 0xb0, 0x0b, 0xa8, 0x00, 0x6a, 0x01, 0x0a, 0xb0, 0x00, 0xbc, 0x04, 0xc0, 0x22,
+    0x20, 0x20, 0x7b, 0x6e, 0xb8, 0x70, 0x07, 0xc9, 0xc2, 0x00, 0x04, 0x3a, 0x1a, 0x08, 0x42, 0x24,
+    0x96, 0x3c, 0x29, 0x86, 0x55, 0x02, 0x03, 0x8b, 0xa1, 0x26, 0x62, 0xd8, 0xf4, 0xa5, 0x82, 0x0a,
+    0xa6, 0x0c, 0xa4, 0x78, 0x03, 0xc4, 0xb6, 0xc0, 0x01, 0xf2, 0x60, 0x80, 0x89, 0x50, 0x0f, 0x0d,
+    0xa0, 0x06, 0x2d, 0xcf, 0x40, 0x00, 0x00, 0x84, 0x80, 0x3f, 0xf9, 0x13, 0xa0, 0x1f, 0xfc, 0xd3,
+    0xee, 0xff, 0x68, 0x07, 0xf8, 0x44, 0x6c, 0xdf, 0x08, 0x07, 0xfc, 0x4e, 0x5b, 0x11, 0xc2, 0x10,
+    0x00, 0x2c, 0xc2, 0x86, 0x61, 0x82, 0x12, 0x90, 0x02, 0x76, 0x62, 0x80, 0x04, 0x00, 0x60, 0x1e,
+    0xa3, 0xb7, 0x19, 0x85, 0x90, 0x08, 0xf3, 0x0c, 0x19, 0x86, 0x00, 0x0e, 0xac, 0x7b, 0x3d, 0x00,
+    0x7f, 0xf0, 0x85, 0xdc, 0x02, 0x08, 0xc2, 0x01, 0xfe, 0x16, 0xbf, 0x91, 0xae, 0x81, 0x9e, 0xc8,
+    0x30, 0x0e, 0x7d, 0x79, 0x66, 0x66, 0x19, 0xad, 0xc7, 0x07, 0x70, 0x00, 0x8c, 0x20, 0x53, 0x36,
+    0x0c, 0x12, 0x0c, 0x0e, 0x33, 0x90, 0xeb, 0x50, 0x2f, 0x08, 0xc0, 0x3f, 0xe1, 0x05, 0x53, 0x28,
+    0x20, 0x03, 0x3f, 0xf4, 0x06, 0xff, 0xe7, 0x07, 0xe9, 0x20, 0x0d, 0x33, 0xca, 0x11, 0x33, 0x90,
+    0x04, 0x40, 0x1e, 0x56, 0x6d, 0xa0, 0xac, 0xd8, 0xc0, 0x3f, 0xfa, 0x53, 0x77, 0xd4, 0x1d, 0x77,
+    0xca, 0x01, 0xff, 0xc3, 0x70, 0x0f, 0xfe, 0x0c, 0xdd, 0xf5, 0x04, 0xdd, 0xf2, 0xa4, 0x4b, 0x08,
+    0x07, 0xff, 0x19, 0x9c, 0xe0, 0x03, 0xff, 0x8a, 0x9d, 0xcd, 0x60, 0x0f, 0xc8, 0xe6, 0x01, 0xe0,
+    0x00, 0x00, 0xff, 0xe0, 0x91, 0x80, 0x7f, 0xa3, 0xc0, 0x3f, 0x7f, 0x00, 0x7f, 0xf2, 0x28, 0x94,
+    0x03, 0xff, 0x84, 0x8a, 0xb8, 0x01, 0x2a, 0xb9, 0x00, 0x3f, 0xa2, 0xab, 0x40, 0x1d, 0x56, 0x90,
+    0x2b, 0xb2, 0x85, 0xd9, 0x00, 0xf7, 0x7f, 0x90, 0x00, 0x2c, 0xc3, 0x06, 0x60, 0x83, 0x91, 0x1c,
+    0x48, 0xb8, 0x02, 0x3d, 0xd3, 0x06, 0xe9, 0x58, 0x40, 0x6a, 0x40, 0x38, 0x98, 0x03, 0xfa, 0xa8,
+    0x0e, 0x1e, 0x01, 0xd3, 0x60, 0x1f, 0xfb, 0x45, 0x00, 0x3f, 0xf8, 0x2b, 0x67, 0x77, 0x20, 0x55,
+    0xdf, 0xca, 0x00, 0x12, 0x0a, 0x57, 0x79, 0x40, 0x9d, 0xf2, 0xa3, 0xb8, 0x0e, 0xb9, 0x42, 0x7d,
+    0x33, 0x06, 0x6c, 0xce, 0x04, 0xcc, 0x2d, 0xa3, 0x28, 0x30, 0x80, 0x14, 0xa8, 0x03, 0x20, 0xe8,
+    0x05, 0x3f, 0x24, 0x01, 0xdc, 0x2c, 0x01, 0xbc, 0x1c, 0x02, 0x11, 0x00, 0x78, 0x58, 0x6c, 0xc0,
+    0x08, 0x86, 0x10, 0x0f, 0xf8, 0x72, 0x17, 0x28, 0xe8, 0x6c, 0x03, 0xff, 0x82, 0x2f, 0xec, 0xb8,
+    0x30, 0x40, 0x1f, 0xfc, 0x31, 0xf1, 0x00, 0x5a, 0x80, 0x7f, 0xf0, 0x97, 0x24, 0xee, 0x4e, 0xac,
+    0x80, 0x04, 0xce, 0xa2, 0x00, 0x38, 0xda, 0x27, 0xc4, 0x6c, 0x54, 0xc7, 0x06, 0x98, 0x26, 0x04,
+    0xc7, 0x08, 0xf8, 0x10, 0x01, 0x55, 0x02, 0x45, 0x33, 0x1b, 0x00, 0x8d, 0x7a, 0xe2, 0x01, 0xe5,
+    0xfd, 0x10, 0x00, 0x00, 0x84, 0x40, 0x1f, 0x88, 0xc0, 0x3f, 0xd7, 0xe0, 0x1f, 0xbf, 0x44, 0x03,
+    0xff, 0x8f, 0x62, 0xe0, 0x1f, 0xfc, 0x2c, 0xce, 0xa0, 0x8c, 0xcd, 0x20, 0x1f, 0xcc, 0xc2, 0x23,
+    0x31, 0x51, 0x8c, 0x18, 0x41, 0x2e, 0xc8, 0x37, 0x63, 0xaa, 0x30, 0x55, 0x6e, 0x08, 0xa8, 0x00,
+    0x3b, 0x80, 0x0e, 0xe0, 0x0b, 0x05, 0x00, 0x2c, 0x14, 0x00, 0x93, 0x30, 0x83, 0x98, 0x30, 0x02,
+    0x81, 0x80, 0x48, 0x80, 0x0f, 0xf9, 0x9d, 0xcc, 0x36, 0xee, 0x83, 0x17, 0x78, 0xc0, 0x3e, 0xd9,
+    0x98, 0x0a, 0x64, 0xc2, 0xb3, 0x32, 0x80, 0x71, 0x45, 0xf7, 0x59, 0x7f, 0xdd, 0xf3, 0x00, 0x42,
+    0x2d, 0x71, 0x00, 0xaa, 0x84, 0x01, 0xf8, 0xe7, 0x90, 0x23, 0x40, 0x46, 0x64, 0x21, 0x1f, 0x82,
+    0x1d, 0xc6, 0x2e, 0x3d, 0xd8, 0x53, 0xbb, 0xf4, 0x43, 0xe5, 0x80, 0x05, 0x55, 0x09, 0xd5, 0x70,
+    0x25, 0x52, 0xcc, 0x40, 0x30, 0xaa, 0x88, 0x61, 0x57, 0x18, 0x7a, 0xa8, 0xc0, 0x3f, 0x0c, 0x89,
+    0x00, 0x43, 0x08, 0x80, 0x0f, 0xf8, 0x6d, 0x67, 0xa0, 0xf4, 0x28, 0x03, 0xff, 0x82, 0xb7, 0xac,
+    0xf8, 0x72, 0x20, 0x1f, 0x08, 0x07, 0x85, 0x10, 0x06, 0x31, 0x68, 0x01, 0x23, 0xc2, 0x90, 0x0a,
+    0x46, 0x74, 0x84, 0xe7, 0xc2, 0xde, 0x20, 0x1c, 0x38, 0x50, 0x35, 0xb8, 0xbe, 0x61, 0x80, 0x5f,
+    0xe0, 0xac, 0x5b, 0x75, 0xcc, 0x0b, 0x3b, 0xa8, 0x30, 0x0e, 0x17, 0xfb, 0x10, 0x00, 0x00, 0xf1,
+    0x08, 0x06, 0x32, 0x00, 0xff, 0xe1, 0x64, 0x00, 0x6f, 0xc0, 0x0f, 0xfe, 0x39, 0x1a, 0x00, 0x7f,
+    0x1a, 0x80, 0x7e, 0x50, 0xf0, 0x0f, 0xea, 0xb0, 0x0f, 0xd4, 0x00, 0x55, 0xf8, 0x80, 0x3f, 0xc8,
+    0x41, 0x55, 0xf9, 0x40, 0x3f, 0xde, 0x13, 0x3c, 0xc0, 0xf2, 0x80, 0x1f, 0xc8, 0x81, 0x66, 0xee,
+    0x0a, 0x63, 0x00, 0xfe, 0x80, 0x13, 0x00, 0xdc, 0x24, 0x01, 0xfe, 0x73, 0x60, 0x50, 0x0c, 0xa4,
+    0x01, 0xff, 0x59, 0xc9, 0x60, 0x04, 0x26, 0x80, 0x1f, 0xf7, 0x70, 0x15, 0x42, 0x00, 0x40, 0xc0,
+    0x0f, 0xf8, 0x88, 0x16, 0x0c, 0x00, 0xe1, 0x40, 0x0f, 0xfe, 0x11, 0xa4, 0x89, 0x23, 0x00, 0x7e,
+    0x6d, 0x10, 0x0e, 0xf1, 0x89, 0x0a, 0x00, 0xe3, 0x1d, 0x93, 0x00, 0xf2, 0x2b, 0x23, 0x90, 0x06,
+    0x15, 0x00, 0x4f, 0x08, 0x07, 0xb8, 0x01, 0x80, 0x1c, 0x31, 0x5a, 0xc0, 0x1f, 0x15, 0x08, 0x51,
+    0x80, 0x73, 0xa8, 0x07, 0xe3, 0xc1, 0xa9, 0x1d, 0x40, 0x0f, 0xfe, 0x0b, 0x60, 0x5a, 0x34, 0x8d,
+    0xb8, 0x07, 0xf8, 0xaa, 0x4b, 0x50, 0x00, 0xd6, 0x31, 0x64, 0x01, 0xfa, 0x55, 0x58, 0x60, 0x19,
+    0x30, 0xd1, 0x80, 0x3d, 0x39, 0x13, 0x42, 0x01, 0xe2, 0xca, 0x40, 0x00, 0x00, 0xff, 0x09, 0x00,
+    0x7f, 0xe2, 0x00, 0xf9, 0x35, 0x80, 0x3f, 0xd1, 0xa4, 0x01, 0xee, 0x07, 0x00, 0xff, 0x58, 0x48,
+    0x07, 0x0a, 0x28, 0x80, 0x7f, 0x8d, 0x91, 0x40, 0x33, 0x01, 0x2a, 0xfe, 0x30, 0x0a, 0x06, 0xc4,
+    0x02, 0xa0, 0x7a, 0xaf, 0xd0, 0x01, 0x0c, 0x0c, 0x80, 0x18, 0x9e, 0xef, 0xe9, 0x02, 0x00, 0xcc,
+    0x68, 0x03, 0x05, 0x08, 0xe4, 0x89, 0xbc, 0x2c, 0x03, 0xbb, 0x02, 0x46, 0x00, 0x15, 0x20, 0x11,
+    0x33, 0x08, 0x03, 0x88, 0x0d, 0xcd, 0x40, 0x3e, 0xb0, 0xb0, 0x0f, 0xc2, 0x9e, 0x01, 0x18, 0x06,
+    0x45, 0x20, 0x0f, 0x28, 0x95, 0x98, 0x04, 0xc0, 0x60, 0x0c, 0xb0, 0x0f, 0x15, 0x58, 0x07, 0x88,
+    0x14, 0x00, 0x22, 0x00, 0xf2, 0x87, 0x00, 0x71, 0x88, 0x68, 0x07, 0xfa, 0xc5, 0x00, 0x3a, 0xc1,
+    0x10, 0x40, 0x1f, 0x8c, 0xce, 0x01, 0xc2, 0xc5, 0x43, 0x00, 0x1f, 0xac, 0x34, 0x03, 0xac, 0x60,
+    0x59, 0x54, 0x01, 0xf2, 0x92, 0x00, 0x67, 0x55, 0x82, 0x4a, 0xcc, 0x03, 0x90, 0x94, 0x03, 0x3c,
+    0x15, 0x80, 0x07, 0x87, 0x4c, 0x03, 0x68, 0x58, 0x00, 0x66, 0x0b, 0xc4, 0x02, 0x3b, 0x1d, 0x50,
+    0x00, 0xb9, 0x18, 0x26, 0x31, 0xe1, 0x00, 0x72, 0x58, 0x54, 0x88, 0xa2, 0xc0, 0x68, 0x9f, 0x04,
+    0x03, 0xe4, 0xc3, 0x65, 0x06, 0x60, 0x0d, 0xe4, 0x00, 0x7f, 0x8b, 0x29, 0x00, 0x00, 0x00, 0xce,
+    0x60, 0x1e, 0x67, 0x00, 0xfe, 0x28, 0xa0, 0x0f, 0x55, 0x00, 0x3f, 0x90, 0x30, 0x03, 0x88, 0xd0,
+    0x03, 0xfb, 0x01, 0x00, 0x39, 0x42, 0x80, 0x3c, 0x91, 0x04, 0x19, 0x88, 0x30, 0x02, 0x81, 0x1d,
+    0xf9, 0x4d, 0xdc, 0x22, 0x77, 0xb0, 0x10, 0x82, 0x23, 0xd8, 0x00, 0xde, 0xec, 0x20, 0x0f, 0x1c,
+    0xdd, 0xe0, 0x0c, 0x62, 0x38, 0x00, 0x88, 0x63, 0x22, 0xc6, 0x02, 0x01, 0xfd, 0x03, 0x20, 0x1f,
+    0xfc, 0x5e, 0xb0, 0x0f, 0xde, 0x01, 0xfc, 0x49, 0x90, 0x01, 0x8c, 0x03, 0x29, 0x9e, 0x00, 0x85,
+    0xdc, 0xa0, 0x1c, 0x20, 0x0b, 0xcc, 0xc2, 0x01, 0x59, 0x59, 0x00, 0x04, 0x03, 0x3c, 0x46, 0x10,
+    0x08, 0x78, 0x78, 0x03, 0x18, 0x02, 0x5d, 0xf0, 0x07, 0x1c, 0x1a, 0x83, 0x80, 0x7f, 0xf0, 0xde,
+    0xd4, 0x04, 0x04, 0x03, 0xff, 0x84, 0x80, 0x1f, 0xfc, 0xc7, 0x00, 0xff, 0xe2, 0x98, 0x06, 0xcd,
+    0xdc, 0x20, 0x1f, 0xd8, 0x02, 0x00, 0x11, 0xe3, 0x20, 0x09, 0xae, 0xed, 0x52, 0x20, 0x03, 0x73,
+    0x3a, 0x00, 0x32, 0x24, 0x69, 0xc0, 0x90, 0x20, 0x1f, 0xcd, 0xff, 0x75, 0x98, 0x00, 0x00, 0x00,
+    0xe4, 0x00, 0xff, 0xe4, 0x15, 0xc8, 0x07, 0xff, 0x1e, 0x06, 0xc0, 0x02, 0x3f, 0xf8, 0x03, 0x1a,
+    0xb1, 0x00, 0x2b, 0xbb, 0xfd, 0x40, 0x1b, 0xc6, 0x40, 0x2d, 0x66, 0xc2, 0x26, 0x6d, 0x80, 0x13,
+    0x1c, 0x08, 0x3b, 0x32, 0x67, 0x11, 0x26, 0x73, 0x80, 0x0a, 0x11, 0x80, 0xa3, 0x40, 0x3f, 0xf8,
+    0x5c, 0x1e, 0x6b, 0x21, 0x00, 0x1f, 0xfc, 0x13, 0x30, 0xde, 0x52, 0x39, 0x80, 0x7f, 0xf0, 0x4d,
+    0xe2, 0xa8, 0x25, 0x20, 0x1f, 0xfc, 0x38, 0x75, 0xe1, 0x91, 0x00, 0xff, 0xe2, 0xba, 0x3a, 0x00,
+    0x7f, 0xf1, 0x52, 0x0e, 0x00, 0x3f, 0xf8, 0xa7, 0x43, 0xe6, 0xae, 0x40, 0x1f, 0xfc, 0x2f, 0x11,
+    0x66, 0x2a, 0x18, 0x03, 0xff, 0x84, 0xa6, 0xaf, 0x37, 0xa8, 0x01, 0xff, 0xc2, 0x9c, 0xa8, 0x64,
+    0x20, 0x0f, 0xfe, 0xd0, 0x9b, 0x45, 0xeb, 0x80, 0x7f, 0xf0, 0x5b, 0x7b, 0x25, 0xd0, 0x3d, 0xdf,
+    0x88, 0x8e, 0xfc, 0x60, 0x05, 0x7a, 0xcf, 0xdf, 0x88, 0xe1, 0x14, 0x47, 0x2b, 0x6d, 0x42, 0x98,
+    0x01, 0xb7, 0x7f, 0xf3, 0x80, 0x00, 0x00, 0xff, 0xe0, 0x91, 0x00, 0x3f, 0x90, 0xc0, 0x3f, 0xbe,
+    0x40, 0x3f, 0x0d, 0x70, 0x04, 0x89, 0xe0, 0x74, 0x4f, 0x00, 0x06, 0xca, 0x00, 0x13, 0x77, 0xc4,
+    0x77, 0x7e, 0x00, 0x95, 0x4e, 0x81, 0xbf, 0xfc, 0x49, 0xff, 0xe0, 0x0d, 0x63, 0x00, 0x2a, 0xbc,
+    0x6e, 0xab, 0xc4, 0x01, 0x86, 0xb4, 0x0e, 0x23, 0x84, 0xa2, 0x39, 0x00, 0x39, 0x04, 0x0b, 0x77,
+    0x89, 0x77, 0x79, 0x80, 0xd5, 0x62, 0x04, 0x66, 0xf1, 0xbb, 0x37, 0x91, 0x15, 0x52, 0x06, 0x5d,
+    0xf8, 0xc6, 0xef, 0xda, 0xd9, 0x40, 0x14, 0x6e, 0xff, 0xf0, 0xa4, 0x4d, 0xc0, 0x39, 0x9d, 0xff,
+    0xcc, 0x01, 0xfe, 0x89, 0xaa, 0xfd, 0x34, 0x01, 0xff, 0x3e, 0xef, 0xe5, 0x00, 0xff, 0xca, 0xef,
+    0xf9, 0x80, 0x3f, 0xf1, 0x5d, 0xfe, 0x30, 0x0f, 0xe1, 0x00, 0x3e, 0x67, 0xe5, 0x00, 0xfc, 0x94,
+    0x00, 0x58, 0x8f, 0xcc, 0x01, 0xf6, 0x5b, 0x80, 0x08, 0xcf, 0xf8, 0x03, 0x84, 0x15, 0x34, 0x00,
+    0xf7, 0x7f, 0x94, 0x03, 0xac, 0x16, 0xc4, 0x03, 0xf0, 0x88, 0x99, 0xc0, 0x35, 0x3d, 0x00, 0x7f,
+    0x2f, 0x73, 0x4f, 0x80, 0x31, 0x40, 0x06, 0xaa, 0x00, 0x64, 0xcc, 0x6f, 0xa8, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x89, 0x00, 0x7f, 0xf2, 0x27, 0x44, 0x03, 0xe5, 0xbb, 0xf9, 0x80, 0x24, 0x31, 0x00,
+    0xf8, 0x91, 0x9b, 0x93, 0x80, 0x04, 0x68, 0x01, 0xfc, 0x3b, 0xbc, 0x40, 0x12, 0x87, 0x22, 0x78,
+    0x80, 0x30, 0xc1, 0x00, 0x75, 0x04, 0xdd, 0xf9, 0x00, 0x31, 0xbb, 0x00, 0x65, 0x27, 0xbb, 0xc2,
+    0x96, 0x80, 0x1f, 0xf4, 0x85, 0x22, 0x4a, 0x38, 0x84, 0x01, 0xfe, 0x63, 0x06, 0x00, 0x88, 0x0c,
+    0x03, 0xfe, 0x18, 0x20, 0x30, 0x09, 0x41, 0x80, 0x3f, 0xe2, 0x19, 0x3d, 0x00, 0xb0, 0x88, 0x01,
+    0xff, 0x1e, 0x22, 0x40, 0x13, 0xa0, 0x07, 0xff, 0x04, 0xc2, 0xc5, 0x41, 0x0b, 0x00, 0x3e, 0x10,
+    0x70, 0x0e, 0x32, 0xe0, 0xe1, 0x50, 0x0f, 0x9c, 0x04, 0x03, 0xd6, 0x8c, 0xac, 0x01, 0xf8, 0x80,
+    0xc0, 0x3c, 0xc5, 0x23, 0x20, 0x1c, 0xfc, 0x1a, 0x16, 0x1b, 0x00, 0x19, 0x41, 0x04, 0x03, 0xe4,
+    0x43, 0x25, 0x80, 0x72, 0x38, 0xab, 0x00, 0x78, 0x64, 0xa6, 0x92, 0x80, 0x24, 0xb2, 0xc3, 0x95,
+    0x00, 0xc3, 0xa5, 0xc0, 0x94, 0xb0, 0x0d, 0x65, 0xe5, 0xa7, 0x4e, 0x00, 0x3c, 0x3b, 0x30, 0x02,
+    0xd5, 0x26, 0x47, 0x84, 0x03, 0xa7, 0x12, 0x34, 0x76, 0x80, 0x19, 0x65, 0x97, 0x44, 0x02, 0x1d,
+    0x56, 0x99, 0x62, 0x00, 0x7b, 0xe6, 0x84, 0x03, 0x86, 0xa2, 0x40, 0x00, 0x00, 0xff, 0xe0, 0x9a,
+    0x00, 0x7f, 0x20, 0x07, 0x8c, 0x80, 0x11, 0x00, 0x0f, 0xcf, 0x68, 0x01, 0xdd, 0x20, 0x1f, 0xf9,
+    0x8a, 0x88, 0x02, 0x32, 0xd0, 0x0f, 0xfc, 0x3c, 0x1c, 0x20, 0x0b, 0x0e, 0x77, 0x30, 0xbb, 0xf1,
+    0x00, 0x47, 0x07, 0x00, 0x05, 0x07, 0x88, 0x11, 0x22, 0x39, 0xc0, 0x33, 0x3d, 0x03, 0x14, 0xf7,
+    0x48, 0x7d, 0xdc, 0xa0, 0x1d, 0x06, 0x16, 0x2c, 0x23, 0x00, 0x04, 0x78, 0x03, 0xfa, 0xa0, 0x03,
+    0xff, 0x82, 0xdd, 0xd5, 0x01, 0x19, 0x22, 0x67, 0x14, 0x4f, 0x09, 0x3b, 0x81, 0x82, 0xef, 0xe3,
+    0x2b, 0xbf, 0x12, 0x4c, 0x88, 0x01, 0x77, 0x94, 0x2e, 0xd2, 0x11, 0x77, 0x88, 0x03, 0xc4, 0x89,
+    0x18, 0xa2, 0x14, 0x0d, 0x13, 0x08, 0x07, 0xf8, 0xcc, 0x01, 0xf1, 0xc8, 0x80, 0x7f, 0x0a, 0x20,
+    0x03, 0xe7, 0x63, 0x00, 0xfe, 0x91, 0xa0, 0x0f, 0x84, 0x03, 0xfd, 0x0e, 0xe3, 0x00, 0x08, 0x60,
+    0x8b, 0x00, 0xc0, 0x02, 0x44, 0x11, 0x5b, 0xb4, 0x00, 0x44, 0x47, 0xee, 0x31, 0x88, 0x02, 0x84,
+    0x5a, 0x05, 0x32, 0x00, 0xec, 0xa9, 0x95, 0x68, 0x02, 0x52, 0x64, 0x79, 0x86, 0x00, 0xf0, 0xab,
+    0x31, 0x44, 0x19, 0xba, 0x8e, 0xbf, 0x31, 0x77, 0xfe, 0x55, 0x1c, 0x80, 0x17, 0xe5, 0x9d, 0xff,
+    0xf3, 0x1e, 0x80, 0x61, 0x69, 0xbb, 0x66, 0x7f, 0x8c, 0x00, 0x00, 0x0a, 0x00, 0x7f, 0xc8, 0x40,
+    0x1f, 0x3d, 0x08, 0x07, 0xfa, 0x68, 0x03, 0xec, 0x41, 0x00, 0x3c, 0x44, 0x42, 0x44, 0x00, 0x11,
+    0x40, 0x10, 0xae, 0x88, 0xd4, 0xac, 0xee, 0xdd, 0x89, 0xf7, 0x63, 0x00, 0x38, 0x47, 0x71, 0xb7,
+    0x52, 0x29, 0xbb, 0x13, 0xee, 0x00, 0x6a, 0x4b, 0xb9, 0x40, 0x66, 0x42, 0x22, 0x20, 0x00, 0x88,
+    0x01, 0x21, 0xc2, 0x24, 0x41, 0x06, 0xed, 0x99, 0x12, 0xe6, 0x87, 0xb7, 0xa1, 0x80, 0x62, 0x6b,
+    0x02, 0xbb, 0x85, 0xad, 0x01, 0x4b, 0x97, 0xba, 0xd0, 0x93, 0x60, 0x47, 0x78, 0xcc, 0xf2, 0x14,
+    0x8b, 0x48, 0x11, 0x01, 0x41, 0xcc, 0x12, 0xb3, 0x0c, 0xcc, 0xc0, 0x0c, 0x9a, 0x6c, 0xa0, 0xc8,
+    0xc6, 0x3f, 0x54, 0x15, 0xab, 0x30, 0x0f, 0xc3, 0x32, 0xe0, 0x1a, 0xcc, 0x13, 0x66, 0x46, 0x06,
+    0x9c, 0x68, 0x82, 0x60, 0x21, 0x22, 0xc0, 0x24, 0x50, 0x85, 0x5b, 0x0d, 0xd9, 0x64, 0x78, 0x83,
+    0x76, 0x26, 0xdd, 0xa0, 0x23, 0x5c, 0x77, 0x4c, 0x28, 0x85, 0x0e, 0xe8, 0x9f, 0xba, 0x80, 0x12,
+    0xf3, 0x22, 0x0a, 0x49, 0xe0, 0x08, 0xc0, 0x01, 0x1c, 0x01, 0xfb, 0x8c, 0x12, 0xb7, 0x62, 0x6d,
+    0xdc, 0x60, 0x1c, 0x24, 0x82, 0x43, 0xd1, 0x10, 0xa4, 0x46, 0x20, 0x0c, 0x5b, 0x4a, 0x25, 0x48,
+    0xab, 0x19, 0x2a, 0xe1, 0x00, 0x8f, 0x06, 0xe1, 0x25, 0x71, 0x00, 0x0b, 0xa0, 0x1f, 0x50, 0xbe,
+    0x49, 0x43, 0x50, 0xdf, 0xea, 0x4e, 0x66, 0x60, 0x05, 0x4c, 0x89, 0x60, 0xc1, 0x76, 0xe1, 0x57,
+    0xf0, 0x01, 0xd8, 0x0e, 0xdc, 0x03, 0x23, 0xc4, 0xcf, 0x8c, 0x00, 0x00, 0x19, 0xff, 0xf1, 0x80,
+    0x37, 0xe6, 0x7f, 0xf1, 0x3c, 0x03, 0x6f, 0x77, 0xc6, 0x9d, 0xdf, 0x68, 0x04, 0x68, 0x9f, 0x85,
+    0xd1, 0x3f, 0x10, 0x02, 0xab, 0xf8, 0x8e, 0xab, 0xf8, 0x02, 0x2f, 0xff, 0x8d, 0x3f, 0xfe, 0x10,
+    0x0f, 0x4d, 0xdd, 0x20, 0x1a, 0x6e, 0xe9, 0x00, 0xfd, 0xbf, 0xf5, 0x00, 0x6d, 0xff, 0xa8, 0x03,
+    0xaf, 0xc0, 0x8b, 0x30, 0x06, 0x12, 0x29, 0x83, 0x64, 0x00, 0x44, 0x01, 0xee, 0x8c, 0x18, 0x80,
+    0xbb, 0xa3, 0x03, 0x10, 0x00, 0x8c, 0xd3, 0x33, 0x8d, 0xc0, 0xb4, 0xcc, 0xe2, 0x30, 0x17, 0x77,
+    0xff, 0x20, 0x4a, 0xef, 0xf4, 0x83, 0xdd, 0xff, 0x08, 0x22, 0x7e, 0xe0, 0xa4, 0x4f, 0xe0, 0x09,
+    0x6a, 0xbc, 0xc3, 0x15, 0x5f, 0x28, 0x06, 0xd5, 0x33, 0x81, 0x51, 0xcc, 0x14, 0x0c, 0xc0, 0xa4,
+    0x01, 0xeb, 0x99, 0x70, 0x44, 0xcc, 0x13, 0x38, 0x03, 0xff, 0xe6, 0x44, 0x40, 0x10, 0x0f, 0xe7,
+    0x40, 0x08, 0x50, 0x67, 0x60, 0x50, 0x03, 0x55, 0x08, 0x00, 0x76, 0x40, 0x02, 0xb2, 0x9b, 0xcf,
+    0x20, 0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* U+0020 */,
+    {.bitmap_index = 0, .adv_w = 96, .box_w = 4, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0021 */,
+    {.bitmap_index = 30, .adv_w = 128, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 13} /* U+0022 */,
+    {.bitmap_index = 57, .adv_w = 272, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0023 */,
+    {.bitmap_index = 178, .adv_w = 224, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = -2} /* U+0024 */,
+    {.bitmap_index = 298, .adv_w = 320, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0025 */,
+    {.bitmap_index = 456, .adv_w = 272, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0026 */,
+    {.bitmap_index = 595, .adv_w = 80, .box_w = 3, .box_h = 8, .ofs_x = 1, .ofs_y = 13} /* U+0027 */,
+    {.bitmap_index = 608, .adv_w = 112, .box_w = 6, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+0028 */,
+    {.bitmap_index = 674, .adv_w = 112, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -2} /* U+0029 */,
+    {.bitmap_index = 738, .adv_w = 176, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 11} /* U+002A */,
+    {.bitmap_index = 769, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 3} /* U+002B */,
+    {.bitmap_index = 805, .adv_w = 96, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4} /* U+002C */,
+    {.bitmap_index = 820, .adv_w = 144, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 8} /* U+002D */,
+    {.bitmap_index = 828, .adv_w = 96, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0} /* U+002E */,
+    {.bitmap_index = 835, .adv_w = 144, .box_w = 9, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+002F */,
+    {.bitmap_index = 898, .adv_w = 240, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0030 */,
+    {.bitmap_index = 1003, .adv_w = 144, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0031 */,
+    {.bitmap_index = 1025, .adv_w = 208, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0032 */,
+    {.bitmap_index = 1110, .adv_w = 224, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0033 */,
+    {.bitmap_index = 1203, .adv_w = 224, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0034 */,
+    {.bitmap_index = 1279, .adv_w = 224, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0035 */,
+    {.bitmap_index = 1377, .adv_w = 224, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0036 */,
+    {.bitmap_index = 1481, .adv_w = 192, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0037 */,
+    {.bitmap_index = 1553, .adv_w = 240, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0038 */,
+    {.bitmap_index = 1670, .adv_w = 224, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0039 */,
+    {.bitmap_index = 1766, .adv_w = 96, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0} /* U+003A */,
+    {.bitmap_index = 1784, .adv_w = 96, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = -4} /* U+003B */,
+    {.bitmap_index = 1809, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 2} /* U+003C */,
+    {.bitmap_index = 1875, .adv_w = 224, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 5} /* U+003D */,
+    {.bitmap_index = 1898, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 2} /* U+003E */,
+    {.bitmap_index = 1964, .adv_w = 192, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+003F */,
+    {.bitmap_index = 2039, .adv_w = 320, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = -1} /* U+0040 */,
+    {.bitmap_index = 2207, .adv_w = 256, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0041 */,
+    {.bitmap_index = 2315, .adv_w = 256, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0042 */,
+    {.bitmap_index = 2411, .adv_w = 272, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0043 */,
+    {.bitmap_index = 2517, .adv_w = 288, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0044 */,
+    {.bitmap_index = 2611, .adv_w = 224, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0045 */,
+    {.bitmap_index = 2655, .adv_w = 224, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0046 */,
+    {.bitmap_index = 2690, .adv_w = 288, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0047 */,
+    {.bitmap_index = 2805, .adv_w = 272, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0048 */,
+    {.bitmap_index = 2848, .adv_w = 96, .box_w = 3, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0049 */,
+    {.bitmap_index = 2856, .adv_w = 176, .box_w = 10, .box_h = 20, .ofs_x = 0, .ofs_y = -1} /* U+004A */,
+    {.bitmap_index = 2896, .adv_w = 240, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+004B */,
+    {.bitmap_index = 2985, .adv_w = 208, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+004C */,
+    {.bitmap_index = 3008, .adv_w = 336, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+004D */,
+    {.bitmap_index = 3111, .adv_w = 288, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+004E */,
+    {.bitmap_index = 3195, .adv_w = 304, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+004F */,
+    {.bitmap_index = 3323, .adv_w = 240, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0050 */,
+    {.bitmap_index = 3392, .adv_w = 304, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = -2} /* U+0051 */,
+    {.bitmap_index = 3532, .adv_w = 240, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0052 */,
+    {.bitmap_index = 3618, .adv_w = 224, .box_w = 14, .box_h = 20, .ofs_x = 0, .ofs_y = -1} /* U+0053 */,
+    {.bitmap_index = 3732, .adv_w = 224, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0054 */,
+    {.bitmap_index = 3761, .adv_w = 272, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0055 */,
+    {.bitmap_index = 3821, .adv_w = 256, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0056 */,
+    {.bitmap_index = 3931, .adv_w = 368, .box_w = 23, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0057 */,
+    {.bitmap_index = 4111, .adv_w = 240, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0058 */,
+    {.bitmap_index = 4224, .adv_w = 240, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0059 */,
+    {.bitmap_index = 4303, .adv_w = 224, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+005A */,
+    {.bitmap_index = 4385, .adv_w = 128, .box_w = 6, .box_h = 23, .ofs_x = 2, .ofs_y = -2} /* U+005B */,
+    {.bitmap_index = 4411, .adv_w = 128, .box_w = 8, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+005C */,
+    {.bitmap_index = 4470, .adv_w = 128, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -2} /* U+005D */,
+    {.bitmap_index = 4497, .adv_w = 176, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 12} /* U+005E */,
+    {.bitmap_index = 4533, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = -4} /* U+005F */,
+    {.bitmap_index = 4542, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 14} /* U+0060 */,
+    {.bitmap_index = 4556, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = -1} /* U+0061 */,
+    {.bitmap_index = 4633, .adv_w = 224, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0062 */,
+    {.bitmap_index = 4719, .adv_w = 208, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -1} /* U+0063 */,
+    {.bitmap_index = 4786, .adv_w = 224, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+0064 */,
+    {.bitmap_index = 4872, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -1} /* U+0065 */,
+    {.bitmap_index = 4949, .adv_w = 128, .box_w = 8, .box_h = 19, .ofs_x = 0, .ofs_y = 0} /* U+0066 */,
+    {.bitmap_index = 4987, .adv_w = 224, .box_w = 12, .box_h = 21, .ofs_x = 1, .ofs_y = -7} /* U+0067 */,
+    {.bitmap_index = 5100, .adv_w = 224, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0068 */,
+    {.bitmap_index = 5145, .adv_w = 96, .box_w = 4, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+0069 */,
+    {.bitmap_index = 5163, .adv_w = 96, .box_w = 7, .box_h = 26, .ofs_x = -2, .ofs_y = -7} /* U+006A */,
+    {.bitmap_index = 5204, .adv_w = 192, .box_w = 11, .box_h = 19, .ofs_x = 1, .ofs_y = 0} /* U+006B */,
+    {.bitmap_index = 5264, .adv_w = 96, .box_w = 5, .box_h = 20, .ofs_x = 1, .ofs_y = -1} /* U+006C */,
+    {.bitmap_index = 5281, .adv_w = 336, .box_w = 19, .box_h = 14, .ofs_x = 1, .ofs_y = 0} /* U+006D */,
+    {.bitmap_index = 5346, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0} /* U+006E */,
+    {.bitmap_index = 5388, .adv_w = 224, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -1} /* U+006F */,
+    {.bitmap_index = 5465, .adv_w = 224, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -6} /* U+0070 */,
+    {.bitmap_index = 5557, .adv_w = 224, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -6} /* U+0071 */,
+    {.bitmap_index = 5641, .adv_w = 144, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0} /* U+0072 */,
+    {.bitmap_index = 5670, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -1} /* U+0073 */,
+    {.bitmap_index = 5747, .adv_w = 128, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = -1} /* U+0074 */,
+    {.bitmap_index = 5786, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -1} /* U+0075 */,
+    {.bitmap_index = 5832, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0} /* U+0076 */,
+    {.bitmap_index = 5898, .adv_w = 304, .box_w = 19, .box_h = 13, .ofs_x = 0, .ofs_y = 0} /* U+0077 */,
+    {.bitmap_index = 6009, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0} /* U+0078 */,
+    {.bitmap_index = 6078, .adv_w = 192, .box_w = 12, .box_h = 19, .ofs_x = 0, .ofs_y = -6} /* U+0079 */,
+    {.bitmap_index = 6166, .adv_w = 192, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -1} /* U+007A */,
+    {.bitmap_index = 6221, .adv_w = 128, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = -2} /* U+007B */,
+    {.bitmap_index = 6289, .adv_w = 80, .box_w = 3, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+007C */,
+    {.bitmap_index = 6298, .adv_w = 128, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = -2} /* U+007D */,
+    {.bitmap_index = 6364, .adv_w = 192, .box_w = 11, .box_h = 4, .ofs_x = 1, .ofs_y = 7} /* U+007E */,
+    {.bitmap_index = 6388, .adv_w = 384, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = -1} /* U+4E60 */,
+    {.bitmap_index = 6518, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+4FE1 */,
+    {.bitmap_index = 6662, .adv_w = 384, .box_w = 22, .box_h = 21, .ofs_x = 1, .ofs_y = -2} /* U+518D */,
+    {.bitmap_index = 6782, .adv_w = 384, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+529F */,
+    {.bitmap_index = 6947, .adv_w = 384, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = -2} /* U+53F7 */,
+    {.bitmap_index = 7067, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+5916 */,
+    {.bitmap_index = 7230, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+5931 */,
+    {.bitmap_index = 7392, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+5B66 */,
+    {.bitmap_index = 7550, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+6210 */,
+    {.bitmap_index = 7750, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+62E9 */,
+    {.bitmap_index = 7921, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+6309 */,
+    {.bitmap_index = 8115, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+63A5 */,
+    {.bitmap_index = 8318, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+6536 */,
+    {.bitmap_index = 8492, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+6B21 */,
+    {.bitmap_index = 8686, .adv_w = 384, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = -2} /* U+7684 */,
+    {.bitmap_index = 8847, .adv_w = 384, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = -1} /* U+7EA2 */,
+    {.bitmap_index = 8998, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+8BF7 */,
+    {.bitmap_index = 9167, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+8D25 */,
+    {.bitmap_index = 9356, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+9009 */,
+    {.bitmap_index = 9546, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = -2} /* U+952E */,
+    {.bitmap_index = 9771, .adv_w = 384, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = -2} /* U+9700 */
+};
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x181, 0x32d, 0x43f, 0x597, 0xab6, 0xad1, 0xd06,
+    0x13b0, 0x1489, 0x14a9, 0x1545, 0x16d6, 0x1cc1, 0x2824, 0x3042,
+    0x3d97, 0x3ec5, 0x41a9, 0x46ce, 0x48a0,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 20064, .range_length = 18593, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 21, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+static lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+};
+
+lv_font_t font_ui24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 28,
+    .base_line = 7,
+    .subpx = LV_FONT_SUBPX_NONE,
+#if LV_VERSION_CHECK(7, 4, 0)
+    .underline_position = -2,
+    .underline_thickness = 1,
+#endif
+    .dsc = &font_dsc,
+};
@@ -1,6 +1,12 @@
 #include <Arduino.h>
-#include <SPIFFS.h>
+#include <LittleFS.h>
 #include <esp_sleep.h>
+#include <sys/time.h>
+#include <time.h>
+#include <esp_partition.h>
+#include <esp_system.h>
+#include <esp_netif.h>
+#include <lwip/dhcp.h>
 #include <WiFi.h>
 #include <PubSubClient.h>
 
@@ -14,8 +20,24 @@
 #include <ArduinoJson.h>
 
 #include "KeyScanManager.h"
+#include "AssetDecoder.h"
+#include "AssetPack.h"
+#include "Backlight.h"
+#include "PowerManager.h"
 #include "ClockHelper.h"
-// #include "font_custom24.h"
+#include "ConfigImage.h"
+#include "ConfigJournal.h"
+#include "ConfigStore.h"
+#include "BootTimer.h"
+#include "CommandConsole.h"
+#include "CpuGovernor.h"
+#include "FrameMeter.h"
+#include "GlyphCache.h"
+#include "Crc32.h"
+#include "RemoteKeys.h"
+#include "Settings.h"
+#include "TaskMonitor.h"
+#include "UiCommandQueue.h"
 #include "img_learning.h"
 
 #define PIN_TFT_LED 16
@@ -23,17 +45,89 @@
 #define PIN_IR_TX 12
 #define PIN_SLEEP_TOUCH 14
 #define PWM_CHANNEL_TFT_LED 2
+#define PWM_FREQ_TFT_LED 1000 // uint: Hz
 
 #define LEARN_MIN_TIMES 3
 #define LEARN_MAX_TIMES 5
-#define AUTO_SLEEP_DELAY 300 // uint: second
+#define BACKLIGHT_LEVEL 800 // full brightness, the config levels are percents of it
+#define LIGHT_SLEEP_SLICE 1000 // uint: ms
+#define CPU_ACTIVITY_BOOST 1000 // uint: ms
+#define WIFI_FAST_TIMEOUT 3000 // uint: ms
+#define WIFI_JOIN_TIMEOUT 8000 // uint: ms, per network
+#define WIFI_SCAN_CHANNEL_TIME 120 // uint: ms, a beacon interval plus margin
+#define WIFI_RSSI_NONE -127    // uint: dBm, configured but not heard
+#define WIFI_JOIN_BONUS 2      // uint: dB per good join, up to 10 joins
+#define WIFI_FAIL_PENALTY 10   // uint: dB per failed join in a row, up to 5
+#define WIFI_SSID_LEN 33
+#define WIFI_PASSWD_LEN 65
+#define MQTT_KEEPALIVE 15          // uint: second
+#define MQTT_RECEIVER_KEEPALIVE 60 // uint: second
+#define MQTT_RETRY_DELAY 30000     // uint: ms
+#define MQTT_CONNECT_TRIES 3
+#define MQTT_CONNECT_DELAY 2000    // uint: ms, between two tries
+#define MQTT_BUFFER_SIZE 1024      // connect and perf events outgrow the 256 byte default
+#define MQTT_JOIN_LOG_ENTRY 96     // uint: byte, longest wifiJoins object, 32 byte SSID
+#define MQTT_CONNECT_EVENT_MAX (256 + (CONFIG_WIFI_MAX + 1) * MQTT_JOIN_LOG_ENTRY) // fast path plus every network
+#define COMPACT_IDLE_DELAY 5000 // uint: ms
+#define COMPACT_RETRY_DELAY 60000 // uint: ms, after a failed round unless a record came in
+#define COMPACT_RECORDS (CONFIG_JOURNAL_MAX / 2)
+#define RESUME_MAGIC 0x52534D31 // "RSM1"
+#define BOOT_CONFIG_STACK 8192
+#define TASK_KEY_LEN 16
+#define INPUT_TASK_STACK 4096
+#define UI_TASK_STACK 8192
+#define NET_TASK_STACK 8192
+#define RENDER_TASK_STACK 8192
+#define INPUT_TASK_PRIORITY 3 // above UI and network, key-to-IR latency stays flat
+#define UI_TASK_PRIORITY 2
+#define RENDER_TASK_PRIORITY 2
+#define NET_TASK_PRIORITY 1
+#define INPUT_TASK_CORE 1
+#define UI_TASK_CORE 0
+#define NET_TASK_CORE 0
+#define RENDER_TASK_CORE 0 // with UI and network, the input core is left to input
+#define UI_TASK_PERIOD 5   // uint: ms, longest idle wait between two scans
+#define RENDER_TASK_PERIOD 5 // uint: ms, between two looks for something to draw
+#define RENDER_IDLE_PERIOD 500 // uint: ms, LVGL still runs this often with nothing to draw
+#define PERF_OVERLAY_PERIOD 500 // uint: ms
+#define ANIM_FRAME_PERIOD 25 // uint: ms, frame pace while something animates, 40 fps
+#define ANIM_FRAME_BUDGET 15000 // uint: us, a longer frame drops the next one
+#define CAROUSEL_CARD_GAP 140 // uint: px, between two card centres
+#define CAROUSEL_SLIDE_TIME 240 // uint: ms
+#define CLOCK_SECONDS 0 // 1: the standby clock shows seconds, a one digit redraw each second
+#define CLOCK_DIGITS (CLOCK_SECONDS ? 6 : 4)
+#define CLOCK_DIGIT_WIDTH 11 // uint: px, a fixed slot per digit, a change only redraws its slot
+#define GLYPH_CACHE_BUDGET 8192 // uint: byte, decoded glyphs of compressed fonts in internal RAM
+#define ASSET_CACHE_BUDGET 32768 // uint: byte, inflated images of the asset pack
+#define ASSET_COPY_LEN 4096
+#define CONSOLE_READ_LEN 64
+#define NET_TASK_PERIOD 10 // uint: ms
+#define UI_QUEUE_LEN 16
+#define IR_QUEUE_LEN 8
+#define NET_QUEUE_LEN 8
+#define TASK_REPORT_PERIOD 60000 // uint: ms
+#define LVGL_BUF_LINES 10 // per buffer, one is drawn while the other is sent
+#define VIEW_FREE_LAZY 1   // screens built on demand are deleted again when left
+#define UI_LANG_ZH 1       // learning messages in Chinese, font_ui24 is subset to them at build time
 
 const char *configFile = "/config.json";
-// const char *MSG_KEY_LEARN = "请选择需学习的按键";
-// const char *MSG_IR_RECV = "接收红外信号";
-// const char *MSG_IR_RECV_REPEAT = "再次接收红外信号";
-// const char *MSG_LEARN_SUCCESS = "学习成功";
-// const char *MSG_LEARN_FAIL = "学习失败";
+const char *configImageFile = "/config.img";
+const char *configImagePartitionName = "cfgimg";
+const char *assetPackFile = "/assets.pak";
+const char *assetPartitionName = "assets";
+#if UI_LANG_ZH
+const char *MSG_KEY_LEARN = "请选择需学习的按键";
+const char *MSG_IR_RECV = "接收红外信号";
+const char *MSG_IR_RECV_REPEAT = "再次接收红外信号";
+const char *MSG_LEARN_SUCCESS = "学习成功";
+const char *MSG_LEARN_FAIL = "学习失败";
+#else
+const char *MSG_KEY_LEARN = "Please press button to learn";
+const char *MSG_IR_RECV = "Please receive IR";
+const char *MSG_IR_RECV_REPEAT = "Please receive IR again";
+const char *MSG_LEARN_SUCCESS = "Learn success";
+const char *MSG_LEARN_FAIL = "Learn fail";
+#endif
 
 typedef enum
 {
@@ -51,6 +145,87 @@ typedef enum
   WAIT_RECV
 } LearningStep;
 
+typedef enum
+{
+  COMPACT_IDLE = 0,
+  COMPACT_SCENES,
+  COMPACT_IMAGE_BEGIN,
+  COMPACT_IMAGE_SCENES
+} CompactStep;
+
+typedef enum
+{
+  UI_EVENT_KEY = 0,
+  UI_EVENT_IR_RECV,
+  UI_EVENT_NET
+} UiEventType;
+
+typedef enum
+{
+  NET_STATE_CONNECTED = 0,
+  NET_STATE_FAILED,
+  NET_STATE_NO_BROKER,
+  NET_STATE_LOST,
+  NET_STATE_SYNCED
+} NetState;
+
+typedef enum
+{
+  NET_CMD_CONNECT = 0,
+  NET_CMD_DISCONNECT,
+  NET_CMD_PUBLISH,
+  NET_CMD_SYNC
+} NetCommandType;
+
+// Input and network tasks to the UI task, which owns the running mode
+typedef struct
+{
+  UiEventType type;
+  KeyPressType press;
+  bool sent; // key already went out as IR from the input task
+  char key[TASK_KEY_LEN];
+  uint64_t value; // IR code or NetState
+} UiEvent;
+
+// Anyone to the input task, which alone drives the IR LED
+typedef struct
+{
+  KeyPressType press;
+  char key[TASK_KEY_LEN];
+} IrRequest;
+
+// UI to the network task, everything that may block on the network
+typedef struct
+{
+  NetCommandType type;
+  char key[TASK_KEY_LEN];
+} NetCommand;
+
+// Runtime state kept in RTC slow memory across deep sleep
+typedef struct
+{
+  uint32_t magic;
+  uint32_t imageStamp;
+  uint32_t imageCrc;           // image version
+  const uint8_t *imageData;    // compiled key table as mapped before sleep
+  uint8_t currentScene;
+  uint8_t currentRemoteClient;
+  bool clockSet;
+  bool journalEmpty;           // image alone has every learned code
+  int64_t clockOffset;         // wall clock minus RTC time, uint: ms
+  uint32_t crc;                // over everything above
+} ResumeSnapshot;
+
+// A configured network as heard by the last scan
+typedef struct
+{
+  uint8_t idx; // into the image wifi table
+  int32_t rssi;
+  int32_t channel; // 0 = not heard, join without a channel hint
+  uint8_t bssid[6];
+  int16_t score;
+} WifiCandidate;
+
 typedef struct
 {
   uint64_t delayTime;
@@ -62,37 +237,130 @@ typedef struct
   void (*callback)();
 } DelayParam;
 
+// One LVGL screen per running mode
+typedef struct
+{
+  const char *name;
+  lv_obj_t **screen;
+  void (*build)();
+  bool lazy;     // built on first use instead of at boot
+  uint32_t size; // LVGL heap taken by the screen, uint: byte
+} ViewEntry;
+
+// Standby carousel around one scene, cards left, centre, right
+typedef struct
+{
+  uint16_t scene;
+  uint16_t sceneSize;
+  char names[3][CONFIG_SCENE_NAME_LEN];
+  char icons[3][ASSET_SRC_LEN + 8]; // "" without a scene icon
+} CarouselContent;
+
 void lvglInit();
 void lvglDisplayFlush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+void lvglFlushEnd();
+void renderFrame();
+bool renderDue();
+bool animFrameDue();
+void perfOverlayView();
+void perfOverlayScan();
+void perfOverlaySet(bool on);
+void perfPublish();
+void consoleScan();
+void consoleRun(CCTask *task);
 void standbyView();
+void carouselShow(bool refill);
+void carouselScan();
+void carouselFill(const CarouselContent *content);
+void carouselPlace(int16_t offset);
+void carouselSlideExec(void *var, lv_anim_value_t value);
+void carouselSlideReady(lv_anim_t *anim);
+void clockScan();
 void learningView();
 void remoteView();
 void tipView();
 void settingView();
 void settingViewRefresh();
+void settingInfoRefresh();
+String settingInfoText();
+void viewShow(uint8_t view);
+void viewBuild(ViewEntry *entry);
+void viewFree(uint8_t view);
+void viewReport(Print &out);
+uint32_t lvglMemUsed();
 
 void runningModeChange(RunningMode mode);
-void refreshDisplay();
+void renderTask(void *param);
+void renderPanel(bool on);
+void backlightInit();
+void backlightApply();
 void btnPress(const char *key, KeyPressType type);
+bool standbyAction(const char *key, KeyPressType type);
+void inputTask(void *param);
+void uiTask(void *param);
+void netTask(void *param);
+void inputKeyPress(const char *key, KeyPressType type);
+void uiEvent(const UiEvent *event);
+void uiPost(const UiEvent *event);
+void uiPostNet(NetState state);
+void netPost(NetCommandType type, const char *key);
+void netCommand(const NetCommand *command);
+void netStateChange(NetState state);
 void configInit();
+void bootConfigTask(void *param);
+void settingsInit();
+void storageInit();
 void loadConfig();
-void storageConfig();
+void ensureConfigStore();
+void configPrefetchScan();
+void compactScan(bool force);
+void compactRun(bool force);
+void compactScene(uint8_t recordIdx);
+bool loadConfigImage();
+void storageConfigImage(uint32_t stamp);
+bool configImageAccept(ConfigImageBuilder *builder);
+bool loadConfigImageFile(uint32_t stamp);
+void installConfigImage(uint8_t *data, size_t size);
+uint32_t configFileStamp();
+void configImageReport(bool error, const char *path, const char *msg);
+bool loadAssetPack();
+void installAssetPackFile();
 void loadConfigRemote();
 void storageConfigRemote();
 void irSend(const char *key, KeyPressType type);
-void irScan();
+bool irKeyFind(const char *key, bool longPress, IrProtocol *protocol, uint64_t *value, uint8_t *bits, const char **text);
+void irSendRequest(const char *key, KeyPressType type);
+void irRecvScan();
+void learnRecv(uint64_t value);
 void setDelay(uint64_t delayTime);
 void delayScan();
+void powerInit();
+void cpuScan();
 void sleepScan();
+void powerStageChange(PowerStage stage);
+void lightSleep();
+void deepSleep();
+void powerReport();
+bool resumeSnapshotLoad();
+void wakeKeySend();
+void resumeSnapshotSave();
+uint64_t rtcMillis();
 void notifyActive();
 void sleepCallback();
-// void printTftString(const char *msg, uint8_t x, uint8_t y);
 
 void mqttCallback(char *topic, byte *payload, unsigned int length);
-void wifiConnect();
-void mqttInit();
+bool wifiStart();
+bool wifiConnect();
+bool wifiLeaseValid(const WifiCache *cache);
+uint32_t wifiLeaseTime();
+bool wifiCredentials(uint8_t idx, char *ssid, char *passwd);
+bool wifiJoin(uint8_t idx, int32_t channel, const uint8_t *bssid, uint32_t timeout);
+bool wifiWait(const char *ssid, uint32_t beginTime, uint32_t timeout, bool fast);
+uint8_t wifiRank();
+bool mqttInit();
 void toggleMqtt();
 void mqttConnect();
+void mqttWatchScan();
 void syncRemoteTime();
 String getCurrentTime();
 
@@ -104,15 +372,15 @@ PubSubClient mqttClient(mqttWifiClient);
 
 TFT_eSPI tft = TFT_eSPI();
 static lv_disp_buf_t lvDispBuf;
-static lv_color_t lvColorBuf[LV_HOR_RES_MAX * 10];
+static DMA_ATTR lv_color_t lvColorBuf[2][LV_HOR_RES_MAX * LVGL_BUF_LINES];
+bool lvglDma = false;
+bool lvglFlushOpen = false; // SPI transaction held across the stripes of a frame
 
 KeyScanManager keyManager = KeyScanManager();
 uint8_t btnReadPins[] = {32, 33, 34, 35};
 uint8_t btnWritePins[] = {22, 25, 26, 27};
-const char *btnKeys[] = {"power", "mode", "sence", "quick",
-                         "A", "B", "C", "D",
-                         "menu", "up", "cancel", "right",
-                         "left", "ok", "down", "fn"};
+const char *btnKeys[] = REMOTE_KEY_NAMES;
+const uint8_t btnKeysLen = sizeof(btnKeys) / sizeof(*btnKeys);
 
 ClockHelper clockHelper = ClockHelper();
 
@@ -120,10 +388,29 @@ IRrecv irr(PIN_IR_RX);
 IRsend irs(PIN_IR_TX);
 decode_results irResult;
 
-StaticJsonDocument<4096> json;
+ConfigStore configStore;
+ConfigImage configImage;
+ConfigJournal configJournal;
+Settings settings;
+uint32_t fsMountTime = 0;
+const esp_partition_t *configImagePartition = NULL;
+spi_flash_mmap_handle_t configImageMmapHandle = 0;
+uint8_t *configImageRam = NULL;
+AssetPack assetPack;
+AssetDecoder assetDecoder;
+const esp_partition_t *assetPartition = NULL;
+spi_flash_mmap_handle_t assetMmapHandle = 0;
+String mqttServer = "";
+
+CompactStep compactStep = CompactStep::COMPACT_IDLE;
+uint8_t compactIdx = 0;
+uint8_t compactRecordNum = 0;
+bool compactFailed = false;
+uint32_t compactFailTime = 0; // uint: ms
+uint32_t compactBeginTime = 0; // uint: ms
+ConfigImageBuilder compactBuilder;
 
 RunningMode runningMode = RunningMode::LOADING;
-bool isDisplayChange = false;
 uint8_t currentScene = 0;
 uint8_t sceneSize = 0;
 uint8_t currentRemoteClient = 0;
@@ -136,131 +423,582 @@ uint64_t learningVals[LEARN_MAX_TIMES];
 uint8_t learningCnts[LEARN_MAX_TIMES];
 
 uint64_t lastActiveTime = 0;
+RTC_DATA_ATTR ResumeSnapshot resumeSnapshot;
+bool resumed = false;
+uint16_t backlightLevel = BACKLIGHT_LEVEL;
+uint8_t backlightLevels[CONFIG_BACKLIGHT_LEVELS]; // uint: percent, per running mode then dim
+uint16_t backlightFadeIn = CONFIG_BACKLIGHT_FADE_IN;   // uint: ms
+uint16_t backlightFadeOut = CONFIG_BACKLIGHT_FADE_OUT; // uint: ms
+Backlight backlight;
+volatile bool panelOn = true; // set by the render task
+PowerManager powerManager;
+PowerStage powerStage = POWER_ACTIVE;
+PowerProfile powerProfile = POWER_PROFILE_REMOTE;
+CpuGovernor cpuGovernor;
+BootTimer bootTimer;
+TaskMonitor taskMonitor;
+UiCommandQueue uiCommands;
+FrameMeter frameMeter;
+GlyphCache glyphCache;
+uint32_t renderTime = 0; // last LVGL handler pass, uint: ms
+uint32_t flushPixels = 0; // sent during the current frame
+uint32_t flushTime = 0;   // spent in the flush callback this frame, uint: us
+volatile bool perfOverlay = false;
+volatile bool renderStatsReset = false; // set by the net task after a report, cleared by the render task
+uint32_t perfOverlayTime = 0; // uint: ms
+uint32_t animFrameTime = 0; // uint: ms
+bool animFrameDropped = false; // never two in a row, a slide always moves
+portMUX_TYPE carouselLock = portMUX_INITIALIZER_UNLOCKED;
+CarouselContent carouselContent; // set by the UI task under carouselLock
+uint32_t carouselVersion = 0;    // bumped with carouselContent
+bool carouselDirty = false;      // names or icons changed, refill without sliding
+CarouselContent carouselNext;    // render task copy, filled in when the slide ends
+uint32_t carouselTaken = 0;      // carouselVersion the render task copied last
+uint16_t carouselShown = 0;
+bool carouselSliding = false;
+int16_t carouselSlideEnd = 0; // uint: px
+char clockShown[CLOCK_DIGITS]; // digits last sent to the standby clock, 0 before the first
+CommandConsole console;
+uint8_t inputTaskId = 0;
+uint8_t uiTaskId = 0;
+uint8_t netTaskId = 0;
+uint8_t renderTaskId = 0;
+QueueHandle_t uiQueue = NULL;
+QueueHandle_t irQueue = NULL;
+QueueHandle_t netQueue = NULL;
+// lock order: storeLock, configLock, keyLock
+SemaphoreHandle_t storeLock = NULL;  // configStore, shared by compaction and the cloud sync
+SemaphoreHandle_t configLock = NULL; // configImage and configJournal, irSend reads them
+SemaphoreHandle_t keyLock = NULL;    // key matrix and IR, parked while sleeping
+SemaphoreHandle_t bootConfigDone = NULL;
+bool mqttWanted = false;
+uint32_t wifiJoinTime = 0; // uint: ms
+bool wifiJoinFast = false;
+String wifiJoinLog; // JSON objects of every join attempt, reported on connect
+uint32_t wifiStartTime = 0; // fast join started ahead of wifiConnect(), uint: ms
+char wifiStartSsid[WIFI_SSID_LEN];
+WifiCandidate wifiCandidates[CONFIG_WIFI_MAX];
+uint64_t mqttRetryTime = 0;
 String currentDeviceId = "";
 
 DelayParam delayParam;
 
 lv_obj_t *viewBgStandby;
+lv_obj_t *carousel = NULL;
+// previous, current and next scene
+lv_obj_t *carouselCards[3];
+lv_obj_t *carouselIcons[3];
+lv_obj_t *carouselLabels[3];
+lv_obj_t *clockBox;
+lv_obj_t *clockDigits[CLOCK_DIGITS]; // HHMM[SS]
 lv_obj_t *viewBgLearning;
 lv_obj_t *viewBgRemote;
 lv_obj_t *viewBgSetting;
 lv_obj_t *viewBgTip;
-lv_obj_t *labelSence;
 lv_obj_t *labelStateMqtt;
 lv_obj_t *labelRemoteClient;
 lv_obj_t *labelTip;
 lv_obj_t *labelTipLearning;
+LV_FONT_DECLARE(font_ui24);
 lv_obj_t *labelSettingInfo;
 lv_obj_t *labelSettingSync;
+lv_obj_t *labelSettingPerf;
+lv_obj_t *labelPerf;
 
-const char *menuSettingNames[] = {"Info", "Sync"};
+const char *menuSettingNames[] = {"Info", "Sync", "Perf"};
 const uint8_t menuSettingLen = sizeof(menuSettingNames) / sizeof(*menuSettingNames);
 lv_obj_t *menuSettings[menuSettingLen];
 uint8_t currentSettingMenu = 0;
 
+// indexed by RunningMode
+ViewEntry views[] = {
+    {"loading", NULL, NULL, false, 0},
+    {"standby", &viewBgStandby, standbyView, false, 0},
+    {"learning", &viewBgLearning, learningView, true, 0},
+    {"remote", &viewBgRemote, remoteView, false, 0},
+    {"tip", &viewBgTip, tipView, false, 0},
+    {"setting", &viewBgSetting, settingView, true, 0}};
+const uint8_t viewLen = sizeof(views) / sizeof(*views);
+uint8_t currentView = RunningMode::LOADING;
+lv_mem_monitor_t lvglMem; // as of the last view switch, taken in the render task
+
 void setup()
 {
   Serial.begin(115200);
-  delay(2000); // test
-  Serial.println("i-Remote init...");
-
-  Serial.println("IO init...");
+  storeLock = xSemaphoreCreateMutex();
+  configLock = xSemaphoreCreateMutex();
+  keyLock = xSemaphoreCreateMutex();
+  uint8_t phase = bootTimer.begin("resume");
+  resumed = resumeSnapshotLoad();
+  // no scan runs before the input task, the callback only fires there
+  keyManager.init(btnWritePins, btnReadPins, btnKeys, btnKeysLen, &inputKeyPress);
+  if (resumed && ESP_SLEEP_WAKEUP_ULP == esp_sleep_get_wakeup_cause())
+    wakeKeySend();
+  bootTimer.end(phase);
+  Serial.println(resumed ? "i-Remote resume..." : "i-Remote init...");
+  // full clock until STANDBY is reached
+  cpuGovernor.acquire(CPU_LOCK_MODE);
+  cpuGovernor.init();
+
+  phase = bootTimer.begin("settings");
   pinMode(PIN_TFT_LED, OUTPUT);
-  ledcSetup(PWM_CHANNEL_TFT_LED, 1000, 10);
+  ledcSetup(PWM_CHANNEL_TFT_LED, PWM_FREQ_TFT_LED, 10);
   ledcAttachPin(PIN_TFT_LED, PWM_CHANNEL_TFT_LED);
+  backlight.init(PWM_CHANNEL_TFT_LED, PWM_FREQ_TFT_LED);
+  settingsInit();
+  if (resumed)
+  {
+    currentScene = resumeSnapshot.currentScene;
+    currentRemoteClient = resumeSnapshot.currentRemoteClient;
+  }
+  bootTimer.end(phase);
 
-  Serial.println("TFT init...");
+  // filesystem and config on core 0, panel and views on this core meanwhile;
+  // nothing below touches the config until bootConfigDone is given
+  bootConfigDone = xSemaphoreCreateBinary();
+  xTaskCreatePinnedToCore(bootConfigTask, "boot-config", BOOT_CONFIG_STACK, NULL, 1, NULL, 0);
+
+  phase = bootTimer.begin("tft");
   tft.begin();
   tft.setRotation(2);
-  lvglInit();
-  standbyView();
-  learningView();
-  remoteView();
-  tipView();
-  settingView();
-
-  tft.fillScreen(TFT_BLACK);
-  delay(50);
-  ledcWrite(PWM_CHANNEL_TFT_LED, 800);
-  tft.setCursor(68, 100, 4);
-  tft.setTextColor(TFT_WHITE, TFT_BLACK);
-  tft.println("i-Remote");
-  // printTftString("i-Remote", 68, 108);
-  delay(10);
-
-  Serial.println("KeyManager init...");
-  keyManager.init(btnWritePins, btnReadPins, btnKeys, sizeof(btnKeys) / sizeof(*btnKeys), &btnPress);
+  lvglDma = tft.initDMA();
+  if (!resumed)
+  {
+    tft.fillScreen(TFT_BLACK);
+    backlight.set(backlightLevel, 0);
+    backlight.scan();
+    tft.setCursor(68, 100, 4);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.println("i-Remote");
+  }
+  bootTimer.end(phase);
 
-  loadConfig();
+  phase = bootTimer.begin("lvgl");
+  uiCommands.init(viewShow);
+  lvglInit();
+  glyphCache.init(GLYPH_CACHE_BUDGET);
+  glyphCache.attach(&font_ui24);
+  assetDecoder.init(&assetPack, ASSET_CACHE_BUDGET);
+  perfOverlayView();
+  // the rest is built when first shown
+  frameMeter.init();
+  for (uint8_t i = 0; i < viewLen; i++)
+  {
+    frameMeter.setName(i, views[i].name);
+    if (views[i].build != NULL && !views[i].lazy)
+      viewBuild(&views[i]);
+  }
+  bootTimer.end(phase);
 
+  phase = bootTimer.begin("ir");
   irr.enableIRIn();
   irs.begin();
+  bootTimer.end(phase);
 
-  delay(2000);
-  runningModeChange(RunningMode::STANDBY);
+  phase = bootTimer.begin("wait");
+  xSemaphoreTake(bootConfigDone, portMAX_DELAY);
+  vSemaphoreDelete(bootConfigDone);
+  bootConfigDone = NULL;
+  configInit();
+  bootTimer.end(phase);
 
+  phase = bootTimer.begin("frame");
+  runningModeChange(RunningMode::STANDBY);
+  // first frame before the backlight, no splash on resume
+  uiCommands.apply();
+  carouselScan();
+  renderFrame();
+  backlightApply();
+  backlight.scan();
+  bootTimer.end(phase);
+  bootTimer.ready();
+  bootTimer.print(Serial);
+  settingInfoRefresh();
+
+  powerManager.init(millis());
   notifyActive();
+  console.init(consoleRun);
+
+  // an unattended receiver goes online by itself
+  if (POWER_PROFILE_RECEIVER == powerProfile)
+    mqttWanted = true;
+
+  // input and IR alone on core 1, UI logic, the network and rendering on core 0
+  uiQueue = xQueueCreate(UI_QUEUE_LEN, sizeof(UiEvent));
+  irQueue = xQueueCreate(IR_QUEUE_LEN, sizeof(IrRequest));
+  netQueue = xQueueCreate(NET_QUEUE_LEN, sizeof(NetCommand));
+  inputTaskId = taskMonitor.add("input", INPUT_TASK_STACK, INPUT_TASK_CORE);
+  uiTaskId = taskMonitor.add("ui", UI_TASK_STACK, UI_TASK_CORE);
+  netTaskId = taskMonitor.add("net", NET_TASK_STACK, NET_TASK_CORE);
+  renderTaskId = taskMonitor.add("render", RENDER_TASK_STACK, RENDER_TASK_CORE);
+  TaskHandle_t handle = NULL;
+  xTaskCreatePinnedToCore(inputTask, "input", INPUT_TASK_STACK, NULL, INPUT_TASK_PRIORITY, &handle, INPUT_TASK_CORE);
+  taskMonitor.attach(inputTaskId, handle);
+  xTaskCreatePinnedToCore(uiTask, "ui", UI_TASK_STACK, NULL, UI_TASK_PRIORITY, &handle, UI_TASK_CORE);
+  taskMonitor.attach(uiTaskId, handle);
+  xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, NULL, NET_TASK_PRIORITY, &handle, NET_TASK_CORE);
+  taskMonitor.attach(netTaskId, handle);
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, NULL, RENDER_TASK_PRIORITY, &handle, RENDER_TASK_CORE);
+  taskMonitor.attach(renderTaskId, handle);
+}
+
+// Boot phases that only need flash: LittleFS, config image and journal, then
+// the WiFi association when the device goes online by itself
+void bootConfigTask(void *param)
+{
+  uint8_t phase = bootTimer.begin("storage");
+  storageInit();
+  bootTimer.end(phase);
+
+  phase = bootTimer.begin("config");
+  loadConfig();
+  bootTimer.end(phase);
+
+  phase = bootTimer.begin("assets");
+  loadAssetPack();
+  bootTimer.end(phase);
+
+  if (POWER_PROFILE_RECEIVER == configImage.getPowerProfile())
+  {
+    phase = bootTimer.begin("wifi");
+    wifiStart();
+    bootTimer.end(phase);
+  }
+  xSemaphoreGive(bootConfigDone);
+  vTaskDelete(NULL);
 }
 
 void loop()
 {
-  delayScan();
-  keyManager.scan();
-  irScan();
-  if (mqttClient.connected())
+  // all work runs in the tasks started by setup()
+  vTaskDelete(NULL);
+}
+
+void inputTask(void *param)
+{
+  IrRequest request;
+  while (true)
+  {
+    taskMonitor.begin(inputTaskId);
+    xSemaphoreTake(keyLock, portMAX_DELAY);
+    keyManager.scan();
+    irRecvScan();
+    while (xQueueReceive(irQueue, &request, 0))
+    {
+      irSend(request.key, request.press);
+    }
+    xSemaphoreGive(keyLock);
+    taskMonitor.end(inputTaskId);
+    vTaskDelay(1);
+  }
+}
+
+void uiTask(void *param)
+{
+  UiEvent event;
+  while (true)
   {
-    mqttClient.loop();
+    taskMonitor.begin(uiTaskId);
+    while (xQueueReceive(uiQueue, &event, 0))
+    {
+      uiEvent(&event);
+    }
+    consoleScan();
+    delayScan();
+    configPrefetchScan();
+    compactScan(false);
+    clockScan();
+    backlight.scan();
+    cpuScan();
+    sleepScan();
+    taskMonitor.end(uiTaskId);
+    // an event ends the wait early
+    xQueuePeek(uiQueue, &event, pdMS_TO_TICKS(UI_TASK_PERIOD));
   }
-  refreshDisplay();
+}
+
+// The only task that calls LVGL or talks to the panel
+void renderTask(void *param)
+{
+  while (true)
+  {
+    taskMonitor.begin(renderTaskId);
+    // the counters are written here, so they are cleared here too
+    if (renderStatsReset)
+    {
+      renderStatsReset = false;
+      frameMeter.reset();
+      glyphCache.reset();
+      assetDecoder.reset();
+    }
+    bool screenOn = powerStage < POWER_SCREEN_OFF;
+    // the panel only goes off once the backlight has faded out
+    if (screenOn != panelOn && (screenOn || 0 == backlight.getDuty()))
+      renderPanel(screenOn);
+    cpuGovernor.set(CPU_LOCK_ANIMATION, uiCommands.isPending() || lv_anim_count_running() > 0);
+    // objects follow while the panel is off, only the drawing waits
+    uiCommands.apply();
+    carouselScan();
+    if (panelOn)
+      perfOverlayScan();
+    if (panelOn && renderDue())
+    {
+      flushPixels = 0;
+      flushTime = 0;
+      frameMeter.begin();
+      renderFrame();
+      frameMeter.end(currentView, flushPixels, flushTime);
+    }
+    else if (panelOn)
+    {
+      frameMeter.skip(currentView);
+    }
+    taskMonitor.end(renderTaskId);
+    vTaskDelay(pdMS_TO_TICKS(RENDER_TASK_PERIOD));
+  }
+}
+
+void renderFrame()
+{
+  renderTime = millis();
   lv_task_handler();
-  sleepScan();
+  // the last stripe may still be on the bus
+  lvglFlushEnd();
 }
 
-void runningModeChange(RunningMode mode)
+// Only run LVGL for dirty areas, animations and its own slow timers
+bool renderDue()
 {
-  Serial.printf("Running mode change to [%d]\r\n", mode);
-  runningMode = mode;
-  isDisplayChange = true;
+  if (lv_anim_count_running() > 0)
+    return animFrameDue();
+  if (lv_disp_get_default()->inv_p > 0)
+    return true;
+  return millis() - renderTime >= RENDER_IDLE_PERIOD;
 }
 
-void refreshDisplay()
+// Animation frames at a steady pace. One is dropped after a frame over
+// budget or while IR sends or key events wait, so input never queues
+// behind a slide; animations are timed, a drop costs smoothness only.
+bool animFrameDue()
 {
-  if (isDisplayChange)
+  uint32_t now = millis();
+  if (now - animFrameTime < ANIM_FRAME_PERIOD)
+    return false;
+  animFrameTime = now;
+  bool inputWaiting = uxQueueMessagesWaiting(irQueue) > 0 || uxQueueMessagesWaiting(uiQueue) > 0;
+  if (!animFrameDropped && (inputWaiting || frameMeter.getLastTime() > ANIM_FRAME_BUDGET))
   {
-    lv_obj_set_hidden(viewBgStandby, true);
-    lv_obj_set_hidden(viewBgLearning, true);
-    lv_obj_set_hidden(viewBgRemote, true);
-    lv_obj_set_hidden(viewBgTip, true);
-    lv_obj_set_hidden(viewBgSetting, true);
+    animFrameDropped = true;
+    frameMeter.drop(currentView);
+    return false;
+  }
+  animFrameDropped = false;
+  return true;
+}
 
-    if (RunningMode::STANDBY == runningMode)
-    {
-      // tft.fillScreen(TFT_BLACK);
-      // tft.setCursor(50, 80, 4);
-      // tft.setTextColor(TFT_WHITE, TFT_BLACK);
-      // // tft.println("i-Remote");
-      // printTftString("i-Remote", 68, 108);
+void renderPanel(bool on)
+{
+  if (on)
+  {
+    tft.writecommand(TFT_SLPOUT);
+    delay(5);
+    tft.writecommand(TFT_DISPON);
+    lv_obj_invalidate(lv_scr_act());
+    // a full frame before the light comes back
+    renderFrame();
+    panelOn = true;
+    backlightApply();
+  }
+  else
+  {
+    panelOn = false;
+    tft.writecommand(TFT_DISPOFF);
+    tft.writecommand(TFT_SLPIN);
+  }
+}
 
-      lv_obj_set_hidden(viewBgStandby, false);
+void netTask(void *param)
+{
+  NetCommand command;
+  uint32_t reportTime = millis();
+  while (true)
+  {
+    taskMonitor.begin(netTaskId);
+    while (xQueueReceive(netQueue, &command, 0))
+    {
+      netCommand(&command);
     }
-    if (RunningMode::LEARNING == runningMode)
+    if (mqttClient.connected())
     {
-      lv_obj_set_hidden(viewBgLearning, false);
+      mqttClient.loop();
     }
-    if (RunningMode::TIP == runningMode)
+    mqttWatchScan();
+    if (millis() - reportTime >= TASK_REPORT_PERIOD)
     {
-      lv_obj_set_hidden(viewBgTip, false);
+      reportTime = millis();
+      taskMonitor.print(Serial);
+      taskMonitor.reset();
+      uiCommands.print(Serial);
+      uiCommands.reset();
+      frameMeter.print(Serial);
+      glyphCache.print(Serial);
+      assetDecoder.print(Serial);
+      backlight.print(Serial);
+      if (mqttClient.connected())
+        perfPublish();
+      renderStatsReset = true;
+      backlight.reset();
     }
-    if (RunningMode::REMOTE == runningMode)
+    taskMonitor.end(netTaskId);
+    xQueuePeek(netQueue, &command, pdMS_TO_TICKS(NET_TASK_PERIOD));
+  }
+}
+
+// Key scan callback, runs in the input task
+void inputKeyPress(const char *key, KeyPressType type)
+{
+  UiEvent event;
+  memset(&event, 0, sizeof(event));
+  event.type = UI_EVENT_KEY;
+  event.press = type;
+  strlcpy(event.key, key, sizeof(event.key));
+  // plain IR keys go out right here, the UI only hears about them
+  if (RunningMode::STANDBY == runningMode && !standbyAction(key, type))
+  {
+    irSend(key, type);
+    event.sent = true;
+  }
+  uiPost(&event);
+}
+
+void uiEvent(const UiEvent *event)
+{
+  if (UI_EVENT_KEY == event->type)
+  {
+    if (event->sent)
+    {
+      Serial.printf("key press: %s[%d], sent\r\n", event->key, event->press);
+      notifyActive();
+    }
+    else
     {
-      lv_obj_set_hidden(viewBgRemote, false);
+      btnPress(event->key, event->press);
     }
-    if (RunningMode::SETTING == runningMode)
+  }
+  else if (UI_EVENT_IR_RECV == event->type)
+  {
+    learnRecv(event->value);
+  }
+  else if (UI_EVENT_NET == event->type)
+  {
+    netStateChange((NetState)event->value);
+  }
+}
+
+// Queues are bounded, a full one drops the item and counts it
+void uiPost(const UiEvent *event)
+{
+  if (xQueueSend(uiQueue, event, 0) != pdTRUE)
+    taskMonitor.drop(uiTaskId);
+}
+
+void uiPostNet(NetState state)
+{
+  UiEvent event;
+  memset(&event, 0, sizeof(event));
+  event.type = UI_EVENT_NET;
+  event.value = state;
+  uiPost(&event);
+}
+
+void netPost(NetCommandType type, const char *key)
+{
+  NetCommand command;
+  memset(&command, 0, sizeof(command));
+  command.type = type;
+  if (key != NULL)
+    strlcpy(command.key, key, sizeof(command.key));
+  if (xQueueSend(netQueue, &command, 0) != pdTRUE)
+    taskMonitor.drop(netTaskId);
+}
+
+void netCommand(const NetCommand *command)
+{
+  if (NET_CMD_CONNECT == command->type)
+  {
+    mqttConnect();
+  }
+  else if (NET_CMD_DISCONNECT == command->type)
+  {
+    mqttWanted = false;
+    mqttClient.disconnect();
+    WiFi.disconnect(true, true);
+  }
+  else if (NET_CMD_PUBLISH == command->type)
+  {
+    xSemaphoreTake(configLock, portMAX_DELAY);
+    String targetDeviceId = configImage.getRemoteClientCode(currentRemoteClient);
+    xSemaphoreGive(configLock);
+    String msg = "{\"type\":\"ir-send\",\"time\":" + getCurrentTime() + ",\"deviceId\":\"" + targetDeviceId + "\",\"key\":\"" + String(command->key) + "\"}";
+    mqttClient.publish(mqttSubTopic, msg.c_str());
+  }
+  else if (NET_CMD_SYNC == command->type)
+  {
+    storageConfigRemote();
+  }
+}
+
+// Network results, runs in the UI task
+void netStateChange(NetState state)
+{
+  if (NET_STATE_CONNECTED == state)
+  {
+    uiCommands.setHidden(&labelStateMqtt, false);
+    if (RunningMode::TIP == runningMode)
+      runningModeChange(RunningMode::STANDBY);
+  }
+  else if (NET_STATE_FAILED == state)
+  {
+    uiCommands.setHidden(&labelStateMqtt, true);
+    if (RunningMode::TIP == runningMode)
+    {
+      uiCommands.setText(&labelTip, "No WiFi in range");
+      delayParam.runningMode = RunningMode::STANDBY;
+      delayParam.runningModeChange = true;
+      setDelay(2000);
+    }
+  }
+  else if (NET_STATE_NO_BROKER == state)
+  {
+    uiCommands.setHidden(&labelStateMqtt, true);
+    if (RunningMode::TIP == runningMode)
     {
-      lv_obj_set_hidden(viewBgSetting, false);
+      uiCommands.setText(&labelTip, "MQTT server not reachable");
+      delayParam.runningMode = RunningMode::STANDBY;
+      delayParam.runningModeChange = true;
+      setDelay(2000);
     }
   }
-  isDisplayChange = false;
+  else if (NET_STATE_LOST == state)
+  {
+    uiCommands.setHidden(&labelStateMqtt, true);
+  }
+  else if (NET_STATE_SYNCED == state)
+  {
+    runningModeChange(RunningMode::SETTING);
+  }
+}
+
+void runningModeChange(RunningMode mode)
+{
+  Serial.printf("Running mode change to [%d]\r\n", mode);
+  runningMode = mode;
+  uiCommands.showView(mode);
+  // only idle STANDBY may run at the low clock, learning decode and menus stay fast
+  cpuGovernor.set(CPU_LOCK_MODE, RunningMode::STANDBY != mode);
+  // a dark panel is lit by the render task after its first frame
+  if (panelOn)
+    backlightApply();
 }
 
 void btnPress(const char *key, KeyPressType type)
@@ -284,10 +1022,19 @@ void btnPress(const char *key, KeyPressType type)
     if (!strcmp(key, "sence") && KeyPressType::PRESS_SHORT == type)
     {
       currentScene = (currentScene + 1) % sceneSize;
+      settings.setScene(currentScene);
       Serial.printf("change to scene[%d]\r\n", currentScene);
-      String sceneName = json["scenes"][currentScene]["name"];
-      lv_label_set_text(labelSence, sceneName.c_str());
-      isDisplayChange = true;
+      carouselShow(false);
+      // the store is only a cache here, skip it while the cloud sync holds it
+      if (xSemaphoreTake(storeLock, 0))
+      {
+        if (configStore.isLoaded())
+        {
+          configStore.getScene(currentScene);
+          configStore.setPrefetch((currentScene + 1) % sceneSize);
+        }
+        xSemaphoreGive(storeLock);
+      }
       return;
     }
     if (!strcmp(key, "sence") && KeyPressType::PRESS_LONG == type)
@@ -306,11 +1053,11 @@ void btnPress(const char *key, KeyPressType type)
       // tft.setTextColor(TFT_WHITE, TFT_BLACK);
       // tft.println("Please press key to learn");
       // learningView();
-      // printTftString(MSG_KEY_LEARN, 12, 128);
-      lv_label_set_text(labelTipLearning, "Please press button to learn");
+      uiCommands.setText(&labelTipLearning, MSG_KEY_LEARN);
       return;
     }
-    irSend(key, type);
+    // sent by the input task unless the mode changed in between
+    irSendRequest(key, type);
     return;
   }
 
@@ -331,11 +1078,9 @@ void btnPress(const char *key, KeyPressType type)
     // tft.setTextColor(TFT_WHITE, TFT_BLACK);
     // tft.println("Please receive IR");
     // learningView();
-    // printTftString(MSG_IR_RECV, 48, 128);
     // String keyMsg = "[ " + learningKey + " ]";
-    // printTftString(keyMsg.c_str(), 72, 168);
-    String msg = "Please receive IR for [" + learningKey + "]";
-    lv_label_set_text(labelTipLearning, msg.c_str());
+    String msg = (String)MSG_IR_RECV + "\r\n[ " + learningKey + " ]";
+    uiCommands.setText(&labelTipLearning, msg.c_str());
     delayParam.learningStep = LearningStep::WAIT_RECV;
     delayParam.learningStepChange = true;
     setDelay(1000);
@@ -352,14 +1097,12 @@ void btnPress(const char *key, KeyPressType type)
     if (!strcmp(key, "sence") && KeyPressType::PRESS_SHORT == type)
     {
       currentRemoteClient = (currentRemoteClient + 1) % remoteClientSize;
-      String remoteClientName = json["remote-clients"][currentRemoteClient]["name"];
-      remoteClientName = String("Target: ") + remoteClientName;
-      lv_label_set_text(labelRemoteClient, remoteClientName.c_str());
+      settings.setRemoteClient(currentRemoteClient);
+      String remoteClientName = String("Target: ") + configImage.getRemoteClientName(currentRemoteClient);
+      uiCommands.setText(&labelRemoteClient, remoteClientName.c_str());
       return;
     }
-    String targetDeviceId = json["remote-clients"][currentRemoteClient]["code"];
-    String msg = "{\"type\":\"ir-send\",\"time\":" + getCurrentTime() + ",\"deviceId\":\"" + targetDeviceId + "\",\"key\":\"" + String(key) + "\"}";
-    mqttClient.publish(mqttSubTopic, msg.c_str());
+    netPost(NET_CMD_PUBLISH, key);
     return;
   }
   if (RunningMode::SETTING == runningMode)
@@ -389,63 +1132,514 @@ void btnPress(const char *key, KeyPressType type)
     {
       if (1 == currentSettingMenu && WiFi.isConnected())
       {
-        lv_label_set_text(labelTip, "Saving...");
+        uiCommands.setText(&labelTip, "Saving...");
         runningModeChange(RunningMode::TIP);
-        delayParam.callback = storageConfigRemote;
-        setDelay(500);
+        netPost(NET_CMD_SYNC, NULL);
+      }
+      if (2 == currentSettingMenu)
+      {
+        perfOverlaySet(!perfOverlay);
       }
       return;
     }
   }
 }
 
+// Keys btnPress() handles itself in STANDBY, every other key sends IR
+bool standbyAction(const char *key, KeyPressType type)
+{
+  if (!strcmp(key, "mode") || !strcmp(key, "sence"))
+    return true;
+  return !strcmp(key, "quick") && KeyPressType::PRESS_LONG == type;
+}
+
+void storageInit()
+{
+  // mounted once for the whole run, bulk data lives on LittleFS, small settings in NVS
+  uint32_t beginTime = micros();
+  if (!LittleFS.begin(true))
+    Serial.println("Failed to mount LittleFS");
+  fsMountTime = micros() - beginTime;
+  Serial.printf("LittleFS mount: %d us, %d / %d bytes used\r\n", fsMountTime, LittleFS.usedBytes(), LittleFS.totalBytes());
+  configStore.init(&LittleFS);
+  configJournal.init(&LittleFS);
+}
+
+void settingsInit()
+{
+  settings.begin();
+  currentScene = settings.getScene();
+  currentRemoteClient = settings.getRemoteClient();
+  backlightLevel = settings.getBacklight(BACKLIGHT_LEVEL);
+  settings.printStats(Serial);
+}
+
 void loadConfig()
 {
   Serial.println("load config...");
-  SPIFFS.begin();
-  File file = SPIFFS.open(configFile, FILE_READ);
-  DeserializationError error = deserializeJson(json, file);
-  if (error)
-    Serial.println("Failed to read file, using default configuration");
-  file.close();
-  SPIFFS.end();
-  configInit();
+  uint64_t beginTime = millis();
+  // deep sleep resume trusts the image, cold boot checks it still matches config.json
+  bool imageReady = (configImage.isValid() || loadConfigImage()) && resumed;
+  if (!imageReady)
+  {
+    uint32_t stamp = configFileStamp();
+    if (0 == stamp && configImage.isValid())
+    {
+      // filesystem reformatted (e.g. the SPIFFS to LittleFS move), keep serving the image
+      Serial.println("no config.json, keep the config image");
+    }
+    else if (!configImage.isValid() && 0 != stamp && configStore.getStamp() == stamp)
+    {
+      // no image partition: the image lives in RAM, rebuilt from the store
+      // that already holds this config.json, compacted codes and journal kept
+      Serial.println("config store up to date, build the config image");
+      storageConfigImage(stamp);
+    }
+    else if (!configImage.isValid() || configImage.getStamp() != stamp)
+    {
+      // new upload, split it into the paged store, learned codes belong to the old one
+      Serial.println("config image out of date, import config.json");
+      configJournal.clear();
+      configStore.importConfig(configFile, stamp);
+      if (!loadConfigImageFile(stamp))
+        storageConfigImage(stamp);
+    }
+  }
+  // learned codes not compacted yet overlay the image
+  uint8_t recordNum = configJournal.load();
+  if (recordNum > 0)
+    Serial.printf("journal: %d records\r\n", recordNum);
+  Serial.printf("load config: %d ms\r\n", (int)(millis() - beginTime));
+}
+
+void ensureConfigStore()
+{
+  // JSON is only needed for editing and cloud sync, the image serves everything else
+  if (configStore.isLoaded())
+    return;
+  if (!configStore.load())
+    configStore.importConfig(configFile, configFileStamp());
+}
+
+void configPrefetchScan()
+{
+  if (!configStore.isPrefetchPending())
+    return;
+  if (RunningMode::LEARNING == runningMode && LearningStep::WAIT_RECV == learningStep)
+    return;
+  if (!xSemaphoreTake(storeLock, 0))
+    return;
+  configStore.prefetch();
+  xSemaphoreGive(storeLock);
+}
+
+void compactScan(bool force)
+{
+  // the cloud sync may hold the store, try again next pass unless forced
+  TickType_t wait = force ? portMAX_DELAY : 0;
+  if (!xSemaphoreTake(storeLock, wait))
+    return;
+  if (xSemaphoreTake(configLock, wait))
+  {
+    compactRun(force);
+    xSemaphoreGive(configLock);
+  }
+  xSemaphoreGive(storeLock);
+}
+
+void compactRun(bool force)
+{
+  // fold the journal back into the scene files and the image, one step per loop
+  if (CompactStep::COMPACT_IDLE == compactStep)
+  {
+    uint8_t recordNum = configJournal.getRecordNum();
+    if (0 == recordNum || RunningMode::LEARNING == runningMode)
+      return;
+    if (!force && recordNum < COMPACT_RECORDS && millis() - lastActiveTime < COMPACT_IDLE_DELAY)
+      return;
+    // the same records failed before, wait for a new one or the retry delay
+    if (!force && compactFailed && recordNum == compactRecordNum && millis() - compactFailTime < COMPACT_RETRY_DELAY)
+      return;
+    Serial.printf("compact %d journal records...\r\n", recordNum);
+    compactStep = CompactStep::COMPACT_SCENES;
+    compactIdx = 0;
+    compactRecordNum = recordNum;
+    compactFailed = false;
+    compactBeginTime = millis();
+  }
+  else if (configJournal.getRecordNum() < compactRecordNum)
+  {
+    // journal cleared by a new import, nothing left to fold in
+    compactBuilder.end();
+    compactStep = CompactStep::COMPACT_IDLE;
+    return;
+  }
+
+  if (!configStore.isLoaded() && !configStore.load())
+  {
+    Serial.println("Failed to load config store");
+    compactFailed = true;
+    compactFailTime = millis();
+    compactStep = CompactStep::COMPACT_IDLE;
+    return;
+  }
+  if (CompactStep::COMPACT_SCENES == compactStep)
+  {
+    compactScene(compactIdx++);
+    if (compactIdx >= compactRecordNum)
+      compactStep = CompactStep::COMPACT_IMAGE_BEGIN;
+  }
+  else if (CompactStep::COMPACT_IMAGE_BEGIN == compactStep)
+  {
+    JsonObjectConst root = configStore.getRoot();
+    JsonArrayConst remoteClients = root["remote-clients"];
+    compactBuilder.setReport(configImageReport);
+    compactBuilder.begin(btnKeys, btnKeysLen, configStore.getSceneSize(), remoteClients.size());
+    compactBuilder.setRoot(root);
+    compactIdx = 0;
+    compactStep = CompactStep::COMPACT_IMAGE_SCENES;
+  }
+  else if (CompactStep::COMPACT_IMAGE_SCENES == compactStep)
+  {
+    if (compactIdx < configStore.getSceneSize())
+    {
+      compactBuilder.addScene(configStore.readScene(compactIdx++));
+      return;
+    }
+    size_t size = 0;
+    if (NULL == compactBuilder.finish(configImage.getStamp(), &size))
+    {
+      Serial.println("Failed to build config image");
+      compactBuilder.end();
+      compactFailed = true;
+    }
+    else if (!configImageAccept(&compactBuilder))
+    {
+      compactBuilder.end();
+      compactFailed = true;
+    }
+    else
+    {
+      installConfigImage(compactBuilder.release(), size);
+    }
+    // records learned meanwhile are kept for the next round
+    if (!compactFailed && configJournal.getRecordNum() == compactRecordNum)
+      configJournal.clear();
+    Serial.printf("compact journal: %s in %d ms\r\n", compactFailed ? "failed" : "done", (int)(millis() - compactBeginTime));
+    compactFailTime = millis();
+    compactStep = CompactStep::COMPACT_IDLE;
+  }
+}
+
+void compactScene(uint8_t recordIdx)
+{
+  const ConfigJournalRecord *record = configJournal.getRecord(recordIdx);
+  for (uint8_t i = 0; i < recordIdx; i++)
+  {
+    // scene already written together with an earlier record
+    if (!strcmp(configJournal.getRecord(i)->scene, record->scene))
+      return;
+  }
+  int16_t sceneIdx = configStore.findScene(record->scene);
+  if (sceneIdx < 0)
+    return;
+  JsonObject scene = configStore.getScene(sceneIdx);
+  bool success = !scene.isNull();
+  for (uint8_t i = recordIdx; i < compactRecordNum && success; i++)
+  {
+    const ConfigJournalRecord *change = configJournal.getRecord(i);
+    if (strcmp(change->scene, record->scene))
+      continue;
+    const char *mapName = change->longPress ? "key-map-long" : "key-map";
+    // scene document full, never store it truncated
+    success = scene[mapName][change->key].set(change->value);
+  }
+  if (!success || !configStore.storageScene(sceneIdx))
+  {
+    Serial.printf("Failed to compact scene [%s]\r\n", record->scene);
+    configStore.dropScene(sceneIdx);
+    compactFailed = true;
+  }
 }
 
 void configInit()
 {
-  String code = json["code"];
-  currentDeviceId = code;
-  JsonArray scenes = json["scenes"];
-  sceneSize = scenes.size();
+  currentDeviceId = configImage.getCode();
+  sceneSize = configImage.getSceneSize();
+  if (currentScene >= sceneSize)
+    currentScene = 0;
   Serial.printf("load config: %s\r\n", currentDeviceId.c_str());
   Serial.printf("scenes: %d\r\n", sceneSize);
-  String sceneName = json["scenes"][currentScene]["name"];
-  lv_label_set_text(labelSence, sceneName.c_str());
-  JsonArray remoteClients = json["remote-clients"];
-  remoteClientSize = remoteClients.size();
-  String remoteClientName = json["remote-clients"][currentRemoteClient]["name"];
-  remoteClientName = String("Target: ") + remoteClientName;
-  lv_label_set_text(labelRemoteClient, remoteClientName.c_str());
+  carouselShow(true);
+  remoteClientSize = configImage.getRemoteClientSize();
+  if (currentRemoteClient >= remoteClientSize)
+    currentRemoteClient = 0;
+  String remoteClientName = String("Target: ") + configImage.getRemoteClientName(currentRemoteClient);
+  uiCommands.setText(&labelRemoteClient, remoteClientName.c_str());
+  powerInit();
+  backlightInit();
+}
+
+void powerInit()
+{
+  powerProfile = configImage.getPowerProfile();
+  Serial.printf("power profile: %s\r\n", POWER_PROFILE_RECEIVER == powerProfile ? "receiver" : "remote");
+  const uint16_t powerDefaults[] = CONFIG_POWER_DEFAULTS;
+  for (uint8_t i = 0; i < CONFIG_POWER_STAGES; i++)
+  {
+    uint16_t timeout = configImage.isValid() ? configImage.getPowerTimeout(i) : powerDefaults[i];
+    PowerStage stage = (PowerStage)(POWER_ACTIVE + 1 + i);
+    // the sleep timeout set on the device wins over config.json
+    if (POWER_DEEP_SLEEP == stage)
+      timeout = settings.getSleepTimeout(timeout);
+    // a receiver must stay on MQTT, its ladder ends with the screen off
+    if (POWER_PROFILE_RECEIVER == powerProfile && stage >= POWER_LIGHT_SLEEP)
+      timeout = 0;
+    powerManager.setTimeout(stage, (uint32_t)timeout * 1000);
+    Serial.printf("power %s: %d s\r\n", PowerManager::getStageName(stage), timeout);
+  }
+}
+
+bool loadConfigImage()
+{
+  if (NULL == configImagePartition)
+  {
+    configImagePartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, configImagePartitionName);
+    if (NULL == configImagePartition)
+    {
+      Serial.println("No config image partition");
+      return false;
+    }
+  }
+  configImage.detach();
+  if (configImageMmapHandle)
+  {
+    spi_flash_munmap(configImageMmapHandle);
+    configImageMmapHandle = 0;
+  }
+  const void *data = NULL;
+  if (esp_partition_mmap(configImagePartition, 0, configImagePartition->size, SPI_FLASH_MMAP_DATA, &data, &configImageMmapHandle) != ESP_OK)
+  {
+    Serial.println("Failed to map config image");
+    configImageMmapHandle = 0;
+    return false;
+  }
+  // the image verified before sleep is still in place, skip the CRC pass
+  const ConfigImageHeader *header = (const ConfigImageHeader *)data;
+  bool verify = !resumed || data != resumeSnapshot.imageData ||
+                header->stamp != resumeSnapshot.imageStamp || header->crc != resumeSnapshot.imageCrc;
+  return configImage.attach((const uint8_t *)data, configImagePartition->size, verify);
+}
+
+void storageConfigImage(uint32_t stamp)
+{
+  Serial.println("storage config image...");
+  if (!configStore.isLoaded() && !configStore.load())
+  {
+    Serial.println("Failed to load config store");
+    return;
+  }
+  JsonObjectConst root = configStore.getRoot();
+  JsonArrayConst remoteClients = root["remote-clients"];
+  ConfigImageBuilder builder;
+  builder.setReport(configImageReport);
+  builder.begin(btnKeys, btnKeysLen, configStore.getSceneSize(), remoteClients.size());
+  builder.setRoot(root);
+  for (uint16_t i = 0; i < configStore.getSceneSize(); i++)
+  {
+    builder.addScene(configStore.readScene(i));
+  }
+  size_t size = 0;
+  if (NULL == builder.finish(stamp, &size))
+  {
+    Serial.println("Failed to build config image");
+    builder.end();
+    return;
+  }
+  if (!configImageAccept(&builder))
+  {
+    builder.end();
+    return;
+  }
+  installConfigImage(builder.release(), size);
+}
+
+// The builder drops what it reports as an error; such an image only
+// replaces no image at all, never the one in use
+bool configImageAccept(ConfigImageBuilder *builder)
+{
+  uint16_t errorNum = builder->getErrorNum();
+  if (0 == errorNum)
+    return true;
+  if (configImage.isValid())
+  {
+    Serial.printf("config has %d error(s), keep the config image in use\r\n", errorNum);
+    return false;
+  }
+  Serial.printf("config has %d error(s), no config image yet, use it without them\r\n", errorNum);
+  return true;
+}
+
+bool loadConfigImageFile(uint32_t stamp)
+{
+  // image pre-compiled by tools/config-compiler and shipped with the data upload
+  File file = LittleFS.open(configImageFile, FILE_READ);
+  if (!file)
+    return false;
+  size_t size = file.size();
+  uint8_t *data = (uint8_t *)malloc(size);
+  if (NULL == data || file.read(data, size) != size)
+  {
+    Serial.println("Failed to read config image file");
+    file.close();
+    free(data);
+    return false;
+  }
+  file.close();
+  ConfigImage fileImage;
+  if (!fileImage.attach(data, size) || fileImage.getStamp() != stamp)
+  {
+    Serial.println("config image file does not match config.json");
+    free(data);
+    return false;
+  }
+  Serial.println("install config image file...");
+  installConfigImage(data, size);
+  return true;
+}
+
+void installConfigImage(uint8_t *data, size_t size)
+{
+  if (configImagePartition != NULL && size <= configImagePartition->size)
+  {
+    configImage.detach();
+    if (configImageMmapHandle)
+    {
+      spi_flash_munmap(configImageMmapHandle);
+      configImageMmapHandle = 0;
+    }
+    size_t eraseSize = (size + SPI_FLASH_SEC_SIZE - 1) / SPI_FLASH_SEC_SIZE * SPI_FLASH_SEC_SIZE;
+    if (esp_partition_erase_range(configImagePartition, 0, eraseSize) == ESP_OK &&
+        esp_partition_write(configImagePartition, 0, data, size) == ESP_OK &&
+        loadConfigImage())
+    {
+      Serial.printf("config image: %d bytes\r\n", size);
+      free(data);
+      return;
+    }
+    Serial.println("Failed to write config image");
+  }
+
+  // no usable partition, keep the image in RAM
+  configImage.detach();
+  if (configImageRam != NULL)
+    free(configImageRam);
+  configImageRam = data;
+  configImage.attach(configImageRam, size);
+}
+
+uint32_t configFileStamp()
+{
+  File file = LittleFS.open(configFile, FILE_READ);
+  if (!file)
+    return 0;
+  uint8_t buf[256];
+  uint32_t crc = CRC32_INIT;
+  size_t len;
+  while ((len = file.read(buf, sizeof(buf))) > 0)
+  {
+    crc = crc32Update(crc, buf, len);
+  }
+  file.close();
+  return crc32Final(crc);
+}
+
+// Asset pack: a new /assets.pak from the data upload is moved into the
+// partition first, then the partition is mapped and used in place
+bool loadAssetPack()
+{
+  if (NULL == assetPartition)
+  {
+    assetPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, assetPartitionName);
+    if (NULL == assetPartition)
+    {
+      Serial.println("No asset partition");
+      return false;
+    }
+  }
+  assetPack.detach();
+  if (assetMmapHandle)
+  {
+    spi_flash_munmap(assetMmapHandle);
+    assetMmapHandle = 0;
+  }
+  installAssetPackFile();
+  const void *data = NULL;
+  if (esp_partition_mmap(assetPartition, 0, assetPartition->size, SPI_FLASH_MMAP_DATA, &data, &assetMmapHandle) != ESP_OK)
+  {
+    Serial.println("Failed to map asset pack");
+    assetMmapHandle = 0;
+    return false;
+  }
+  // checked when it was installed, a deep sleep resume skips the CRC pass
+  if (!assetPack.attach((const uint8_t *)data, assetPartition->size, !resumed))
+  {
+    Serial.println("No asset pack");
+    return false;
+  }
+  if (((assetPack.getFlags() & ASSET_PACK_FLAG_SWAP16) != 0) != (LV_COLOR_16_SWAP != 0))
+    Serial.println("asset pack built for the other LV_COLOR_16_SWAP, images are not shown");
+  Serial.printf("asset pack: %d entries, %d bytes\r\n", assetPack.getEntrySize(), assetPack.getSize());
+  return true;
 }
 
-void storageConfig()
+void installAssetPackFile()
 {
-  Serial.println("storage config...");
-  SPIFFS.begin();
-  SPIFFS.remove(configFile);
-  File file = SPIFFS.open(configFile, FILE_WRITE);
-  if (serializeJson(json, file) == 0)
+  File file = LittleFS.open(assetPackFile, FILE_READ);
+  if (!file)
+    return;
+  AssetPackHeader header;
+  AssetPackHeader installed;
+  size_t size = file.size();
+  if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || header.magic != ASSET_PACK_MAGIC ||
+      header.size != size || size > assetPartition->size)
   {
-    Serial.println("Failed to write config file");
+    Serial.println("asset pack file is invalid");
+    file.close();
+    return;
   }
+  if (esp_partition_read(assetPartition, 0, &installed, sizeof(installed)) == ESP_OK &&
+      installed.magic == header.magic && installed.stamp == header.stamp && installed.crc == header.crc)
+  {
+    file.close();
+    return;
+  }
+  Serial.printf("install asset pack: %d bytes\r\n", size);
+  uint8_t *buf = (uint8_t *)malloc(ASSET_COPY_LEN);
+  size_t eraseSize = (size + SPI_FLASH_SEC_SIZE - 1) / SPI_FLASH_SEC_SIZE * SPI_FLASH_SEC_SIZE;
+  bool success = buf != NULL && esp_partition_erase_range(assetPartition, 0, eraseSize) == ESP_OK;
+  file.seek(0);
+  size_t offset = 0;
+  while (success && offset < size)
+  {
+    size_t len = file.read(buf, ASSET_COPY_LEN);
+    success = len > 0 && esp_partition_write(assetPartition, offset, buf, len) == ESP_OK;
+    offset += len;
+  }
+  free(buf);
   file.close();
-  SPIFFS.end();
+  if (!success)
+    Serial.println("Failed to write asset pack");
+}
+
+void configImageReport(bool error, const char *path, const char *msg)
+{
+  Serial.printf("config %s: %s %s\r\n", error ? "error" : "warning", path, msg);
 }
 
 void loadConfigRemote()
 {
-  String deviceId = json["code"];
+  String deviceId = currentDeviceId;
   Serial.printf("load remote config [%s]...\r\n", deviceId.c_str());
   const char *host = "www.futurespeed.cn";
   uint16_t port = 80;
@@ -483,16 +1677,29 @@ void loadConfigRemote()
   Serial.print("HTTP receive json: ");
   Serial.println(jsonStr);
 
-  json.clear();
-  deserializeJson(json, jsonStr);
+  // the cloud copy becomes the new source, same path as a data upload
+  File file = LittleFS.open(configFile, FILE_WRITE);
+  file.print(jsonStr);
+  file.close();
+  uint32_t stamp = configFileStamp();
+  configJournal.clear();
+  configStore.importConfig(configFile, stamp);
+  storageConfigImage(stamp);
   configInit();
 }
 
 void storageConfigRemote()
 {
-  String deviceId = json["code"];
-  String sendJson;
-  serializeJson(json, sendJson);
+  // the cloud gets the scene files, fold learned codes in first
+  do
+  {
+    compactScan(true);
+  } while (CompactStep::COMPACT_IDLE != compactStep);
+  // scene files are streamed straight to the socket, keep compaction off them
+  xSemaphoreTake(storeLock, portMAX_DELAY);
+  ensureConfigStore();
+  String deviceId = currentDeviceId;
+  size_t sendJsonLen = configStore.measureConfig();
   Serial.printf("storage remote config [%s]...\r\n", deviceId.c_str());
   const char *host = "www.futurespeed.cn";
   uint16_t port = 80;
@@ -500,20 +1707,24 @@ void storageConfigRemote()
   if (!httpClient.connect(host, port))
   {
     Serial.println("connection failed");
+    xSemaphoreGive(storeLock);
+    uiPostNet(NET_STATE_SYNCED);
     return;
   }
   delay(10);
 
   String postRequest = (String)("PUT ") + url + " HTTP/1.1\r\n" +
                        "Content-Type: application/json;charset=utf-8\r\n" +
-                       "Content-Length: " + sendJson.length() + "\r\n"
+                       "Content-Length: " + sendJsonLen + "\r\n"
                                                                 "Host: " +
                        host + "\r\n" +
                        "User-Agent: i-Remote\r\n" +
                        "Connection: Keep Alive\r\n\r\n";
   Serial.print("HTTP send: ");
   Serial.println(postRequest);
-  httpClient.print(postRequest + sendJson);
+  httpClient.print(postRequest);
+  configStore.printConfig(httpClient);
+  xSemaphoreGive(storeLock);
 
   Serial.print("HTTP receive: ");
   String jsonStr;
@@ -537,124 +1748,186 @@ void storageConfigRemote()
   // delayParam.runningMode = RunningMode::SETTING;
   // delayParam.runningModeChange = true;
   // setDelay(2000);
-  runningModeChange(RunningMode::SETTING);
+  uiPostNet(NET_STATE_SYNCED);
 }
 
 void irSend(const char *key, KeyPressType type)
 {
-  String keyValue = json["scenes"][currentScene]["key-map"][String(key)];
-  String irType = json["scenes"][currentScene]["type"];
-  if (NULL == keyValue || 0 == keyValue.length() || String("null") == keyValue)
+  // codes are pre-parsed into the config image, no string work on the send path
+  IrProtocol protocol;
+  uint64_t value;
+  uint8_t bits;
+  const char *text;
+  bool longPress = KeyPressType::PRESS_LONG == type;
+  // compaction may remap the image, hold it only for the lookup
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  // a long press without a code of its own sends the short one
+  if (!irKeyFind(key, longPress, &protocol, &value, &bits, &text) &&
+      (!longPress || !irKeyFind(key, false, &protocol, &value, &bits, &text)))
+  {
+    xSemaphoreGive(configLock);
     return;
-  Serial.printf("send IR value: %s\r\n", keyValue.c_str());
-  char cmd[30];
-  strcpy((char *)&cmd, keyValue.c_str());
-  Serial.printf("IR send: [%s]\r\n", cmd);
-  uint64_t num = 0;
-  sscanf(cmd, "%llx", &num);
+  }
+  Serial.printf("IR send: [%s]%s\r\n", text, longPress ? " long" : "");
+  xSemaphoreGive(configLock);
 
-  if (irType == "sony")
+  cpuGovernor.acquire(CPU_LOCK_IR_SEND);
+  // the boost must have taken effect before the timing critical part
+  cpuGovernor.checkCritical("ir-send");
+  if (IR_PROTOCOL_SONY == protocol)
   {
-    irs.sendSony(0x4000 | num, num > 0xFFF ? 15 : 12);
+    irs.sendSony(value, bits);
   }
   else
   {
-    irs.sendNEC(num);
+    irs.sendNEC(value, bits);
   }
+  cpuGovernor.release(CPU_LOCK_IR_SEND);
 }
 
-void irScan()
+// Code for a key of the current scene, learned ones first; under configLock
+bool irKeyFind(const char *key, bool longPress, IrProtocol *protocol, uint64_t *value, uint8_t *bits, const char **text)
+{
+  const ConfigJournalRecord *record = configJournal.find(configImage.getSceneCode(currentScene), key, longPress);
+  if (record != NULL)
+  {
+    // learned but not compacted yet
+    *protocol = configImage.getSceneProtocol(currentScene);
+    *text = record->value;
+    return configImageResolveCode(*protocol, record->code, value, bits);
+  }
+  const ConfigImageKey *irKey = configImage.getKey(currentScene, key, longPress);
+  if (NULL == irKey)
+    return false;
+  *protocol = (IrProtocol)irKey->protocol;
+  *value = irKey->value;
+  *bits = irKey->bits;
+  *text = configImage.getString(irKey->text);
+  return true;
+}
+
+// Send from any task, the input task owns the IR LED
+void irSendRequest(const char *key, KeyPressType type)
+{
+  IrRequest request;
+  request.press = type;
+  strlcpy(request.key, key, sizeof(request.key));
+  if (xQueueSend(irQueue, &request, 0) != pdTRUE)
+    taskMonitor.drop(inputTaskId);
+}
+
+void irRecvScan()
 {
   if (RunningMode::LEARNING != runningMode || LearningStep::WAIT_RECV != learningStep)
     return;
-  if (irr.decode(&irResult))
-  {
-    Serial.print("IR recv: ");
-    String keyValue = uint64ToString(irResult.value, HEX);
-    Serial.print(keyValue);
-    Serial.println();
-    irr.resume();
-    notifyActive();
+  if (!irr.decode(&irResult))
+    return;
+  irr.resume();
+  UiEvent event;
+  memset(&event, 0, sizeof(event));
+  event.type = UI_EVENT_IR_RECV;
+  event.value = irResult.value;
+  uiPost(&event);
+}
 
-    bool found = false;
-    if (learningRecvCnt > 0)
-    {
-      for (int i = 0; i < learningRecvCnt; i++)
-      {
-        if (irResult.value == learningVals[i])
-        {
-          learningCnts[i]++;
-          found = true;
-          break;
-        }
-      }
-    }
-    if (!found)
-    {
-      learningVals[learningRecvCnt] = irResult.value;
-      learningCnts[learningRecvCnt] = 1;
-    }
-    bool learnSuccess = false;
+void learnRecv(uint64_t value)
+{
+  // the step may have changed while the code was queued
+  if (RunningMode::LEARNING != runningMode || LearningStep::WAIT_RECV != learningStep)
+    return;
+  Serial.print("IR recv: ");
+  String keyValue = uint64ToString(value, HEX);
+  Serial.print(keyValue);
+  Serial.println();
+  notifyActive();
+
+  bool found = false;
+  if (learningRecvCnt > 0)
+  {
     for (int i = 0; i < learningRecvCnt; i++)
     {
-      if (learningCnts[i] >= LEARN_MIN_TIMES)
+      if (value == learningVals[i])
       {
-        learnSuccess = true;
+        learningCnts[i]++;
+        found = true;
         break;
       }
     }
-
-    if (learnSuccess)
+  }
+  if (!found)
+  {
+    learningVals[learningRecvCnt] = value;
+    learningCnts[learningRecvCnt] = 1;
+  }
+  bool learnSuccess = false;
+  for (int i = 0; i < learningRecvCnt; i++)
+  {
+    if (learningCnts[i] >= LEARN_MIN_TIMES)
     {
-      json["scenes"][currentScene]["key-map"][learningKey] = keyValue;
-      // tft.fillScreen(TFT_BLACK);
-      // tft.setCursor(50, 80, 4);
-      // tft.setTextColor(TFT_WHITE, TFT_BLACK);
-      // tft.println("Learn success");
-      // printTftString(MSG_LEARN_SUCCESS, 72, 108);
-
-      storageConfig();
-      // delay(2000);
-      // runningModeChange(RunningMode::STANDBY);
-
-      String msg = (String) "Learn success\r\ncode: [" + keyValue + "]";
-      lv_label_set_text(labelTip, msg.c_str());
-      runningModeChange(RunningMode::TIP);
-      delayParam.runningMode = RunningMode::STANDBY;
-      delayParam.runningModeChange = true;
-      setDelay(3000);
-      return;
+      learnSuccess = true;
+      break;
     }
-    learningRecvCnt++;
+  }
 
-    if (learningRecvCnt >= LEARN_MAX_TIMES)
+  if (learnSuccess)
+  {
+    // a small journal append, the scene file and the image are compacted when idle
+    uint32_t beginTime = micros();
+    xSemaphoreTake(configLock, portMAX_DELAY);
+    bool stored = configJournal.append(configImage.getSceneCode(currentScene), learningKey.c_str(), keyValue.c_str(), false);
+    xSemaphoreGive(configLock);
+    Serial.printf("journal append: %d us\r\n", (int)(micros() - beginTime));
+    if (!stored)
     {
-      // tft.fillScreen(TFT_BLACK);
-      // tft.setCursor(50, 80, 4);
-      // tft.setTextColor(TFT_WHITE, TFT_BLACK);
-      // tft.println("Learn fail");
-      // printTftString(MSG_LEARN_FAIL, 72, 108);
-      // delay(2000);
-      // runningModeChange(RunningMode::STANDBY);
-      lv_label_set_text(labelTip, "Learn fail");
+      uiCommands.setText(&labelTip, ((String)MSG_LEARN_FAIL + "\r\ncode can not be saved").c_str());
       runningModeChange(RunningMode::TIP);
       delayParam.runningMode = RunningMode::STANDBY;
       delayParam.runningModeChange = true;
       setDelay(2000);
       return;
     }
+    // tft.fillScreen(TFT_BLACK);
+    // tft.setCursor(50, 80, 4);
+    // tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    // tft.println("Learn success");
+
+    // delay(2000);
+    // runningModeChange(RunningMode::STANDBY);
+
+    String msg = (String)MSG_LEARN_SUCCESS + "\r\ncode: [" + keyValue + "]";
+    uiCommands.setText(&labelTip, msg.c_str());
+    runningModeChange(RunningMode::TIP);
+    delayParam.runningMode = RunningMode::STANDBY;
+    delayParam.runningModeChange = true;
+    setDelay(3000);
+    return;
+  }
+  learningRecvCnt++;
 
+  if (learningRecvCnt >= LEARN_MAX_TIMES)
+  {
     // tft.fillScreen(TFT_BLACK);
     // tft.setCursor(50, 80, 4);
     // tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    // tft.printf("Please receive IR again (%d)\r\n", learningRecvCnt);
-    // learningView();
-    // printTftString(MSG_IR_RECV_REPEAT, 24, 128);
-    // String cntStr = "[ " + learningKey + ": " + String(learningRecvCnt) + " ]";
-    // printTftString(cntStr.c_str(), 88, 168);
-    String msg = "Please receive IR again (" + String(learningRecvCnt) + ")\r\n";
-    lv_label_set_text(labelTipLearning, msg.c_str());
+    // tft.println("Learn fail");
+    // delay(2000);
+    // runningModeChange(RunningMode::STANDBY);
+    uiCommands.setText(&labelTip, MSG_LEARN_FAIL);
+    runningModeChange(RunningMode::TIP);
+    delayParam.runningMode = RunningMode::STANDBY;
+    delayParam.runningModeChange = true;
+    setDelay(2000);
+    return;
   }
+
+  // tft.fillScreen(TFT_BLACK);
+  // tft.setCursor(50, 80, 4);
+  // tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  // tft.printf("Please receive IR again (%d)\r\n", learningRecvCnt);
+  // learningView();
+  // String cntStr = "[ " + learningKey + ": " + String(learningRecvCnt) + " ]";
+  String msg = (String)MSG_IR_RECV_REPEAT + "\r\n[ " + learningKey + ": " + String(learningRecvCnt) + " ]";
+  uiCommands.setText(&labelTipLearning, msg.c_str());
 }
 
 void setDelay(uint64_t delayTime)
@@ -679,47 +1952,211 @@ void delayScan()
       {
         learningStep = delayParam.learningStep;
       }
-      if (delayParam.callback != NULL)
-      {
-        delayParam.callback();
-      }
+      void (*callback)() = delayParam.callback;
 
       delayParam.delayTime = 0;
       delayParam.runningModeChange = false;
       delayParam.learningStepChange = false;
       delayParam.callback = NULL;
+      // cleared first, the callback may schedule the next delay
+      if (callback != NULL)
+      {
+        callback();
+      }
     }
   }
 }
 
-void sleepScan()
+void cpuScan()
+{
+  cpuGovernor.set(CPU_LOCK_ACTIVITY, millis() - lastActiveTime < CPU_ACTIVITY_BOOST);
+}
+
+void sleepScan()
+{
+  PowerStage stage = powerManager.update(millis());
+  if (stage != powerStage)
+    powerStageChange(stage);
+  if (POWER_LIGHT_SLEEP == powerStage)
+    lightSleep();
+  else if (POWER_DEEP_SLEEP == powerStage)
+    deepSleep();
+}
+
+void powerStageChange(PowerStage stage)
+{
+  Serial.printf("power: %s -> %s\r\n", PowerManager::getStageName(powerStage), PowerManager::getStageName(stage));
+  // the render task switches the panel and lights it again once a frame is drawn;
+  // a panel still fading out is lit again right away
+  bool waking = stage < POWER_SCREEN_OFF && !panelOn;
+  powerStage = stage;
+  if (!waking)
+    backlightApply();
+}
+
+// Brightness per running mode and for dim from the config image
+void backlightInit()
+{
+  for (uint8_t i = 0; i < CONFIG_BACKLIGHT_LEVELS; i++)
+  {
+    backlightLevels[i] = configImage.getBacklightLevel(i);
+  }
+  backlightFadeIn = configImage.getBacklightFadeIn();
+  backlightFadeOut = configImage.getBacklightFadeOut();
+}
+
+// Faded by the LEDC hardware, brighter with fade-in, darker with fade-out
+void backlightApply()
+{
+  uint8_t level = 0;
+  if (POWER_ACTIVE == powerStage)
+    level = backlightLevels[runningMode > RunningMode::STANDBY ? runningMode - RunningMode::STANDBY : 0];
+  else if (POWER_DIM == powerStage)
+    level = backlightLevels[CONFIG_BACKLIGHT_DIM];
+  uint16_t duty = (uint32_t)backlightLevel * level / 100;
+  backlight.set(duty, duty > backlight.getTarget() ? backlightFadeIn : backlightFadeOut);
+}
+
+void lightSleep()
+{
+  // a fade-out still pending would hold the panel on through the sleep,
+  // dark now and the render task turns the panel off before the first slice
+  if (panelOn)
+  {
+    backlight.off();
+    return;
+  }
+  // short slices, the tasks run in between so MQTT keepalive and the WiFi association survive
+  xSemaphoreTake(keyLock, portMAX_DELAY);
+  keyManager.prepareLightSleep();
+  esp_sleep_enable_timer_wakeup((uint64_t)LIGHT_SLEEP_SLICE * 1000);
+  esp_light_sleep_start();
+  keyManager.resume();
+  xSemaphoreGive(keyLock);
+  if (ESP_SLEEP_WAKEUP_GPIO == esp_sleep_get_wakeup_cause())
+    notifyActive();
+}
+
+void deepSleep()
 {
-  if ((millis() - lastActiveTime) / 1000 > AUTO_SLEEP_DELAY)
+  backlight.off();
+  powerReport();
+  // the wake key is sent from the image alone, fold learned codes in first
+  do
+  {
+    compactScan(true);
+  } while (CompactStep::COMPACT_IDLE != compactStep);
+
+  // the input task stays parked on the key matrix from here on
+  xSemaphoreTake(keyLock, portMAX_DELAY);
+  // light sleep sources must not wake the deep sleep
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+  // any key wakes, see KeyScanManager::prepareSleep()
+  if (!keyManager.prepareSleep())
   {
-    // EXT0 wakeup
-    esp_sleep_enable_ext0_wakeup(GPIO_NUM_32, LOW);
-    esp_sleep_enable_ext0_wakeup(GPIO_NUM_33, LOW);
-    esp_sleep_enable_ext0_wakeup(GPIO_NUM_34, LOW);
+    Serial.println("Failed to arm key wakeup, only EXT0 on GPIO35");
     esp_sleep_enable_ext0_wakeup(GPIO_NUM_35, LOW);
+  }
+
+  // // touch pin wakeup
+  // esp_sleep_enable_touchpad_wakeup();
+  // touchAttachInterrupt(PIN_SLEEP_TOUCH, sleepCallback, 40);
+
+  resumeSnapshotSave();
+  delay(10);
+  esp_deep_sleep_start();
+}
+
+void powerReport()
+{
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < POWER_STAGE_NUM; i++)
+  {
+    uint32_t time = powerManager.getStageTime((PowerStage)i, now);
+    Serial.printf("power %s: %d.%03d s\r\n", PowerManager::getStageName((PowerStage)i), time / 1000, time % 1000);
+  }
+  cpuGovernor.printStats(Serial);
+  taskMonitor.print(Serial);
+  uiCommands.print(Serial);
+  frameMeter.print(Serial);
+  glyphCache.print(Serial);
+  assetDecoder.print(Serial);
+  backlight.print(Serial);
+  viewReport(Serial);
+}
 
-    // // EXT1 wakeup
-    // // mask: pin39,38,37,36,35,34,33,32
-    // // use pin35 00001000
-    // uint64_t sleepPinMask = 0x08;
-    // esp_sleep_enable_ext1_wakeup(sleepPinMask, ESP_EXT1_WAKEUP_ALL_LOW);
+bool resumeSnapshotLoad()
+{
+  if (ESP_SLEEP_WAKEUP_UNDEFINED == esp_sleep_get_wakeup_cause())
+    return false;
+  // RTC memory holds garbage after power on, only a sealed snapshot counts
+  if (resumeSnapshot.magic != RESUME_MAGIC ||
+      crc32((const uint8_t *)&resumeSnapshot, offsetof(ResumeSnapshot, crc)) != resumeSnapshot.crc)
+    return false;
+  if (resumeSnapshot.clockSet)
+    clockHelper.setTime(rtcMillis() + resumeSnapshot.clockOffset);
+  return true;
+}
 
-    // // touch pin wakeup
-    // esp_sleep_enable_touchpad_wakeup();
-    // touchAttachInterrupt(PIN_SLEEP_TOUCH, sleepCallback, 40);
+void resumeSnapshotSave()
+{
+  memset(&resumeSnapshot, 0, sizeof(resumeSnapshot));
+  resumeSnapshot.magic = RESUME_MAGIC;
+  if (configImage.isValid())
+  {
+    const ConfigImageHeader *header = (const ConfigImageHeader *)configImage.getData();
+    resumeSnapshot.imageStamp = header->stamp;
+    resumeSnapshot.imageCrc = header->crc;
+    resumeSnapshot.imageData = configImage.getData();
+  }
+  resumeSnapshot.currentScene = currentScene;
+  resumeSnapshot.currentRemoteClient = currentRemoteClient;
+  resumeSnapshot.clockSet = clockHelper.isSet();
+  resumeSnapshot.journalEmpty = 0 == configJournal.getRecordNum();
+  resumeSnapshot.clockOffset = (int64_t)clockHelper.getTime() - (int64_t)rtcMillis();
+  resumeSnapshot.crc = crc32((const uint8_t *)&resumeSnapshot, offsetof(ResumeSnapshot, crc));
+}
 
-    delay(10);
-    esp_deep_sleep_start();
+void wakeKeySend()
+{
+  // the key that woke us goes out before display, storage or WiFi come up
+  uint8_t columns = keyManager.getWakeColumns();
+  int8_t keyIdx = keyManager.probe();
+  if (keyIdx < 0)
+  {
+    Serial.printf("wake key released before probe, columns: %02X\r\n", columns);
+    return;
   }
+  const char *key = keyManager.getKey(keyIdx);
+  // keys with a standby action of their own go through btnPress as usual
+  if (!strcmp(key, "mode") || !strcmp(key, "sence") || !resumeSnapshot.journalEmpty)
+    return;
+  currentScene = resumeSnapshot.currentScene;
+  if (!loadConfigImage())
+    return;
+  // sent on the press, before its length is known: a key with a long-press
+  // code waits for the scan to tell short from long
+  if (configImage.getKey(currentScene, key, true) != NULL)
+    return;
+  irs.begin();
+  irSend(key, KeyPressType::PRESS_SHORT);
+  keyManager.ignore(keyIdx);
+  Serial.printf("wake key [%s] sent: %d ms\r\n", key, (int)millis());
+}
+
+uint64_t rtcMillis()
+{
+  // system time keeps running on the RTC timer through deep sleep, millis() does not
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
 }
 
 void notifyActive()
 {
   lastActiveTime = millis();
+  cpuGovernor.acquire(CPU_LOCK_ACTIVITY);
+  powerManager.notifyActive(lastActiveTime);
 }
 
 void sleepCallback()
@@ -727,15 +2164,9 @@ void sleepCallback()
   Serial.println("Sleep wakeup...");
 }
 
-// void printTftString(const char *msg, uint8_t x, uint8_t y)
-// {
-//   tft.loadFont(font_custom24);
-//   tft.drawString(msg, x, y);
-//   tft.unloadFont();
-// }
-
 void mqttCallback(char *topic, byte *payload, unsigned int length)
 {
+  cpuGovernor.acquire(CPU_LOCK_NETWORK);
   Serial.print("MQTT receive: ");
   Serial.println(topic);
   String msgStr = "";
@@ -753,47 +2184,278 @@ void mqttCallback(char *topic, byte *payload, unsigned int length)
   {
     // Example: {"type":"ir-send","time":1653905097751,"deviceId":"jx","key":"fn"}
     uint64_t optTime = msgObj["time"];
-    clockHelper.refresh();
     uint64_t currTime = clockHelper.getTime();
     if (currTime - optTime > 3000)
+    {
+      cpuGovernor.release(CPU_LOCK_NETWORK);
       return;
+    }
     String deviceId = msgObj["deviceId"];
     if (deviceId == currentDeviceId)
     {
       String sendKey = msgJson["key"];
-      btnPress(sendKey.c_str(), KeyPressType::PRESS_SHORT);
+      // a receiver only lights up for local keys, remote commands go straight out
+      if (POWER_PROFILE_RECEIVER == powerProfile)
+      {
+        irSendRequest(sendKey.c_str(), KeyPressType::PRESS_SHORT);
+      }
+      else
+      {
+        UiEvent event;
+        memset(&event, 0, sizeof(event));
+        event.type = UI_EVENT_KEY;
+        event.press = KeyPressType::PRESS_SHORT;
+        strlcpy(event.key, sendKey.c_str(), sizeof(event.key));
+        uiPost(&event);
+      }
     }
   }
+  cpuGovernor.release(CPU_LOCK_NETWORK);
+}
+
+// Fast join on the cached AP and channel with the last lease, no scan, no
+// DHCP. Does not wait, wifiConnect() picks the pending join up.
+bool wifiStart()
+{
+  WifiCache cache;
+  char passwd[WIFI_PASSWD_LEN];
+  if (!settings.getWifiCache(&cache))
+    return false;
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  int8_t idx = configImage.findWifi(cache.ssid);
+  if (idx >= 0)
+    strlcpy(passwd, configImage.getWifiPasswd(idx), sizeof(passwd));
+  xSemaphoreGive(configLock);
+  if (idx < 0)
+    return false;
+  // an expired lease still saves the scan, only DHCP runs again
+  bool leased = wifiLeaseValid(&cache);
+  Serial.printf("Wifi fast connecting [%s]%s\r\n", cache.ssid, leased ? "" : ", lease expired");
+  if (leased)
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+  else
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  WiFi.begin(cache.ssid, passwd, cache.channel, cache.bssid);
+  wifiStartTime = millis();
+  strlcpy(wifiStartSsid, cache.ssid, sizeof(wifiStartSsid));
+  return true;
 }
 
-void wifiConnect()
+bool wifiConnect()
 {
-  String ssid = json["network-settings"]["wifi"]["ssid"];
-  String password = json["network-settings"]["wifi"]["passwd"];
-  Serial.print("Wifi connecting");
-  WiFi.begin(ssid.c_str(), password.c_str());
-  while (WiFi.status() != WL_CONNECTED)
+  // a join started during boot counts from there
+  uint32_t beginTime = wifiStartTime ? wifiStartTime : millis();
+  WifiCache cache;
+  wifiJoinFast = false;
+  wifiJoinLog = "";
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  uint8_t wifiSize = configImage.getWifiSize();
+  xSemaphoreGive(configLock);
+  if (0 == wifiSize)
   {
-    Serial.print(".");
-    delay(500);
+    Serial.println("Wifi not configured");
+    return false;
   }
-  Serial.println();
-  Serial.print("Wifi connected, IP: ");
+  if (wifiStartTime || wifiStart())
+  {
+    wifiJoinFast = wifiWait(wifiStartSsid, wifiStartTime, WIFI_FAST_TIMEOUT, true);
+    wifiStartTime = 0;
+    if (!wifiJoinFast)
+    {
+      Serial.println("Wifi fast connect fail, scan");
+      settings.clearWifiCache();
+    }
+  }
+  bool joined = wifiJoinFast;
+  // a static lease reused on the fast path keeps its age
+  bool leaseKept = joined && settings.getWifiCache(&cache) && wifiLeaseValid(&cache);
+  if (!joined)
+  {
+    // best first, every network gets a bounded try instead of waiting on one forever
+    uint8_t num = wifiRank();
+    for (uint8_t i = 0; i < num && !joined; i++)
+    {
+      WifiCandidate *candidate = &wifiCandidates[i];
+      joined = wifiJoin(candidate->idx, candidate->channel, candidate->channel ? candidate->bssid : NULL, WIFI_JOIN_TIMEOUT);
+    }
+  }
+  wifiJoinTime = millis() - beginTime;
+  if (!joined)
+  {
+    Serial.printf("Wifi no network joined (%d ms)\r\n", wifiJoinTime);
+    WiFi.disconnect(true);
+    return false;
+  }
+  Serial.printf("Wifi connected [%s] (%s, %d ms), IP: ", WiFi.SSID().c_str(), wifiJoinFast ? "fast" : "scan", wifiJoinTime);
   Serial.println(WiFi.localIP());
+
+  uint32_t leaseBegin = leaseKept ? cache.leaseBegin : rtcMillis() / 1000;
+  uint32_t leaseTime = leaseKept ? cache.leaseTime : wifiLeaseTime();
+  memset(&cache, 0, sizeof(cache));
+  cache.leaseBegin = leaseBegin;
+  cache.leaseTime = leaseTime;
+  strlcpy(cache.ssid, WiFi.SSID().c_str(), sizeof(cache.ssid));
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+  cache.ip = WiFi.localIP();
+  cache.gateway = WiFi.gatewayIP();
+  cache.subnet = WiFi.subnetMask();
+  cache.dns = WiFi.dnsIP();
+  settings.setWifiCache(&cache);
+  // radio wakes for every DTIM beacon only, commands land within one DTIM period
+  WiFi.setSleep(WIFI_PS_MIN_MODEM);
+  return true;
+}
+
+// The cached address is only reused for the first half of its lease, when
+// DHCP would renew it. RTC time restarts on power loss, the age is unknown then.
+bool wifiLeaseValid(const WifiCache *cache)
+{
+  esp_reset_reason_t reason = esp_reset_reason();
+  if (0 == cache->leaseTime || ESP_RST_POWERON == reason || ESP_RST_BROWNOUT == reason)
+    return false;
+  uint32_t now = rtcMillis() / 1000;
+  return now >= cache->leaseBegin && now - cache->leaseBegin < cache->leaseTime / 2;
+}
+
+// Lease the DHCP server gave the station, uint: s, 0 if unknown
+uint32_t wifiLeaseTime()
+{
+  esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+  struct netif *lwipNetif = NULL;
+  if (netif != NULL)
+    lwipNetif = (struct netif *)esp_netif_get_netif_impl(netif);
+  struct dhcp *dhcp = NULL;
+  if (lwipNetif != NULL)
+    dhcp = netif_dhcp_data(lwipNetif);
+  return NULL == dhcp ? 0 : dhcp->offered_t0_lease;
+}
+
+// Copied out under configLock, compaction may remap the image meanwhile
+bool wifiCredentials(uint8_t idx, char *ssid, char *passwd)
+{
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  bool found = idx < configImage.getWifiSize();
+  if (found)
+  {
+    strlcpy(ssid, configImage.getWifiSsid(idx), WIFI_SSID_LEN);
+    if (passwd != NULL)
+      strlcpy(passwd, configImage.getWifiPasswd(idx), WIFI_PASSWD_LEN);
+  }
+  xSemaphoreGive(configLock);
+  return found;
+}
+
+bool wifiJoin(uint8_t idx, int32_t channel, const uint8_t *bssid, uint32_t timeout)
+{
+  char ssid[WIFI_SSID_LEN];
+  char passwd[WIFI_PASSWD_LEN];
+  if (!wifiCredentials(idx, ssid, passwd))
+    return false;
+  uint32_t beginTime = millis();
+  Serial.printf("Wifi connecting [%s]\r\n", ssid);
+  // an address set for the fast path stays with the station, DHCP again
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  WiFi.begin(ssid, passwd, channel, bssid);
+  return wifiWait(ssid, beginTime, timeout, false);
+}
+
+bool wifiWait(const char *ssid, uint32_t beginTime, uint32_t timeout, bool fast)
+{
+  while (WiFi.status() != WL_CONNECTED && millis() - beginTime < timeout)
+  {
+    Serial.print(".");
+    delay(50);
+  }
+  uint32_t joinTime = millis() - beginTime;
+  bool joined = WL_CONNECTED == WiFi.status();
+  Serial.printf(" [%s] %s, %d ms\r\n", ssid, joined ? "joined" : "timeout", joinTime);
+  if (!joined)
+    WiFi.disconnect();
+  // a stale cache says nothing about the network itself
+  if (joined || !fast)
+    settings.recordWifiJoin(ssid, joined, joinTime);
+  wifiJoinLog += (String)(wifiJoinLog.length() ? "," : "") + "{\"ssid\":\"" + ssid + "\",\"fast\":" + (fast ? "true" : "false") +
+                 ",\"ms\":" + joinTime + ",\"joined\":" + (joined ? "true" : "false") + "}";
+  return joined;
+}
+
+// Passive scan, then order the configured networks by signal and join history
+uint8_t wifiRank()
+{
+  uint32_t beginTime = millis();
+  WiFi.mode(WIFI_STA);
+  int16_t found = WiFi.scanNetworks(false, false, true, WIFI_SCAN_CHANNEL_TIME);
+  char ssids[CONFIG_WIFI_MAX][WIFI_SSID_LEN];
+  uint8_t num = 0;
+  while (num < CONFIG_WIFI_MAX && wifiCredentials(num, ssids[num], NULL))
+  {
+    num++;
+  }
+  for (uint8_t i = 0; i < num; i++)
+  {
+    const char *ssid = ssids[i];
+    WifiCandidate *candidate = &wifiCandidates[i];
+    candidate->idx = i;
+    candidate->rssi = WIFI_RSSI_NONE;
+    candidate->channel = 0;
+    // one scan entry per AP, take the strongest one of this network
+    for (int16_t j = 0; j < found; j++)
+    {
+      if (WiFi.SSID(j) == ssid && WiFi.RSSI(j) > candidate->rssi)
+      {
+        candidate->rssi = WiFi.RSSI(j);
+        candidate->channel = WiFi.channel(j);
+        memcpy(candidate->bssid, WiFi.BSSID(j), sizeof(candidate->bssid));
+      }
+    }
+    candidate->score = candidate->rssi;
+    WifiHistory history;
+    if (settings.getWifiHistory(ssid, &history))
+      candidate->score += min((int)history.joins, 10) * WIFI_JOIN_BONUS - min((int)history.fails, 5) * WIFI_FAIL_PENALTY;
+  }
+  WiFi.scanDelete();
+  for (uint8_t i = 1; i < num; i++)
+  {
+    WifiCandidate candidate = wifiCandidates[i];
+    uint8_t j = i;
+    for (; j > 0 && wifiCandidates[j - 1].score < candidate.score; j--)
+    {
+      wifiCandidates[j] = wifiCandidates[j - 1];
+    }
+    wifiCandidates[j] = candidate;
+  }
+  Serial.printf("Wifi scan: %d APs in %d ms\r\n", max((int)found, 0), millis() - beginTime);
+  for (uint8_t i = 0; i < num; i++)
+  {
+    Serial.printf("  %d. [%s] rssi %d, score %d\r\n", i + 1, ssids[wifiCandidates[i].idx],
+                  wifiCandidates[i].rssi, wifiCandidates[i].score);
+  }
+  return num;
 }
 
-void mqttInit()
+// A few bounded tries, mqttWatchScan() retries later on failure
+bool mqttInit()
 {
-  String mqttServer = json["network-settings"]["mqtt"]["ip"];
-  String mqttPort = json["network-settings"]["mqtt"]["port"];
-  String mqttUser = json["network-settings"]["mqtt"]["username"];
-  String mqttPassword = json["network-settings"]["mqtt"]["passwd"];
+  // PubSubClient keeps the host pointer, hold a copy that outlives image remaps
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  mqttServer = configImage.getMqttIp();
+  uint16_t mqttPort = configImage.getMqttPort();
+  String mqttUser = configImage.getMqttUser();
+  String mqttPassword = configImage.getMqttPasswd();
+  xSemaphoreGive(configLock);
 
   Serial.println("MQTT connecting...");
-  mqttClient.setServer(mqttServer.c_str(), atoi(mqttPort.c_str()));
+  mqttClient.setServer(mqttServer.c_str(), mqttPort);
   mqttClient.setCallback(mqttCallback);
-  while (!mqttClient.connected())
+  static_assert(MQTT_BUFFER_SIZE >= MQTT_CONNECT_EVENT_MAX, "the connect event outgrows the MQTT buffer");
+  mqttClient.setBufferSize(MQTT_BUFFER_SIZE);
+  // fewer pings keep the modem asleep longer on an idle receiver
+  mqttClient.setKeepAlive(POWER_PROFILE_RECEIVER == powerProfile ? MQTT_RECEIVER_KEEPALIVE : MQTT_KEEPALIVE);
+  for (uint8_t i = 0; i < MQTT_CONNECT_TRIES && !mqttClient.connected(); i++)
   {
+    if (i > 0)
+      delay(MQTT_CONNECT_DELAY);
     if (mqttClient.connect(mqttUser.c_str(), mqttUser.c_str(), mqttPassword.c_str()))
     {
       Serial.println("MQTT connected.");
@@ -802,16 +2464,21 @@ void mqttInit()
     {
       Serial.print("MQTT connect fail.");
       Serial.println(mqttClient.state());
-      delay(2000);
     }
   }
+  if (!mqttClient.connected())
+    return false;
   Serial.println("MQTT subscribe...");
   mqttClient.subscribe(mqttSubTopic);
   Serial.println("MQTT publish...");
-  String deviceId = json["code"];
-  String pubMsg = "{\"type\":\"event\",\"time\":" + getCurrentTime() + ",\"deviceId\":\"" + deviceId + "\",\"event\":\"connect\"}";
-  mqttClient.publish(mqttPubTopic, pubMsg.c_str());
-  lv_obj_set_hidden(labelStateMqtt, false);
+  String deviceId = currentDeviceId;
+  String pubMsg = "{\"type\":\"event\",\"time\":" + getCurrentTime() + ",\"deviceId\":\"" + deviceId + "\",\"event\":\"connect\"" +
+                  ",\"wifiJoinMs\":" + wifiJoinTime + ",\"wifiJoinFast\":" + (wifiJoinFast ? "true" : "false") +
+                  ",\"wifiJoins\":[" + wifiJoinLog + "]}";
+  // PubSubClient drops a packet larger than its buffer without a word
+  if (!mqttClient.publish(mqttPubTopic, pubMsg.c_str()))
+    Serial.printf("MQTT connect event not sent, %d bytes\r\n", pubMsg.length());
+  return true;
 }
 
 void toggleMqtt()
@@ -822,31 +2489,57 @@ void toggleMqtt()
     // tft.fillScreen(TFT_BLACK);
     // tft.setCursor(50, 80, 4);
     // tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    // printTftString("Connecting...", 56, 108);
 
-    lv_label_set_text(labelTip, "Connecting...");
+    uiCommands.setText(&labelTip, "Connecting...");
     runningModeChange(RunningMode::TIP);
-    delayParam.callback = mqttConnect;
-    setDelay(500);
+    netPost(NET_CMD_CONNECT, NULL);
   }
   else
   {
-    mqttClient.disconnect();
-    WiFi.disconnect(true, true);
-    lv_obj_set_hidden(labelStateMqtt, true);
+    netPost(NET_CMD_DISCONNECT, NULL);
+    uiCommands.setHidden(&labelStateMqtt, true);
   }
   // isDisplayChange = true;
 }
 
 void mqttConnect()
 {
+  cpuGovernor.acquire(CPU_LOCK_NETWORK);
   if (WiFi.status() != WL_CONNECTED)
   {
-    wifiConnect();
+    if (!wifiConnect())
+    {
+      // mqttWatchScan tries again later if the link was wanted
+      cpuGovernor.release(CPU_LOCK_NETWORK);
+      uiPostNet(NET_STATE_FAILED);
+      return;
+    }
     syncRemoteTime();
   }
-  mqttInit();
-  runningModeChange(RunningMode::STANDBY);
+  // wanted either way, mqttWatchScan tries the broker again later
+  mqttWanted = true;
+  bool connected = mqttInit();
+  cpuGovernor.release(CPU_LOCK_NETWORK);
+  if (!connected)
+  {
+    mqttRetryTime = millis();
+    uiPostNet(NET_STATE_NO_BROKER);
+    return;
+  }
+  uiPostNet(NET_STATE_CONNECTED);
+}
+
+void mqttWatchScan()
+{
+  // reconnect a dropped link, without it a receiver would go deaf for good
+  if (!mqttWanted || mqttClient.connected() || RunningMode::STANDBY != runningMode)
+    return;
+  if (mqttRetryTime != 0 && millis() - mqttRetryTime < MQTT_RETRY_DELAY)
+    return;
+  mqttRetryTime = millis();
+  Serial.println("MQTT link lost, reconnect...");
+  uiPostNet(NET_STATE_LOST);
+  mqttConnect();
 }
 
 void syncRemoteTime()
@@ -891,18 +2584,17 @@ void syncRemoteTime()
   deserializeJson(httpResp, jsonStr);
   uint64_t currTime = httpResp["currTime"];
   clockHelper.setTime(currTime);
-  Serial.printf("current time: %04d-%02d-%02d %02d:%02d:%02d\r\n",
-                clockHelper.getYear(),
-                clockHelper.getMonth(),
-                clockHelper.getDay(),
-                clockHelper.getHour(),
-                clockHelper.getMinute(),
-                clockHelper.getSecond());
+  // not from the clock fields, a refresh() here would take the change
+  // mask clockScan() redraws by
+  time_t secs = currTime / 1000;
+  struct tm utc;
+  gmtime_r(&secs, &utc);
+  Serial.printf("current time: %04d-%02d-%02d %02d:%02d:%02d UTC\r\n",
+                utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday, utc.tm_hour, utc.tm_min, utc.tm_sec);
 }
 
 String getCurrentTime()
 {
-  clockHelper.refresh();
   char currTimeStr[20];
   sprintf(currTimeStr, "%lld", clockHelper.getTime());
   return String(currTimeStr);
@@ -911,20 +2603,55 @@ String getCurrentTime()
 /* Display flushing */
 void lvglDisplayFlush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
 {
+  uint32_t beginTime = micros();
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
-  tft.startWrite();
-  tft.setAddrWindow(area->x1, area->y1, w, h);
-  tft.pushColors(&color_p->full, w * h, true);
-  tft.endWrite();
+  if (!lvglFlushOpen)
+  {
+    tft.startWrite();
+    lvglFlushOpen = true;
+  }
+  if (lvglDma)
+  {
+    // waits for the previous stripe, i.e. the buffer LVGL draws into next,
+    // then queues this one and returns while it is being sent
+    tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t *)&color_p->full);
+  }
+  else
+  {
+    tft.setAddrWindow(area->x1, area->y1, w, h);
+    tft.pushPixels(&color_p->full, w * h);
+  }
+  flushPixels += w * h;
+  flushTime += micros() - beginTime;
   lv_disp_flush_ready(disp);
 }
 
+// End of a frame: wait for the last transfer and free the bus for commands
+void lvglFlushEnd()
+{
+  if (!lvglFlushOpen)
+    return;
+  uint32_t beginTime = micros();
+  if (lvglDma)
+    tft.dmaWait();
+  tft.endWrite();
+  lvglFlushOpen = false;
+  flushTime += micros() - beginTime;
+}
+
 void lvglInit()
 {
   Serial.println("LVGL init...");
   lv_init();
-  lv_disp_buf_init(&lvDispBuf, lvColorBuf, NULL, LV_HOR_RES_MAX * 10);
+  Serial.printf("LVGL flush: %s, %d lines x 2\r\n", lvglDma ? "DMA" : "blocking", LVGL_BUF_LINES);
+  // LV_COLOR_16_SWAP (platformio.ini) makes LVGL render in panel byte
+  // order, otherwise every pixel is swapped by the CPU on its way out
+#if !LV_COLOR_16_SWAP
+#warning "LV_COLOR_16_SWAP is 0, the flush swaps every pixel on the CPU"
+#endif
+  tft.setSwapBytes(!LV_COLOR_16_SWAP);
+  lv_disp_buf_init(&lvDispBuf, lvColorBuf[0], lvColorBuf[1], LV_HOR_RES_MAX * LVGL_BUF_LINES);
   lv_disp_drv_t disp_drv;
   lv_disp_drv_init(&disp_drv);
   disp_drv.hor_res = 240;
@@ -934,16 +2661,191 @@ void lvglInit()
   lv_disp_drv_register(&disp_drv);
 }
 
+// Frame numbers on the top layer, above every screen
+void perfOverlayView()
+{
+  labelPerf = lv_label_create(lv_layer_top(), NULL);
+  lv_obj_set_style_local_bg_color(labelPerf, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+  lv_obj_set_style_local_bg_opa(labelPerf, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+  lv_obj_set_style_local_text_color(labelPerf, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_LIME);
+  lv_label_set_text(labelPerf, "");
+  lv_obj_align(labelPerf, NULL, LV_ALIGN_IN_BOTTOM_LEFT, 4, -4);
+  lv_obj_set_auto_realign(labelPerf, true);
+  lv_obj_set_hidden(labelPerf, true);
+}
+
+// Render task, owns labelPerf directly
+void perfOverlayScan()
+{
+  if (lv_obj_get_hidden(labelPerf) == perfOverlay)
+  {
+    lv_obj_set_hidden(labelPerf, !perfOverlay);
+    perfOverlayTime = 0;
+  }
+  if (!perfOverlay || (perfOverlayTime != 0 && millis() - perfOverlayTime < PERF_OVERLAY_PERIOD))
+    return;
+  perfOverlayTime = millis();
+  lv_mem_monitor(&lvglMem);
+  uint32_t glyphLookups = glyphCache.getHits() + glyphCache.getMisses();
+  char text[160];
+  snprintf(text, sizeof(text), "%d fps\nframe %d us, worst %d\nflush %d us, %d px\nheap %d B, %d%% frag\nglyph %d%% hit, %d B",
+           frameMeter.getFps(), frameMeter.getLastTime(), frameMeter.getWorstTime(),
+           frameMeter.getLastFlushTime(), frameMeter.getLastPixels(),
+           lvglMem.total_size - lvglMem.free_size, lvglMem.frag_pct,
+           glyphLookups > 0 ? glyphCache.getHits() * 100 / glyphLookups : 0, glyphCache.getUsed());
+  lv_label_set_text(labelPerf, text);
+}
+
+void perfOverlaySet(bool on)
+{
+  Serial.printf("perf overlay: %s\r\n", on ? "on" : "off");
+  perfOverlay = on;
+  if (RunningMode::SETTING == runningMode)
+    settingViewRefresh();
+}
+
+void perfPublish()
+{
+  String msg = "{\"type\":\"event\",\"time\":" + getCurrentTime() + ",\"deviceId\":\"" + currentDeviceId + "\",\"event\":\"perf\"," +
+               frameMeter.toJson() + ",\"glyphCache\":" + glyphCache.toJson() + "}";
+  mqttClient.publish(mqttPubTopic, msg.c_str());
+}
+
+void consoleScan()
+{
+  uint8_t buf[CONSOLE_READ_LEN];
+  size_t len = Serial.available();
+  if (0 == len)
+    return;
+  len = Serial.readBytes(buf, len < sizeof(buf) ? len : sizeof(buf));
+  console.read(buf, len);
+}
+
+// Serial commands, "cmd(arg,...)" lines, runs in the UI task
+void consoleRun(CCTask *task)
+{
+  if (0 == strlen(task->cmd))
+    return;
+  if (!strcmp(task->cmd, "perf"))
+  {
+    if (0 == task->argc)
+      perfOverlaySet(!perfOverlay);
+    else
+      perfOverlaySet(!strcmp(task->argv[0], "on"));
+    frameMeter.print(Serial);
+    glyphCache.print(Serial);
+    return;
+  }
+  if (!strcmp(task->cmd, "sleep"))
+  {
+    // sleep <s>: deep sleep timeout kept on the device over config.json, 0 never sleeps
+    if (task->argc > 0)
+    {
+      settings.setSleepTimeout(atoi(task->argv[0]));
+      xSemaphoreTake(configLock, portMAX_DELAY);
+      powerInit();
+      xSemaphoreGive(configLock);
+    }
+    Serial.printf("deep sleep after %d s\r\n", powerManager.getTimeout(POWER_DEEP_SLEEP) / 1000);
+    return;
+  }
+  if (!strcmp(task->cmd, "backlight"))
+  {
+    // backlight <duty>: full brightness kept on the device, the config levels are percents of it
+    if (task->argc > 0)
+    {
+      int level = atoi(task->argv[0]);
+      backlightLevel = level < 1 ? 1 : level > 1023 ? 1023 : level;
+      settings.setBacklight(backlightLevel);
+      backlightApply();
+    }
+    backlight.print(Serial);
+    Serial.printf("backlight full at duty %d\r\n", backlightLevel);
+    return;
+  }
+  Serial.printf("unknown command [%s]\r\n", task->cmd);
+}
+
+// UI command queue view loader, given to uiCommands.init(); runs in the render task
+void viewShow(uint8_t view)
+{
+  if (view == currentView || view >= viewLen || NULL == views[view].screen)
+    return;
+  ViewEntry *entry = &views[view];
+  if (NULL == *entry->screen)
+    viewBuild(entry);
+  lv_obj_t *oldScreen = lv_scr_act();
+  lv_scr_load(*entry->screen);
+  uint8_t previous = currentView;
+  currentView = view;
+  if (RunningMode::LOADING == previous)
+  {
+    // the empty default screen of lv_init()
+    lv_obj_del(oldScreen);
+  }
+#if VIEW_FREE_LAZY
+  else if (views[previous].lazy)
+  {
+    viewFree(previous);
+  }
+#endif
+  lv_mem_monitor(&lvglMem);
+}
+
+void viewBuild(ViewEntry *entry)
+{
+  uint32_t beginTime = micros();
+  uint32_t memUsed = lvglMemUsed();
+  entry->build();
+  entry->size = lvglMemUsed() - memUsed;
+  Serial.printf("view %s: %d bytes, built in %d us\r\n", entry->name, entry->size, (int)(micros() - beginTime));
+}
+
+void viewFree(uint8_t view)
+{
+  lv_obj_del(*views[view].screen);
+  *views[view].screen = NULL;
+  // the children went with the screen, queued commands for them are dropped
+  if (RunningMode::LEARNING == view)
+  {
+    labelTipLearning = NULL;
+  }
+  else if (RunningMode::SETTING == view)
+  {
+    labelSettingInfo = NULL;
+    labelSettingSync = NULL;
+    labelSettingPerf = NULL;
+    memset(menuSettings, 0, sizeof(menuSettings));
+  }
+}
+
+void viewReport(Print &out)
+{
+  out.printf("lvgl heap: %d used, %d peak, %d free, %d%% frag\r\n",
+             lvglMem.total_size - lvglMem.free_size, lvglMem.max_used, lvglMem.free_size, lvglMem.frag_pct);
+  for (uint8_t i = 0; i < viewLen; i++)
+  {
+    if (NULL == views[i].screen)
+      continue;
+    out.printf("view %s: %d bytes%s\r\n", views[i].name, views[i].size,
+               NULL == *views[i].screen ? ", not built" : "");
+  }
+}
+
+uint32_t lvglMemUsed()
+{
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  return mon.total_size - mon.free_size;
+}
+
 void standbyView()
 {
-  viewBgStandby = lv_obj_create(lv_scr_act(), NULL);
+  viewBgStandby = lv_obj_create(NULL, NULL);
   lv_obj_set_style_local_bg_color(viewBgStandby, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
   lv_obj_set_style_local_border_opa(viewBgStandby, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
   lv_obj_set_style_local_radius(viewBgStandby, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
   lv_obj_set_style_local_pad_inner(viewBgStandby, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
-  lv_obj_set_size(viewBgStandby, 240, 240);
-  lv_obj_align(viewBgStandby, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_hidden(viewBgStandby, true);
 
   lv_obj_t *labelTitle;
   labelTitle = lv_label_create(viewBgStandby, NULL);
@@ -951,25 +2853,33 @@ void standbyView()
   lv_label_set_text(labelTitle, "i-Remote");
   lv_obj_align(labelTitle, NULL, LV_ALIGN_IN_TOP_LEFT, 10, 10);
 
-  lv_obj_t *cardA;
-  cardA = lv_obj_create(viewBgStandby, NULL);
-  lv_obj_set_size(cardA, 110, 110);
-  lv_obj_align(cardA, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_style_local_border_opa(cardA, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
-
-  lv_obj_t *cardB;
-  cardB = lv_obj_create(viewBgStandby, NULL);
-  lv_obj_set_size(cardB, 110, 110);
-  lv_obj_align(cardB, NULL, LV_ALIGN_CENTER, -140, 0);
-  lv_obj_set_style_local_bg_opa(cardB, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_50);
-  lv_obj_set_style_local_border_opa(cardB, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
-
-  lv_obj_t *cardC;
-  cardC = lv_obj_create(viewBgStandby, NULL);
-  lv_obj_set_size(cardC, 110, 110);
-  lv_obj_align(cardC, NULL, LV_ALIGN_CENTER, 140, 0);
-  lv_obj_set_style_local_bg_opa(cardC, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_50);
-  lv_obj_set_style_local_border_opa(cardC, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+  // the cards slide inside this strip, only it is redrawn meanwhile
+  carousel = lv_obj_create(viewBgStandby, NULL);
+  lv_obj_set_size(carousel, LV_HOR_RES_MAX, 110);
+  lv_obj_align(carousel, NULL, LV_ALIGN_CENTER, 0, 0);
+  lv_obj_set_style_local_bg_opa(carousel, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+  lv_obj_set_style_local_border_opa(carousel, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+  lv_obj_set_style_local_radius(carousel, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    carouselCards[i] = lv_obj_create(carousel, NULL);
+    lv_obj_set_size(carouselCards[i], 110, 110);
+    lv_obj_set_style_local_border_opa(carouselCards[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+
+    // scene icon from the asset pack, up to 48 x 48 above the scene name
+    carouselIcons[i] = lv_img_create(carouselCards[i], NULL);
+    lv_obj_align(carouselIcons[i], NULL, LV_ALIGN_IN_TOP_MID, 0, 6);
+    lv_obj_set_auto_realign(carouselIcons[i], true);
+    lv_obj_set_hidden(carouselIcons[i], true);
+
+    carouselLabels[i] = lv_label_create(carouselCards[i], NULL);
+    lv_obj_set_style_local_text_color(carouselLabels[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+    lv_label_set_text(carouselLabels[i], ""); // filled in by carouselScan()
+    lv_obj_align(carouselLabels[i], NULL, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_auto_realign(carouselLabels[i], true);
+  }
+  carouselPlace(0);
 
   // lv_obj_t *btnA;
   // btnA = lv_obj_create(viewBgStandby, NULL);
@@ -1009,12 +2919,34 @@ void standbyView()
   // lv_label_set_text(labelD, "D");
   // lv_obj_align(labelD, NULL, LV_ALIGN_CENTER, 0, -8);
 
-  String sceneName = json["scenes"][currentScene]["name"];
-
-  labelSence = lv_label_create(viewBgStandby, NULL);
-  lv_obj_set_style_local_text_color(labelSence, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
-  lv_label_set_text(labelSence, sceneName.c_str());
-  lv_obj_align(labelSence, NULL, LV_ALIGN_CENTER, 0, 0);
+  // one label per digit, hidden until the clock is set
+  clockBox = lv_obj_create(viewBgStandby, NULL);
+  lv_obj_set_style_local_bg_opa(clockBox, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+  lv_obj_set_style_local_border_opa(clockBox, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
+  lv_obj_set_style_local_radius(clockBox, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+  lv_coord_t clockX = 0;
+  for (uint8_t i = 0; i < CLOCK_DIGITS; i++)
+  {
+    if (i > 0 && 0 == i % 2)
+    {
+      lv_obj_t *labelColon = lv_label_create(clockBox, NULL);
+      lv_obj_set_style_local_text_color(labelColon, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+      lv_label_set_text(labelColon, ":");
+      lv_obj_set_pos(labelColon, clockX, 0);
+      clockX += lv_obj_get_width(labelColon) + 2;
+    }
+    clockDigits[i] = lv_label_create(clockBox, NULL);
+    lv_obj_set_style_local_text_color(clockDigits[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_label_set_text(clockDigits[i], "0");
+    lv_label_set_long_mode(clockDigits[i], LV_LABEL_LONG_CROP);
+    lv_label_set_align(clockDigits[i], LV_LABEL_ALIGN_CENTER);
+    lv_obj_set_width(clockDigits[i], CLOCK_DIGIT_WIDTH);
+    lv_obj_set_pos(clockDigits[i], clockX, 0);
+    clockX += CLOCK_DIGIT_WIDTH;
+  }
+  lv_obj_set_size(clockBox, clockX, lv_obj_get_height(clockDigits[0]));
+  lv_obj_align(clockBox, NULL, LV_ALIGN_IN_TOP_MID, 0, 10);
+  lv_obj_set_hidden(clockBox, true);
 
   labelStateMqtt = lv_label_create(viewBgStandby, NULL);
   lv_obj_set_style_local_text_color(labelStateMqtt, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
@@ -1023,16 +2955,141 @@ void standbyView()
   lv_obj_set_hidden(labelStateMqtt, true);
 }
 
+// UI task: the cards around currentScene, names and icon sources resolved
+// here under configLock and handed over, the render task never reads the
+// image, which compaction may remap under it
+void carouselShow(bool refill)
+{
+  CarouselContent content;
+  memset(&content, 0, sizeof(content));
+  xSemaphoreTake(configLock, portMAX_DELAY);
+  content.scene = currentScene;
+  content.sceneSize = sceneSize;
+  for (uint8_t i = 0; i < 3 && sceneSize > 0; i++)
+  {
+    uint16_t cardScene = (currentScene + sceneSize + i - 1) % sceneSize;
+    strlcpy(content.names[i], configImage.getSceneName(cardScene), sizeof(content.names[i]));
+    snprintf(content.icons[i], sizeof(content.icons[i]), ASSET_SRC_PREFIX "scene-%s", configImage.getSceneCode(cardScene));
+    if (!assetDecoder.hasImage(content.icons[i] + strlen(ASSET_SRC_PREFIX)))
+      content.icons[i][0] = '\0';
+  }
+  xSemaphoreGive(configLock);
+  portENTER_CRITICAL(&carouselLock);
+  carouselContent = content;
+  carouselVersion++;
+  carouselDirty = carouselDirty || refill;
+  portEXIT_CRITICAL(&carouselLock);
+}
+
+// Render task, owns the carousel directly. Follows carouselContent with a
+// slide when the scene moved by one, otherwise the cards are refilled in place.
+void carouselScan()
+{
+  if (NULL == carousel || carouselSliding || carouselTaken == carouselVersion)
+    return;
+  portENTER_CRITICAL(&carouselLock);
+  carouselNext = carouselContent;
+  carouselTaken = carouselVersion;
+  bool dirty = carouselDirty;
+  carouselDirty = false;
+  portEXIT_CRITICAL(&carouselLock);
+  uint16_t scene = carouselNext.scene;
+  uint16_t size = carouselNext.sceneSize;
+  int16_t step = 0;
+  if (!dirty && size > 1 && scene == (carouselShown + 1) % size)
+    step = 1;
+  else if (!dirty && size > 1 && carouselShown == (scene + 1) % size)
+    step = -1;
+  if (0 == step || !panelOn || lv_scr_act() != viewBgStandby)
+  {
+    carouselFill(&carouselNext);
+    return;
+  }
+  carouselSliding = true;
+  carouselSlideEnd = -step * CAROUSEL_CARD_GAP;
+  lv_anim_t anim;
+  lv_anim_init(&anim);
+  lv_anim_set_var(&anim, carousel);
+  lv_anim_set_exec_cb(&anim, carouselSlideExec);
+  lv_anim_set_values(&anim, 0, 1024);
+  lv_anim_set_time(&anim, CAROUSEL_SLIDE_TIME);
+  lv_anim_set_ready_cb(&anim, carouselSlideReady);
+  lv_anim_start(&anim);
+}
+
+// Scene name and "scene-<code>" icon on each card, cards back in place
+void carouselFill(const CarouselContent *content)
+{
+  carouselShown = content->scene;
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    const char *src = content->icons[i];
+    if (strcmp(lv_label_get_text(carouselLabels[i]), content->names[i]))
+      lv_label_set_text(carouselLabels[i], content->names[i]);
+    if (src[0] != '\0')
+      lv_img_set_src(carouselIcons[i], src);
+    lv_obj_set_hidden(carouselIcons[i], '\0' == src[0]);
+  }
+  carouselPlace(0);
+}
+
+// Cards shifted by offset, fading from the centre to half opacity a gap away
+void carouselPlace(int16_t offset)
+{
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    int16_t x = (i - 1) * CAROUSEL_CARD_GAP + offset;
+    int16_t distance = min((int)abs(x), CAROUSEL_CARD_GAP);
+    lv_opa_t opa = LV_OPA_COVER - (LV_OPA_COVER - LV_OPA_50) * distance / CAROUSEL_CARD_GAP;
+    lv_obj_align(carouselCards[i], NULL, LV_ALIGN_CENTER, x, 0);
+    lv_obj_set_style_local_bg_opa(carouselCards[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, opa);
+  }
+}
+
+// value: 0 to 1024 over the slide, eased out here
+void carouselSlideExec(void *var, lv_anim_value_t value)
+{
+  int32_t rest = 1024 - value;
+  int32_t eased = 1024 - rest * rest / 1024 * rest / 1024;
+  carouselPlace(carouselSlideEnd * eased / 1024);
+}
+
+// The cards are reused: refilled for the scene slid to and moved back, a
+// newer scene is picked up by the next carouselScan()
+void carouselSlideReady(lv_anim_t *anim)
+{
+  carouselFill(&carouselNext);
+  carouselSliding = false;
+}
+
+// UI task: the standby clock, each digit only sent when it changed
+void clockScan()
+{
+  uint8_t changed = clockHelper.refresh();
+  if (!clockHelper.isSet() || 0 == (changed & (CLOCK_SECONDS ? CLOCK_CHANGED_ALL : ~CLOCK_CHANGED_SECOND)))
+    return;
+  if ('\0' == clockShown[0])
+    uiCommands.setHidden(&clockBox, false);
+  char digits[8];
+  snprintf(digits, sizeof(digits), "%02d%02d%02d", clockHelper.getHour(), clockHelper.getMinute(),
+           clockHelper.getSecond());
+  for (uint8_t i = 0; i < CLOCK_DIGITS; i++)
+  {
+    if (digits[i] == clockShown[i])
+      continue;
+    char text[2] = {digits[i], '\0'};
+    uiCommands.setText(&clockDigits[i], text);
+    clockShown[i] = digits[i];
+  }
+}
+
 void learningView()
 {
-  viewBgLearning = lv_obj_create(lv_scr_act(), NULL);
+  viewBgLearning = lv_obj_create(NULL, NULL);
   lv_obj_set_style_local_bg_color(viewBgLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
   lv_obj_set_style_local_border_opa(viewBgLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
   lv_obj_set_style_local_radius(viewBgLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
   lv_obj_set_style_local_pad_inner(viewBgLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
-  lv_obj_set_size(viewBgLearning, 240, 240);
-  lv_obj_align(viewBgLearning, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_hidden(viewBgLearning, true);
 
   lv_obj_t *labelTitle;
   labelTitle = lv_label_create(viewBgLearning, NULL);
@@ -1048,6 +3105,9 @@ void learningView()
 
   labelTipLearning = lv_label_create(viewBgLearning, NULL);
   lv_obj_set_style_local_text_color(labelTipLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+#if UI_LANG_ZH
+  lv_obj_set_style_local_text_font(labelTipLearning, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, &font_ui24);
+#endif
   lv_label_set_text(labelTipLearning, "");
   lv_label_set_long_mode(labelTipLearning, LV_LABEL_LONG_BREAK);
   lv_label_set_align(labelTipLearning, LV_LABEL_ALIGN_CENTER);
@@ -1057,14 +3117,11 @@ void learningView()
 
 void remoteView()
 {
-  viewBgRemote = lv_obj_create(lv_scr_act(), NULL);
+  viewBgRemote = lv_obj_create(NULL, NULL);
   lv_obj_set_style_local_bg_color(viewBgRemote, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
   lv_obj_set_style_local_border_opa(viewBgRemote, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
   lv_obj_set_style_local_radius(viewBgRemote, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
   lv_obj_set_style_local_pad_inner(viewBgRemote, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
-  lv_obj_set_size(viewBgRemote, 240, 240);
-  lv_obj_align(viewBgRemote, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_hidden(viewBgRemote, true);
 
   lv_obj_t *labelTitle;
   labelTitle = lv_label_create(viewBgRemote, NULL);
@@ -1089,14 +3146,11 @@ void remoteView()
 
 void tipView()
 {
-  viewBgTip = lv_obj_create(lv_scr_act(), NULL);
+  viewBgTip = lv_obj_create(NULL, NULL);
   lv_obj_set_style_local_bg_color(viewBgTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
   lv_obj_set_style_local_border_opa(viewBgTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
   lv_obj_set_style_local_radius(viewBgTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
   lv_obj_set_style_local_pad_inner(viewBgTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
-  lv_obj_set_size(viewBgTip, 240, 240);
-  lv_obj_align(viewBgTip, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_hidden(viewBgTip, true);
 
   lv_obj_t *labelTitle;
   labelTitle = lv_label_create(viewBgTip, NULL);
@@ -1106,6 +3160,9 @@ void tipView()
 
   labelTip = lv_label_create(viewBgTip, NULL);
   lv_obj_set_style_local_text_color(labelTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+#if UI_LANG_ZH
+  lv_obj_set_style_local_text_font(labelTip, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, &font_ui24);
+#endif
   lv_label_set_text(labelTip, "");
   lv_label_set_long_mode(labelTip, LV_LABEL_LONG_BREAK);
   lv_label_set_align(labelTip, LV_LABEL_ALIGN_CENTER);
@@ -1115,14 +3172,11 @@ void tipView()
 
 void settingView()
 {
-  viewBgSetting = lv_obj_create(lv_scr_act(), NULL);
+  viewBgSetting = lv_obj_create(NULL, NULL);
   lv_obj_set_style_local_bg_color(viewBgSetting, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
   lv_obj_set_style_local_border_opa(viewBgSetting, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_0);
   lv_obj_set_style_local_radius(viewBgSetting, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
   lv_obj_set_style_local_pad_inner(viewBgSetting, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
-  lv_obj_set_size(viewBgSetting, 240, 240);
-  lv_obj_align(viewBgSetting, NULL, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_hidden(viewBgSetting, true);
 
   lv_obj_t *labelTitle;
   labelTitle = lv_label_create(viewBgSetting, NULL);
@@ -1133,7 +3187,7 @@ void settingView()
   for (uint8_t i = 0; i < menuSettingLen; i++)
   {
     menuSettings[i] = lv_obj_create(viewBgSetting, NULL);
-    lv_obj_set_style_local_bg_color(menuSettings[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, lv_color_hex(0x888888));
+    lv_obj_set_style_local_bg_color(menuSettings[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, lv_color_hex(i == currentSettingMenu ? 0xFFFFFF : 0xCCCCCC));
     lv_obj_set_size(menuSettings[i], 75, 32);
     lv_obj_align(menuSettings[i], NULL, LV_ALIGN_IN_TOP_LEFT, -5, 40 + i * 30);
     lv_obj_t *labelSetting;
@@ -1147,10 +3201,9 @@ void settingView()
   lv_obj_set_width(labelSettingInfo, 130);
   lv_obj_set_height(labelSettingInfo, 120);
   lv_obj_set_style_local_text_color(labelSettingInfo, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
-  String lvglVersionStr = (String)LVGL_VERSION_MAJOR + "." + LVGL_VERSION_MINOR + "." + LVGL_VERSION_PATCH;
-  String sysInfoStr = "[i-Remote]\r\nFirmware: v0.1.0\r\nMCU: ESP32-S\r\nLVGL: " + lvglVersionStr + "\r\n";
-  lv_label_set_text(labelSettingInfo, sysInfoStr.c_str());
+  lv_label_set_text(labelSettingInfo, settingInfoText().c_str());
   lv_obj_align(labelSettingInfo, NULL, LV_ALIGN_IN_TOP_LEFT, 90, 60);
+  lv_obj_set_hidden(labelSettingInfo, 0 != currentSettingMenu);
 
   labelSettingSync = lv_label_create(viewBgSetting, NULL);
   lv_obj_set_width(labelSettingSync, 130);
@@ -1158,32 +3211,68 @@ void settingView()
   lv_obj_set_style_local_text_color(labelSettingSync, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
   lv_label_set_text(labelSettingSync, "Storage to cloud");
   lv_obj_align(labelSettingSync, NULL, LV_ALIGN_IN_TOP_LEFT, 90, 60);
-
-  settingViewRefresh();
+  lv_obj_set_hidden(labelSettingSync, 1 != currentSettingMenu);
+
+  labelSettingPerf = lv_label_create(viewBgSetting, NULL);
+  lv_obj_set_width(labelSettingPerf, 130);
+  lv_obj_set_height(labelSettingPerf, 120);
+  lv_obj_set_style_local_text_color(labelSettingPerf, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+  lv_label_set_text(labelSettingPerf, perfOverlay ? "Overlay: on" : "Overlay: off");
+  lv_obj_align(labelSettingPerf, NULL, LV_ALIGN_IN_TOP_LEFT, 90, 60);
+  lv_obj_set_hidden(labelSettingPerf, 2 != currentSettingMenu);
   // TODO
 }
 
+void settingInfoRefresh()
+{
+  uiCommands.setText(&labelSettingInfo, settingInfoText().c_str());
+}
+
+String settingInfoText()
+{
+  String lvglVersionStr = (String)LVGL_VERSION_MAJOR + "." + LVGL_VERSION_MINOR + "." + LVGL_VERSION_PATCH;
+  String sysInfoStr = "[i-Remote]\r\nFirmware: v0.1.0\r\nMCU: ESP32-S\r\nLVGL: " + lvglVersionStr + "\r\n";
+  if (bootTimer.getTotal() > 0)
+  {
+    // the two slowest phases, the whole report goes to Serial
+    const BootPhase *slowest[2] = {NULL, NULL};
+    for (uint8_t i = 0; i < bootTimer.getPhaseNum(); i++)
+    {
+      const BootPhase *phase = bootTimer.getPhase(i);
+      if (NULL == slowest[0] || phase->time > slowest[0]->time)
+      {
+        slowest[1] = slowest[0];
+        slowest[0] = phase;
+      }
+      else if (NULL == slowest[1] || phase->time > slowest[1]->time)
+      {
+        slowest[1] = phase;
+      }
+    }
+    sysInfoStr += (String) "Boot: " + (bootTimer.getTotal() / 1000) + " ms\r\n";
+    for (uint8_t i = 0; i < 2 && slowest[i] != NULL; i++)
+    {
+      sysInfoStr += (String) " " + slowest[i]->name + ": " + (slowest[i]->time / 1000) + " ms\r\n";
+    }
+  }
+  return sysInfoStr;
+}
+
 void settingViewRefresh()
 {
-  lv_obj_set_hidden(labelSettingInfo, true);
-  lv_obj_set_hidden(labelSettingSync, true);
   for (uint8_t i = 0; i < menuSettingLen; i++)
   {
     if (i == currentSettingMenu)
     {
-      lv_obj_set_style_local_bg_color(menuSettings[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, lv_color_hex(0xFFFFFF));
+      uiCommands.setBgColor(&menuSettings[i], 0xFFFFFF);
     }
     else
     {
-      lv_obj_set_style_local_bg_color(menuSettings[i], LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, lv_color_hex(0xCCCCCC));
+      uiCommands.setBgColor(&menuSettings[i], 0xCCCCCC);
     }
   }
-  if (0 == currentSettingMenu)
-  {
-    lv_obj_set_hidden(labelSettingInfo, false);
-  }
-  if (1 == currentSettingMenu)
-  {
-    lv_obj_set_hidden(labelSettingSync, false);
-  }
+  uiCommands.setHidden(&labelSettingInfo, 0 != currentSettingMenu);
+  uiCommands.setHidden(&labelSettingSync, 1 != currentSettingMenu);
+  uiCommands.setHidden(&labelSettingPerf, 2 != currentSettingMenu);
+  uiCommands.setText(&labelSettingPerf, perfOverlay ? "Overlay: on" : "Overlay: off");
 }
\ No newline at end of file
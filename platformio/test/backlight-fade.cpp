@@ -0,0 +1,148 @@
+// Host check of the backlight fades on a modelled LEDC channel: one driver
+// call per fade, the hardware steps the duty, a new target turns a fade around.
+// g++ -I host -I ../src backlight-fade.cpp ../src/Backlight.cpp -o backlight-fade && ./backlight-fade
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "Backlight.h"
+
+#define FREQ 1000 // uint: Hz, PWM_FREQ_TFT_LED, one PWM cycle per ms
+
+uint32_t now = 0; // uint: ms
+uint32_t millis() { return now; }
+uint32_t micros() { return now * 1000; }
+
+// LEDC channel: duty steps by scale every cyclesPerStep PWM cycles, steps times
+uint32_t hwStart = 0;
+bool hwUp = false;
+uint32_t hwSteps = 0;
+uint32_t hwCycles = 1;
+uint32_t hwScale = 0;
+uint32_t hwBegin = 0; // uint: ms
+uint32_t pending[4];  // written, not yet updated
+uint32_t driverCalls = 0;
+
+uint32_t ledc_get_duty(ledc_mode_t mode, ledc_channel_t channel)
+{
+    uint32_t done = min((now - hwBegin) * FREQ / 1000 / hwCycles, hwSteps);
+    return hwUp ? hwStart + done * hwScale : hwStart - done * hwScale;
+}
+
+int ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty)
+{
+    driverCalls++;
+    uint32_t set[] = {duty, 0, 1, 0};
+    memcpy(pending, set, sizeof(pending));
+    hwUp = true;
+    return 0;
+}
+
+int ledc_set_fade(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty, ledc_duty_direction_t direction,
+                  uint32_t steps, uint32_t cyclesPerStep, uint32_t scale)
+{
+    driverCalls++;
+    if (steps > 1023 || cyclesPerStep > 1023 || scale > 1023 || 0 == cyclesPerStep)
+        printf("FAIL: fade out of the hardware range: %u steps, %u cycles, scale %u\r\n", steps, cyclesPerStep, scale);
+    uint32_t set[] = {duty, steps, cyclesPerStep, scale};
+    memcpy(pending, set, sizeof(pending));
+    hwUp = LEDC_DUTY_DIR_INCREASE == direction;
+    return 0;
+}
+
+int ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel)
+{
+    driverCalls++;
+    hwStart = pending[0];
+    hwSteps = pending[1];
+    hwCycles = pending[2];
+    hwScale = pending[3];
+    hwBegin = now;
+    return 0;
+}
+
+int failures = 0;
+
+void expect(bool ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAIL at %u ms: %s, duty %u\r\n", now, what, ledc_get_duty(LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_0));
+        failures++;
+    }
+}
+
+// the UI task: scan() every pass, returns the driver calls made meanwhile
+uint32_t run(Backlight *backlight, uint32_t duration)
+{
+    uint32_t calls = driverCalls;
+    for (uint32_t t = 0; t < duration; t += 5)
+    {
+        now += 5;
+        backlight->scan();
+    }
+    return driverCalls - calls;
+}
+
+// a fade reaches its duty in about its time, the driver called once for it
+void fade(Backlight *backlight, uint16_t duty, uint16_t time, const char *what)
+{
+    backlight->set(duty, time);
+    backlight->scan();
+    uint32_t calls = driverCalls;
+    uint32_t beginTime = now;
+    uint32_t last = backlight->getDuty();
+    uint32_t changeTime = now;
+    while (backlight->getDuty() != duty && now - beginTime < 20000)
+    {
+        run(backlight, 5);
+        uint32_t current = backlight->getDuty();
+        if (current != last)
+            changeTime = now;
+        // the hardware waits at most 1023 PWM cycles between two steps
+        expect(now - changeTime <= 1030, what);
+        last = current;
+    }
+    expect(backlight->getDuty() == duty, what);
+    expect(driverCalls == calls, "no driver call while the hardware steps");
+    // whole PWM cycles per step: off by up to half the time
+    uint32_t took = now - beginTime;
+    expect(2 * took + 10 >= time && 2 * took <= 3u * time + 10, what);
+    printf("%-34s %5u ms for %5u ms\r\n", what, took, (uint32_t)time);
+}
+
+int main()
+{
+    Backlight backlight;
+    backlight.init(0, FREQ);
+    backlight.set(0, 0);
+    backlight.scan();
+
+    fade(&backlight, 800, 200, "fade in, fewer steps than cycles");
+    fade(&backlight, 0, 600, "fade out");
+    fade(&backlight, 1000, 100, "more steps than cycles");
+    fade(&backlight, 995, 5000, "a few steps, a long time");
+    fade(&backlight, 0, 0, "no fade time");
+
+    // a wake halfway through a fade-out turns it around from the duty reached
+    backlight.set(800, 0);
+    backlight.scan();
+    backlight.set(0, 800);
+    run(&backlight, 400);
+    uint32_t reached = backlight.getDuty();
+    expect(reached > 300 && reached < 500, "halfway through the fade-out");
+    backlight.set(800, 200);
+    expect(2u == run(&backlight, 5), "one fade started for the new target");
+    run(&backlight, 20);
+    expect(backlight.getDuty() > reached, "turned around at once");
+    run(&backlight, 180);
+    expect(800 == backlight.getDuty(), "back at full in the fade-in time");
+
+    // off() does not wait for a running fade
+    backlight.set(0, 600);
+    run(&backlight, 100);
+    backlight.off();
+    expect(0 == backlight.getDuty(), "dark right after off()");
+
+    printf("%s\r\n", failures ? "backlight fade: FAILED" : "backlight fade: OK");
+    return failures ? 1 : 0;
+}
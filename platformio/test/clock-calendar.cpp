@@ -0,0 +1,129 @@
+// Host check of the ClockHelper calendar against gmtime() on a simulated esp_timer.
+// g++ -I host -I ../src clock-calendar.cpp ../src/ClockHelper.cpp -o clock-calendar && ./clock-calendar
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "ClockHelper.h"
+
+int64_t hostTimer = 0; // uint: us
+int failures = 0;
+
+// local fields as gmtime() has them for the local time
+bool same(ClockHelper *clock, int64_t local)
+{
+    time_t secs = local;
+    struct tm tm;
+    gmtime_r(&secs, &tm);
+    return clock->getYear() == tm.tm_year + 1900 && clock->getMonth() == tm.tm_mon + 1 &&
+           clock->getDay() == tm.tm_mday && clock->getHour() == tm.tm_hour &&
+           clock->getMinute() == tm.tm_min && clock->getSecond() == tm.tm_sec;
+}
+
+void expect(bool ok, const char *what, ClockHelper *clock)
+{
+    if (!ok)
+    {
+        printf("FAIL: %s, clock at %04d-%02d-%02d %02d:%02d:%02d\r\n", what,
+               clock->getYear(), clock->getMonth(), clock->getDay(),
+               clock->getHour(), clock->getMinute(), clock->getSecond());
+        failures++;
+    }
+}
+
+// UTC seconds for a date, the zone is 0 below so local equals UTC
+int64_t at(int year, int month, int day, int hour, int minute, int second)
+{
+    struct tm tm = {};
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    tm.tm_sec = second;
+    return timegm(&tm);
+}
+
+// server time set, then the clock moved on by seconds, returns the refresh() mask
+uint8_t advance(ClockHelper *clock, int64_t seconds)
+{
+    hostTimer += seconds * 1000000;
+    return clock->refresh();
+}
+
+void setAt(ClockHelper *clock, int64_t local)
+{
+    clock->setTime((uint64_t)local * 1000);
+}
+
+// one second before and after each boundary, stepped from the second before
+void boundary(ClockHelper *clock, int64_t before, uint8_t mask, const char *what)
+{
+    setAt(clock, before);
+    expect(CLOCK_CHANGED_ALL == clock->refresh(), what, clock);
+    expect(same(clock, before), what, clock);
+    expect(mask == advance(clock, 1), what, clock);
+    expect(same(clock, before + 1), what, clock);
+}
+
+int main()
+{
+    ClockHelper clock;
+    clock.setZone(0);
+    hostTimer = 5000000;
+
+    // setTime() leaves the whole-clock change to the next refresh()
+    setAt(&clock, at(2024, 6, 1, 12, 0, 0));
+    expect(CLOCK_CHANGED_ALL == clock.refresh(), "first refresh after setTime() is a full change", &clock);
+    expect(0 == clock.refresh(), "nothing moved on the same second", &clock);
+    setAt(&clock, at(2024, 6, 1, 12, 0, 0));
+    expect(CLOCK_CHANGED_ALL == clock.refresh(), "setTime() again is a full change", &clock);
+    clock.setZone(480);
+    expect(CLOCK_CHANGED_ALL == clock.refresh(), "setZone() is a full change", &clock);
+    expect(20 == clock.getHour(), "12:00 UTC is 20:00 in GMT+8", &clock);
+    clock.setZone(0);
+
+    uint8_t dayMask = CLOCK_CHANGED_SECOND | CLOCK_CHANGED_MINUTE | CLOCK_CHANGED_HOUR | CLOCK_CHANGED_DAY;
+    uint8_t monthMask = dayMask | CLOCK_CHANGED_MONTH;
+    boundary(&clock, at(2024, 2, 28, 23, 59, 59), dayMask, "leap year, 28 to 29 February");
+    boundary(&clock, at(2024, 2, 29, 23, 59, 59), monthMask, "leap year, 29 February to March");
+    boundary(&clock, at(2023, 2, 28, 23, 59, 59), monthMask, "common year, 28 February to March");
+    boundary(&clock, at(2100, 2, 28, 23, 59, 59), monthMask, "2100 is not a leap year");
+    boundary(&clock, at(2000, 2, 28, 23, 59, 59), dayMask, "2000 is a leap year");
+    boundary(&clock, at(2024, 4, 30, 23, 59, 59), monthMask, "30 day month end");
+    boundary(&clock, at(2024, 1, 31, 23, 59, 59), monthMask, "31 day month end");
+    boundary(&clock, at(2024, 12, 31, 23, 59, 59), CLOCK_CHANGED_ALL, "year rollover");
+    boundary(&clock, at(2024, 6, 1, 12, 59, 59), CLOCK_CHANGED_SECOND | CLOCK_CHANGED_MINUTE | CLOCK_CHANGED_HOUR, "new hour");
+
+    // stepped over a day at once, then a gap over a day converted from scratch
+    int64_t local = at(2023, 12, 31, 23, 30, 0);
+    setAt(&clock, local);
+    clock.refresh();
+    expect((CLOCK_CHANGED_DAY | CLOCK_CHANGED_MONTH | CLOCK_CHANGED_YEAR) == advance(&clock, CLOCK_STEP_LIMIT),
+           "a day stepped, into the new year", &clock);
+    local += CLOCK_STEP_LIMIT;
+    expect(same(&clock, local), "a day stepped", &clock);
+    advance(&clock, CLOCK_STEP_LIMIT + 1);
+    local += CLOCK_STEP_LIMIT + 1;
+    expect(same(&clock, local), "a gap over a day", &clock);
+    advance(&clock, 40 * 86400 + 7);
+    local += 40 * 86400 + 7;
+    expect(same(&clock, local), "a gap over a month, across 29 February", &clock);
+
+    // every step size the UI and render passes produce, over four years
+    setAt(&clock, at(2023, 1, 1, 0, 0, 0));
+    local = at(2023, 1, 1, 0, 0, 0);
+    clock.refresh();
+    uint32_t steps = 0;
+    while (local < at(2027, 1, 1, 0, 0, 0) && failures < 10)
+    {
+        int64_t seconds = 1 + steps * 7919 % 5400;
+        advance(&clock, seconds);
+        local += seconds;
+        expect(same(&clock, local), "stepped over four years", &clock);
+        steps++;
+    }
+    printf("%u steps over four years\r\n", steps);
+
+    printf("%s\r\n", failures ? "clock calendar: FAILED" : "clock calendar: OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+// Just enough of Arduino.h for the host checks, one thread, no locks
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(x)
+#define portEXIT_CRITICAL(x)
+
+// the host check keeps the clock
+uint32_t millis();
+uint32_t micros();
+
+template <typename T> T min(T a, T b) { return a < b ? a : b; }
+template <typename T> T max(T a, T b) { return a > b ? a : b; }
+
+class Print
+{
+public:
+    int printf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int len = vprintf(format, args);
+        va_end(args);
+        return len;
+    }
+};
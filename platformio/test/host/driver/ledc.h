@@ -0,0 +1,11 @@
+// LEDC driver calls the backlight makes, the host check models the hardware
+#pragma once
+#include <stdint.h>
+typedef enum { LEDC_HIGH_SPEED_MODE, LEDC_LOW_SPEED_MODE } ledc_mode_t;
+typedef enum { LEDC_CHANNEL_0 } ledc_channel_t;
+typedef enum { LEDC_DUTY_DIR_DECREASE, LEDC_DUTY_DIR_INCREASE } ledc_duty_direction_t;
+uint32_t ledc_get_duty(ledc_mode_t mode, ledc_channel_t channel);
+int ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty);
+int ledc_set_fade(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty, ledc_duty_direction_t direction,
+                  uint32_t steps, uint32_t cyclesPerStep, uint32_t scale);
+int ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel);
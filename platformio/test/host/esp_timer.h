@@ -0,0 +1,5 @@
+// esp_timer on a clock the host check sets, uint: us
+#pragma once
+#include <stdint.h>
+extern int64_t hostTimer;
+static inline int64_t esp_timer_get_time() { return hostTimer; }
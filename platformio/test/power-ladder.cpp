@@ -0,0 +1,70 @@
+// Host check of the power ladder on a simulated clock.
+// g++ -I ../src power-ladder.cpp ../src/PowerManager.cpp -o power-ladder && ./power-ladder
+#include <stdio.h>
+#include <stdint.h>
+#include "PowerManager.h"
+
+int failures = 0;
+
+void expect(bool ok, const char *what, uint32_t now)
+{
+    if (!ok)
+    {
+        printf("FAIL at %u ms: %s\r\n", now, what);
+        failures++;
+    }
+}
+
+// advance the clock in loop() sized steps, returns the stage reached
+PowerStage run(PowerManager *pm, uint32_t *now, uint32_t duration)
+{
+    for (uint32_t t = 0; t < duration; t += 10)
+    {
+        *now += 10;
+        pm->update(*now);
+    }
+    return pm->getStage();
+}
+
+int main()
+{
+    PowerManager pm;
+    pm.setTimeout(POWER_DIM, 30000);
+    pm.setTimeout(POWER_SCREEN_OFF, 60000);
+    pm.setTimeout(POWER_LIGHT_SLEEP, 120000);
+    pm.setTimeout(POWER_DEEP_SLEEP, 300000);
+
+    // start just before millis() wraps
+    uint32_t now = 0xFFFFFFFF - 45000;
+    pm.init(now);
+    expect(run(&pm, &now, 29990) == POWER_ACTIVE, "active before the dim timeout", now);
+    expect(run(&pm, &now, 10) == POWER_DIM, "dim at 30 s", now);
+    expect(run(&pm, &now, 30000) == POWER_SCREEN_OFF, "screen off at 60 s, across the wrap", now);
+    pm.notifyActive(now);
+    expect(pm.getStage() == POWER_ACTIVE, "activity brings it back", now);
+    expect(run(&pm, &now, 119990) == POWER_SCREEN_OFF, "screen off before light sleep", now);
+    expect(run(&pm, &now, 10) == POWER_LIGHT_SLEEP, "light sleep at 120 s", now);
+    expect(run(&pm, &now, 180000) == POWER_DEEP_SLEEP, "deep sleep at 300 s", now);
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < POWER_STAGE_NUM; i++)
+    {
+        uint32_t time = pm.getStageTime((PowerStage)i, now);
+        printf("%-12s %8u ms\r\n", PowerManager::getStageName((PowerStage)i), time);
+        total += time;
+    }
+    expect(total == 30000 + 30000 + 300000, "stage times add up to the run", now);
+    expect(pm.getStageTime(POWER_ACTIVE, now) == 30000 + 30000, "active time", now);
+    expect(pm.getStageTime(POWER_DIM, now) == 30000 + 30000, "dim time", now);
+    expect(pm.getStageTime(POWER_SCREEN_OFF, now) == 60000, "screen off time", now);
+    expect(pm.getStageTime(POWER_LIGHT_SLEEP, now) == 180000, "light sleep time", now);
+
+    // a skipped stage (timeout 0) is never entered
+    pm.setTimeout(POWER_DIM, 0);
+    pm.init(now);
+    expect(run(&pm, &now, 59990) == POWER_ACTIVE, "no dim stage", now);
+    expect(run(&pm, &now, 10) == POWER_SCREEN_OFF, "straight to screen off", now);
+
+    printf("%s\r\n", failures ? "power ladder: FAILED" : "power ladder: OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+# PlatformIO extra script: pack the images and fonts under assets/ into
+# data/assets.pak before the filesystem image is built. The firmware moves
+# the pack into its "assets" partition on the next boot and draws from there
+# (see AssetPack.h for the layout).
+#
+#   assets/<name>.png     image, converted to RGB565 (+ alpha when it has any)
+#   assets/<name>.bin     image, LVGL binary image in a true color format
+#   assets/fonts/<name>.* font, LVGL binary font (lv_font_conv --format bin)
+#
+# Scene icons are named after the scene code: assets/scene-tv.png. Entries
+# are deflate compressed when that saves at least an eighth. Uses no module
+# beyond the standard library.
+#
+# Run by hand with: python tools/asset_pack.py [project dir]
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+try:
+    Import("env")
+    project_dir = env.subst("$PROJECT_DIR")
+except NameError:
+    env = None
+    project_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+ASSET_DIR = os.path.join(project_dir, "assets")
+PACK_FILE = os.path.join(project_dir, "data", "assets.pak")
+PACK_MAGIC = 0x4B505341  # "ASPK"
+PACK_VERSION = 1
+PACK_FLAG_SWAP16 = 0x0001
+NAME_LEN = 24
+TYPE_IMAGE = 1
+TYPE_FONT = 2
+COMPRESSION_NONE = 0
+COMPRESSION_DEFLATE = 1
+HEADER = struct.Struct("<IHHIIIHH")
+ENTRY = struct.Struct("<%dsBBHIIII" % NAME_LEN)
+CF_TRUE_COLOR = 4
+CF_TRUE_COLOR_ALPHA = 5
+CF_TRUE_COLOR_CHROMA_KEYED = 6
+PARTITION_NAME = "assets"
+
+
+class AssetError(Exception):
+    pass
+
+
+# --- images ----------------------------------------------------------------
+
+def read_png(path):
+    # 8 bit, non interlaced gray, RGB, palette, gray + alpha and RGBA
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise AssetError("%s is not a PNG" % path)
+    pos = 8
+    idat = b""
+    palette = b""
+    trns = b""
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = body
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if depth != 8 or interlace != 0 or channels is None:
+        raise AssetError("%s: only 8 bit non interlaced PNGs are supported" % path)
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif color == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif color == 3:
+                i = px[0]
+                alpha = trns[i] if i < len(trns) else 255
+                pixels.append((palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2], alpha))
+            elif color == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+    return width, height, pixels
+
+
+def img_header(cf, width, height):
+    # lv_img_header_t: cf:5 always_zero:3 reserved:2 w:11 h:11
+    if width >= 2048 or height >= 2048:
+        raise AssetError("image over 2047 px")
+    return cf | (width << 10) | (height << 21)
+
+
+def png_image(path, swap):
+    width, height, pixels = read_png(path)
+    alpha = any(p[3] != 255 for p in pixels)
+    out = bytearray()
+    for r, g, b, a in pixels:
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        out += struct.pack(">H" if swap else "<H", c)
+        if alpha:
+            out.append(a)
+    return img_header(CF_TRUE_COLOR_ALPHA if alpha else CF_TRUE_COLOR, width, height), bytes(out)
+
+
+def bin_image(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 4:
+        raise AssetError("%s is truncated" % path)
+    info = struct.unpack_from("<I", data)[0]
+    cf, width, height = info & 0x1F, (info >> 10) & 0x7FF, (info >> 21) & 0x7FF
+    px = {CF_TRUE_COLOR: 2, CF_TRUE_COLOR_CHROMA_KEYED: 2, CF_TRUE_COLOR_ALPHA: 3}.get(cf)
+    if px is None:
+        raise AssetError("%s: color format %d is not a 16 bit true color one" % (path, cf))
+    if len(data) - 4 != width * height * px:
+        raise AssetError("%s: %d bytes of pixels for %dx%d" % (path, len(data) - 4, width, height))
+    return info, data[4:]
+
+
+# --- pack ------------------------------------------------------------------
+
+def color_swap():
+    # LV_COLOR_16_SWAP as the firmware is compiled with it. build_flags define
+    # it first, so an lv_conf.h that defines it again without an #ifndef guard
+    # wins, as it does in the preprocessor
+    flag = None
+    if env is not None:
+        for define in env.get("CPPDEFINES", []):
+            if isinstance(define, (list, tuple)) and define[0] == "LV_COLOR_16_SWAP":
+                flag = str(define[1]) != "0"
+    for root in ("include", "lib", os.path.join(".pio", "libdeps")):
+        for dirpath, _, files in os.walk(os.path.join(project_dir, root)):
+            if "lv_conf.h" not in files:
+                continue
+            path = os.path.join(dirpath, "lv_conf.h")
+            with open(path, encoding="utf-8", errors="replace") as f:
+                text = f.read()
+            m = re.search(r"^\s*#define\s+LV_COLOR_16_SWAP\s+(\d)", text, re.M)
+            if not m:
+                continue
+            conf = m.group(1) != "0"
+            if flag is None:
+                return conf
+            if re.search(r"#ifndef\s+LV_COLOR_16_SWAP\b", text[:m.start()]):
+                return flag
+            if conf != flag:
+                print("asset_pack: %s sets LV_COLOR_16_SWAP %d over build_flags, guard it with #ifndef"
+                      % (os.path.relpath(path, project_dir), int(m.group(1))))
+            return conf
+    return bool(flag)
+
+
+def collect(swap):
+    items = []
+    if not os.path.isdir(ASSET_DIR):
+        return items
+    for dirpath, _, files in os.walk(ASSET_DIR):
+        font = os.path.relpath(dirpath, ASSET_DIR).split(os.sep)[0] == "fonts"
+        for name in sorted(files):
+            path = os.path.join(dirpath, name)
+            stem, ext = os.path.splitext(name)
+            if len(stem.encode()) >= NAME_LEN:
+                raise AssetError("%s: name longer than %d bytes" % (path, NAME_LEN - 1))
+            if font:
+                with open(path, "rb") as f:
+                    items.append((stem, TYPE_FONT, 0, f.read(), path))
+            elif ext.lower() == ".png":
+                items.append((stem, TYPE_IMAGE) + png_image(path, swap) + (path,))
+            elif ext.lower() == ".bin":
+                items.append((stem, TYPE_IMAGE) + bin_image(path) + (path,))
+    names = [item[0] for item in items]
+    for name in set(names):
+        if names.count(name) > 1:
+            raise AssetError("asset [%s] defined twice" % name)
+    return sorted(items, key=lambda item: item[0].encode())
+
+
+def build_pack():
+    swap = color_swap()
+    items = collect(swap)
+    table_end = HEADER.size + len(items) * ENTRY.size
+    entries = b""
+    blob = bytearray()
+    stamp = 0
+    for name, kind, info, raw, path in items:
+        packed = zlib.compressobj(9, zlib.DEFLATED, -15)
+        packed = packed.compress(raw) + packed.flush()
+        compression = COMPRESSION_DEFLATE if len(packed) <= len(raw) * 7 // 8 else COMPRESSION_NONE
+        stored = packed if compression == COMPRESSION_DEFLATE else raw
+        while len(blob) % 4:
+            blob.append(0)
+        entries += ENTRY.pack(name.encode(), kind, compression, 0, table_end + len(blob), len(stored), len(raw), info)
+        blob += stored
+        stamp = zlib.crc32(name.encode() + raw, stamp)
+        print("asset %-24s %6d -> %6d bytes%s" % (name, len(raw), len(stored), ", deflate" if compression else ""))
+    body = entries + bytes(blob)
+    size = HEADER.size + len(body)
+    crc = zlib.crc32(body) & 0xFFFFFFFF
+    flags = PACK_FLAG_SWAP16 if swap else 0
+    header = HEADER.pack(PACK_MAGIC, PACK_VERSION, len(items), size, crc, stamp & 0xFFFFFFFF, flags, 0)
+    return header + body
+
+
+def partition_size():
+    with open(os.path.join(project_dir, "partitions.csv")) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if cols[0] == PARTITION_NAME and len(cols) >= 5:
+                return int(cols[4], 0)
+    return 0
+
+
+def pack_assets(*args, **kwargs):
+    try:
+        pack = build_pack()
+        limit = partition_size()
+        if len(pack) > limit:
+            raise AssetError("asset pack is %d bytes, the %s partition holds %d" % (len(pack), PARTITION_NAME, limit))
+    except AssetError as e:
+        print("asset_pack: %s" % e)
+        if env is not None:
+            env.Exit(1)
+        sys.exit(1)
+    with open(PACK_FILE, "wb") as f:
+        f.write(pack)
+    print("%s: %d bytes" % (os.path.relpath(PACK_FILE, project_dir), len(pack)))
+
+
+if env is not None:
+    env.AddPreAction("$BUILD_DIR/${ESP32_FS_IMAGE_NAME}.bin", pack_assets)
+else:
+    pack_assets()
@@ -0,0 +1,270 @@
+// Host side config compiler: validates data/config.json and emits the
+// binary config image the firmware installs into its cfgimg partition.
+//
+// Usage: config-compiler <config.json> <config.img>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <ArduinoJson.h>
+
+#include "ConfigImage.h"
+#include "ConfigLimits.h"
+#include "Crc32.h"
+#include "RemoteKeys.h"
+
+#define CONFIG_DOC_MAX_SIZE 65536
+
+const char *keys[] = REMOTE_KEY_NAMES;
+const uint8_t keysLen = sizeof(keys) / sizeof(*keys);
+
+uint16_t errorNum = 0;
+
+void report(bool error, const char *path, const char *msg)
+{
+    fprintf(stderr, "%s: %s %s\n", error ? "error" : "warning", path, msg);
+}
+
+void fail(const char *path, const char *msg)
+{
+    report(true, path, msg);
+    errorNum++;
+}
+
+bool readFile(const char *path, std::string *out)
+{
+    FILE *fp = fopen(path, "rb");
+    if (NULL == fp)
+        return false;
+    char buf[1024];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0)
+    {
+        out->append(buf, len);
+    }
+    fclose(fp);
+    return true;
+}
+
+void checkString(JsonObjectConst obj, const char *key, const char *path, bool required)
+{
+    char keyPath[128];
+    snprintf(keyPath, sizeof(keyPath), "%s.%s", path, key);
+    if (obj[key].isNull())
+    {
+        if (required)
+            fail(keyPath, "is required");
+        return;
+    }
+    if (!obj[key].is<const char *>())
+        fail(keyPath, "must be a string");
+}
+
+void checkObject(JsonVariantConst var, const char *path, bool required)
+{
+    if (var.isNull())
+    {
+        if (required)
+            fail(path, "is required");
+        return;
+    }
+    if (!var.is<JsonObjectConst>())
+        fail(path, "must be an object");
+}
+
+// Shape checks the image builder does not do itself
+void validate(JsonObjectConst root)
+{
+    checkString(root, "code", "$", true);
+    checkString(root, "name", "$", false);
+
+    JsonObjectConst network = root["network-settings"];
+    checkObject(root["network-settings"], "$.network-settings", false);
+    if (network["wifi"].is<JsonArrayConst>())
+    {
+        JsonArrayConst wifis = network["wifi"];
+        char wifiPath[64];
+        for (size_t i = 0; i < wifis.size(); i++)
+        {
+            snprintf(wifiPath, sizeof(wifiPath), "$.network-settings.wifi[%d]", (int)i);
+            checkObject(wifis[i], wifiPath, true);
+            checkString(wifis[i], "ssid", wifiPath, true);
+            checkString(wifis[i], "passwd", wifiPath, false);
+        }
+    }
+    else
+    {
+        checkObject(network["wifi"], "$.network-settings.wifi", false);
+        checkString(network["wifi"], "ssid", "$.network-settings.wifi", false);
+        checkString(network["wifi"], "passwd", "$.network-settings.wifi", false);
+    }
+    checkObject(network["mqtt"], "$.network-settings.mqtt", false);
+    checkString(network["mqtt"], "ip", "$.network-settings.mqtt", false);
+    checkString(network["mqtt"], "username", "$.network-settings.mqtt", false);
+    checkString(network["mqtt"], "passwd", "$.network-settings.mqtt", false);
+    checkObject(root["power-settings"], "$.power-settings", false);
+    checkString(root["power-settings"], "profile", "$.power-settings", false);
+    checkObject(root["backlight-settings"], "$.backlight-settings", false);
+
+    if (!root["scenes"].is<JsonArrayConst>())
+        fail("$.scenes", "must be an array");
+    JsonArrayConst scenes = root["scenes"];
+    char path[64];
+    for (size_t i = 0; i < scenes.size(); i++)
+    {
+        snprintf(path, sizeof(path), "$.scenes[%d]", (int)i);
+        JsonObjectConst scene = scenes[i];
+        checkString(scene, "code", path, true);
+        checkString(scene, "name", path, true);
+        checkString(scene, "type", path, false);
+        char mapPath[96];
+        snprintf(mapPath, sizeof(mapPath), "%s.key-map", path);
+        checkObject(scene["key-map"], mapPath, false);
+        snprintf(mapPath, sizeof(mapPath), "%s.key-map-long", path);
+        checkObject(scene["key-map-long"], mapPath, false);
+        for (size_t j = 0; j < i; j++)
+        {
+            const char *code = scene["code"] | "";
+            const char *otherCode = scenes[j]["code"] | "";
+            if (strlen(code) > 0 && !strcmp(code, otherCode))
+                fail(path, "duplicate scene code");
+        }
+    }
+
+    if (!root["remote-clients"].isNull() && !root["remote-clients"].is<JsonArrayConst>())
+        fail("$.remote-clients", "must be an array");
+    JsonArrayConst clients = root["remote-clients"];
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        snprintf(path, sizeof(path), "$.remote-clients[%d]", (int)i);
+        checkString(clients[i], "name", path, false);
+    }
+}
+
+// Upper bound of the ArduinoJson pool the firmware needs for a value:
+// 16 byte slots on the 32-bit target plus copied strings. The host pool
+// uses 64-bit slots, so doc.memoryUsage() here would overstate it.
+size_t targetJsonSize(JsonVariantConst var)
+{
+    size_t size = 0;
+    if (var.is<JsonObjectConst>())
+    {
+        for (JsonPairConst kv : var.as<JsonObjectConst>())
+        {
+            size += 16 + strlen(kv.key().c_str()) + 1 + targetJsonSize(kv.value());
+        }
+    }
+    else if (var.is<JsonArrayConst>())
+    {
+        for (JsonVariantConst item : var.as<JsonArrayConst>())
+        {
+            size += 16 + targetJsonSize(item);
+        }
+    }
+    else if (var.is<const char *>())
+    {
+        size += strlen(var.as<const char *>()) + 1;
+    }
+    return size;
+}
+
+// RAM the firmware spends on each scene while it is the active or prefetched one
+void reportScenes(JsonArrayConst scenes)
+{
+    char path[64];
+    size_t imageSceneSize = sizeof(ConfigImageScene) + sizeof(ConfigImageKey) * keysLen * 2;
+    printf("%-4s %-16s %-12s %6s %10s %10s\n", "idx", "code", "type", "keys", "json RAM", "image");
+    for (size_t i = 0; i < scenes.size(); i++)
+    {
+        size_t jsonSize = targetJsonSize(scenes[i]);
+        size_t keyNum = scenes[i]["key-map"].size() + scenes[i]["key-map-long"].size();
+        const char *code = scenes[i]["code"] | "";
+        printf("%-4d %-16s %-12s %6d %6d / %d B %6d B\n", (int)i,
+               code, scenes[i]["type"] | "nec",
+               (int)keyNum, (int)jsonSize, CONFIG_SCENE_JSON_SIZE, (int)imageSceneSize);
+        snprintf(path, sizeof(path), "$.scenes[%d]", (int)i);
+        if (jsonSize > CONFIG_SCENE_JSON_SIZE)
+            fail(path, "does not fit the firmware scene document");
+        if (strlen(code) >= CONFIG_SCENE_CODE_LEN)
+            fail(path, "scene code is too long for its file name");
+    }
+    if (scenes.size() > CONFIG_SCENE_MAX)
+        fail("$.scenes", "more scenes than the firmware index holds");
+}
+
+int main(int argc, char const *argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <config.json> <config.img>\n", argv[0]);
+        return 2;
+    }
+
+    std::string jsonStr;
+    if (!readFile(argv[1], &jsonStr))
+    {
+        fprintf(stderr, "error: can not read %s\n", argv[1]);
+        return 1;
+    }
+    // same stamp the firmware computes over the uploaded file
+    uint32_t stamp = crc32((const uint8_t *)jsonStr.data(), jsonStr.length());
+
+    DynamicJsonDocument doc(CONFIG_DOC_MAX_SIZE);
+    DeserializationError error = deserializeJson(doc, jsonStr.c_str());
+    if (error)
+    {
+        fprintf(stderr, "error: $ %s\n", error.c_str());
+        return 1;
+    }
+    JsonObjectConst root = doc.as<JsonObjectConst>();
+    validate(root);
+
+    // scenes are paged out of the root document on the device
+    size_t rootSize = 0;
+    for (JsonPairConst kv : root)
+    {
+        if (strcmp(kv.key().c_str(), "scenes"))
+            rootSize += 16 + strlen(kv.key().c_str()) + 1 + targetJsonSize(kv.value());
+    }
+    printf("config: %s (%d bytes)\n", argv[1], (int)jsonStr.length());
+    printf("root document: %d / %d bytes\n", (int)rootSize, CONFIG_ROOT_JSON_SIZE);
+    if (rootSize > CONFIG_ROOT_JSON_SIZE)
+        fail("$", "does not fit the firmware root document");
+    reportScenes(root["scenes"]);
+
+    JsonArrayConst scenes = root["scenes"];
+    JsonArrayConst clients = root["remote-clients"];
+    ConfigImageBuilder builder;
+    builder.setReport(report);
+    if (!builder.begin(keys, keysLen, scenes.size(), clients.size()))
+        return 1;
+    builder.setRoot(root);
+    for (JsonObjectConst scene : scenes)
+    {
+        builder.addScene(scene);
+    }
+    size_t size = 0;
+    const uint8_t *image = builder.finish(stamp, &size);
+    errorNum += builder.getErrorNum();
+    if (NULL == image || errorNum > 0)
+    {
+        fprintf(stderr, "%d error(s), %d warning(s), no image written\n", errorNum, builder.getWarningNum());
+        builder.end();
+        return 1;
+    }
+
+    FILE *fp = fopen(argv[2], "wb");
+    if (NULL == fp || fwrite(image, 1, size, fp) != size)
+    {
+        fprintf(stderr, "error: can not write %s\n", argv[2]);
+        if (fp != NULL)
+            fclose(fp);
+        builder.end();
+        return 1;
+    }
+    fclose(fp);
+    printf("image: %s (%d bytes, stamp %08X), %d warning(s)\n", argv[2], (int)size, stamp, builder.getWarningNum());
+    builder.end();
+    return 0;
+}
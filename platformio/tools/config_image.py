@@ -0,0 +1,24 @@
+# PlatformIO extra script: compile data/config.json into data/config.img
+# before the filesystem image is built, so every data upload ships a
+# validated, pre-compiled config image. A config with errors stops the build.
+
+import os
+
+Import("env")
+
+project_dir = env.subst("$PROJECT_DIR")
+data_dir = env.subst("$PROJECT_DATA_DIR")
+config_json = os.path.join(data_dir, "config.json")
+config_img = os.path.join(data_dir, "config.img")
+compiler = os.path.join(env.subst("$PROJECT_BUILD_DIR"), "config-compiler", "program")
+
+
+def compile_config(source, target, env):
+    if env.Execute('"$PYTHONEXE" -m platformio run -d "%s" -e config-compiler' % project_dir):
+        env.Exit(1)
+    if env.Execute('"%s" "%s" "%s"' % (compiler, config_json, config_img)):
+        print("config.json is invalid, see the errors above")
+        env.Exit(1)
+
+
+env.AddPreAction("$BUILD_DIR/${ESP32_FS_IMAGE_NAME}.bin", compile_config)
@@ -0,0 +1,377 @@
+# PlatformIO extra script: subset the smooth font made by
+# test/Create_Smooth_Font/Create_font/Create_font.pde down to the glyphs the
+# UI can actually show and emit it as a compressed LVGL font, src/font_ui24.c.
+#
+# The character set is printable ASCII (scene names, key codes, counters are
+# built at runtime) plus every non-ASCII character found in a string literal
+# under src/ or in a string of data/config.json. The output is only rewritten
+# when it changes, so editing a UI string regenerates the font on the next
+# build and an unrelated build does not recompile it.
+#
+# Run by hand with: python tools/font_subset.py [project dir]
+
+import os
+import re
+import struct
+import sys
+
+try:
+    Import("env")
+    project_dir = env.subst("$PROJECT_DIR")
+except NameError:
+    env = None
+    project_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+FONT_NAME = "font_ui24"
+FONT_VLW = os.path.join(project_dir, "test", "Create_Smooth_Font", "Create_font", "FontFiles", "MiSans-Normal24.vlw")
+FONT_OUT = os.path.join(project_dir, "src", FONT_NAME + ".c")
+SRC_DIR = os.path.join(project_dir, "src")
+CONFIG_JSON = os.path.join(project_dir, "data", "config.json")
+SOURCE_EXTS = (".c", ".cpp", ".h")
+SOURCE_SKIP = ("font_", "img_")  # generated data, not UI strings
+BPP = 4
+RLE_REPEAT_MAX = 11  # ones before the 6 bit counter, see rle_next() in lv_font_fmt_txt.c
+RLE_COUNTER_MAX = 63
+
+
+class FontError(Exception):
+    pass
+
+
+# --- character set ---------------------------------------------------------
+
+def literals(text):
+    # string literals of C/C++ source, comments skipped
+    out = []
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith("//", i):
+            i = text.find("\n", i)
+            i = n if i < 0 else i
+        elif text.startswith("/*", i):
+            i = text.find("*/", i + 2)
+            i = n if i < 0 else i + 2
+        elif c == "'":
+            i += 1
+            while i < n and text[i] != "'":
+                i += 2 if text[i] == "\\" else 1
+            i += 1
+        elif c == '"':
+            i += 1
+            begin = i
+            while i < n and text[i] != '"':
+                i += 2 if text[i] == "\\" else 1
+            out.append(text[begin:i])
+            i += 1
+        else:
+            i += 1
+    return out
+
+
+def json_strings(text):
+    return [m.group(1) for m in re.finditer(r'"((?:[^"\\]|\\.)*)"', text)]
+
+
+def collect_chars():
+    chars = set(range(0x20, 0x7F))
+    strings = []
+    for name in sorted(os.listdir(SRC_DIR)):
+        if not name.endswith(SOURCE_EXTS) or name.startswith(SOURCE_SKIP):
+            continue
+        with open(os.path.join(SRC_DIR, name), encoding="utf-8") as f:
+            strings += literals(f.read())
+    if os.path.exists(CONFIG_JSON):
+        with open(CONFIG_JSON, encoding="utf-8") as f:
+            strings += json_strings(f.read())
+    for s in strings:
+        chars.update(ord(c) for c in s if ord(c) > 0x7F)
+    return sorted(chars)
+
+
+# --- VLW source ------------------------------------------------------------
+
+def load_vlw(path):
+    # [count version size unused ascent descent][count * 7 int32 metrics][8 bit alpha bitmaps]
+    with open(path, "rb") as f:
+        data = f.read()
+    count, _, size, _, ascent, descent = struct.unpack_from(">6i", data, 0)
+    glyphs = {}
+    offset = 24 + count * 28
+    for i in range(count):
+        unicode, height, width, advance, dy, dx, _ = struct.unpack_from(">7i", data, 24 + i * 28)
+        glyphs[unicode] = {
+            "w": width, "h": height, "adv": advance, "dx": dx, "dy": dy,
+            "alpha": data[offset:offset + width * height],
+        }
+        offset += width * height
+    if offset > len(data):
+        raise FontError("%s is truncated" % path)
+    if 0x20 not in glyphs:
+        # Processing does not store the space, TFT_eSPI makes it up the same way
+        glyphs[0x20] = {"w": 0, "h": 0, "adv": (ascent + descent) * 2 // 7, "dx": 0, "dy": 0, "alpha": b""}
+    return size, ascent, descent, glyphs
+
+
+# --- compression -----------------------------------------------------------
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.bits = 0
+
+    def write(self, value, bits):
+        for b in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> b) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.bits = 0
+
+    def finish(self):
+        if self.bits:
+            self.out.append(self.acc << (8 - self.bits))
+        self.out.append(0)  # the decoder peeks one byte ahead
+        return bytes(self.out)
+
+
+def rle_encode(pixels):
+    # The inverse of LVGL's rle_next(): a value equal to the previous one
+    # switches to 1 bit repeats, after 11 of them a 6 bit counter follows.
+    w = BitWriter()
+    n = len(pixels)
+    i = 0
+    while i < n:
+        v = pixels[i]
+        w.write(v, BPP)
+        i += 1
+        if i == 1 or v != pixels[i - 2]:
+            continue
+        # repeat state: prev == v
+        ones = 0
+        while i < n:
+            if pixels[i] != v:
+                w.write(0, 1)
+                w.write(pixels[i], BPP)
+                i += 1
+                break
+            w.write(1, 1)
+            ones += 1
+            i += 1
+            if ones == RLE_REPEAT_MAX:
+                run = 0
+                while i + run < n and pixels[i + run] == v and run < RLE_COUNTER_MAX - 1:
+                    run += 1
+                w.write(run + 1, 6)
+                i += run
+                w.write(pixels[i] if i < n else 0, BPP)
+                i += 1
+                break
+    return w.finish()
+
+
+def rle_decode(data, count):
+    # straight port of rle_next(), used to check the encoder
+    pos = [0]
+
+    def bits(length):
+        value = 0
+        for _ in range(length):
+            byte = data[pos[0] >> 3]
+            value = (value << 1) | ((byte >> (7 - (pos[0] & 7))) & 1)
+            pos[0] += 1
+        return value
+
+    out = []
+    state, prev, cnt = "single", 0, 0
+    for _ in range(count):
+        if state == "single":
+            ret = bits(BPP)
+            if pos[0] != BPP and prev == ret:
+                cnt = 0
+                state = "repeat"
+            prev = ret
+        elif state == "repeat":
+            v = bits(1)
+            cnt += 1
+            if v == 1:
+                ret = prev
+                if cnt == RLE_REPEAT_MAX:
+                    cnt = bits(6)
+                    if cnt != 0:
+                        state = "counter"
+                    else:
+                        ret = prev = bits(BPP)
+                        state = "single"
+            else:
+                ret = prev = bits(BPP)
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(BPP)
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def compress(glyph):
+    w, h = glyph["w"], glyph["h"]
+    px = [(a * 15 + 127) // 255 for a in glyph["alpha"]]
+    if not px:
+        return b""
+    # every row is stored xor-ed with the row above, runs get longer
+    rows = [px[y * w:(y + 1) * w] for y in range(h)]
+    stream = list(rows[0])
+    for y in range(1, h):
+        stream += [a ^ b for a, b in zip(rows[y], rows[y - 1])]
+    data = rle_encode(stream)
+    if rle_decode(data, len(stream)) != stream:
+        raise FontError("compression round trip failed")
+    return data
+
+
+# --- LVGL font -------------------------------------------------------------
+
+def cmaps_for(codes):
+    # printable ASCII as one dense range, everything else as sparse lists
+    out = []
+    ascii_codes = [c for c in codes if c < 0x7F]
+    if ascii_codes:
+        out.append(("LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY", ascii_codes))
+    rest = [c for c in codes if c >= 0x7F]
+    while rest:
+        group = [c for c in rest if c - rest[0] <= 0xFFFF]
+        out.append(("LV_FONT_FMT_TXT_CMAP_SPARSE_TINY", group))
+        rest = rest[len(group):]
+    return out
+
+
+def hex_lines(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def generate(codes, ascent, descent, glyphs, vlw_name):
+    bitmap = bytearray()
+    dscs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    top, bottom = ascent, descent
+    for code in codes:
+        g = glyphs[code]
+        index = len(bitmap)
+        bitmap += compress(g)
+        top = max(top, g["dy"])
+        bottom = max(bottom, g["h"] - g["dy"])
+        dscs.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d} /* U+%04X */"
+                    % (index, g["adv"] * 16, g["w"], g["h"], g["dx"], g["dy"] - g["h"], code))
+    if len(bitmap) >= 1 << 20:
+        raise FontError("bitmap of %d bytes does not fit LV_FONT_FMT_TXT_LARGE == 0" % len(bitmap))
+
+    lists = []
+    cmaps = []
+    glyph_id = 1
+    for i, (kind, group) in enumerate(cmaps_for(codes)):
+        start = group[0]
+        if kind.endswith("SPARSE_TINY"):
+            lists.append("static const uint16_t unicode_list_%d[] = {\n%s\n};\n"
+                         % (i, hex_lines([c - start for c in group], 8, "0x%x")))
+            cmaps.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                         "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, .type = %s\n    }"
+                         % (start, group[-1] - start + 1, glyph_id, i, len(group), kind))
+        else:
+            if group != list(range(start, group[-1] + 1)):
+                raise FontError("ASCII range has holes")
+            cmaps.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                         "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = %s\n    }"
+                         % (start, len(group), glyph_id, kind))
+        glyph_id += len(group)
+
+    extra = "".join(chr(c) for c in codes if c > 0x7F)
+    return """/*
+ * Generated by tools/font_subset.py from %(vlw)s, do not edit.
+ * Size: 24 px, bpp: %(bpp)d, compressed
+ * Glyphs: %(count)d, printable ASCII and %(extra)s
+ */
+
+#include <lvgl.h>
+
+#if !LV_USE_FONT_COMPRESSED
+#error "%(name)s is compressed, enable LV_USE_FONT_COMPRESSED in lv_conf.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+%(bitmap)s
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+%(dscs)s
+};
+
+%(lists)s
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+%(cmaps)s
+};
+
+static lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = %(cmap_num)d,
+    .bpp = %(bpp)d,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+};
+
+lv_font_t %(name)s = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = %(line_height)d,
+    .base_line = %(base_line)d,
+    .subpx = LV_FONT_SUBPX_NONE,
+#if LV_VERSION_CHECK(7, 4, 0)
+    .underline_position = -2,
+    .underline_thickness = 1,
+#endif
+    .dsc = &font_dsc,
+};
+""" % {
+        "vlw": vlw_name, "bpp": BPP, "count": len(codes), "extra": extra or "nothing else",
+        "name": FONT_NAME, "bitmap": hex_lines(list(bitmap), 16, "0x%02x"), "dscs": ",\n".join(dscs),
+        "lists": "\n".join(lists), "cmaps": ",\n".join(cmaps), "cmap_num": len(cmaps),
+        "line_height": top + bottom, "base_line": bottom,
+    }
+
+
+def subset_font():
+    codes = collect_chars()
+    _, ascent, descent, glyphs = load_vlw(FONT_VLW)
+    missing = [c for c in codes if c not in glyphs]
+    if missing:
+        raise FontError("%s has no glyph for %s\nadd them to specificUnicodes in Create_font.pde and recreate the font:\n  %s"
+                        % (os.path.basename(FONT_VLW), "".join(chr(c) for c in missing),
+                           ", ".join("0x%04X" % c for c in missing)))
+    text = generate(codes, ascent, descent, glyphs, os.path.basename(FONT_VLW))
+    old = None
+    if os.path.exists(FONT_OUT):
+        with open(FONT_OUT, encoding="utf-8") as f:
+            old = f.read()
+    if old != text:
+        with open(FONT_OUT, "w", encoding="utf-8") as f:
+            f.write(text)
+        print("%s: %d glyphs regenerated" % (os.path.relpath(FONT_OUT, project_dir), len(codes)))
+
+
+try:
+    subset_font()
+except FontError as e:
+    print("font_subset: %s" % e)
+    if env is not None:
+        env.Exit(1)
+    sys.exit(1)